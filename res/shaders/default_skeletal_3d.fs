@@ -1,12 +1,11 @@
 #version 330 core
 
+#include "include/frame_data_common.glsl"
+
 uniform sampler2D tex;
-uniform vec3 light_positions[32];
-uniform float light_powers[32];
 uniform vec4 material_ambient;
 uniform vec4 material_diffuse;
 uniform vec4 material_specular;
-uniform vec3 eye_pos;
 uniform float material_shininess;
 uniform bool flip_tex_hor;
 uniform bool flip_tex_ver;
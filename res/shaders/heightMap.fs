@@ -1,45 +1,60 @@
 #version 330 core
 
+#include "include/frame_data_common.glsl"
+
 uniform sampler2D heightMap_texture_0;
 uniform sampler2D heightMap_texture_1;
 uniform sampler2D heightMap_texture_2;
 uniform sampler2D heightMap_texture_3;
 uniform sampler2D heightMap_texture_4;
-uniform sampler2D shadowMap_texture;
-uniform vec3 light_positions[32];
-uniform float light_powers[32];
+uniform sampler2D shadowMap_texture_0;
+uniform sampler2D shadowMap_texture_1;
+uniform sampler2D shadowMap_texture_2;
+uniform sampler2D shadowMap_texture_3;
 uniform vec4 material_ambient;
 uniform vec4 material_diffuse;
 uniform vec4 material_specular;
-uniform vec3 eye_pos;
 uniform float material_shininess;
-uniform float dt_accumulator;
 uniform bool flip_tex_hor;
 uniform bool flip_tex_ver;
-uniform bool shadows_enabled;
 uniform bool is_affected_by_light;
 
 in vec2 uv_frag;
 in vec3 normal_interp;
 in vec3 frag_pos;
 in vec3 frag_unprojected_pos;
-in vec4 frag_pos_in_light_space;
+in float frag_view_depth;
 in float height_map_scale_factor;
 
 out vec4 frag_color;
 
 #include "include/light_common.fs"
 
+float SampleShadowCascade(int cascade_index, vec2 coords)
+{
+	// samplers can only be indexed by constant expressions
+	if (cascade_index == 0) return textureLod(shadowMap_texture_0, coords, 0.0).r;
+	if (cascade_index == 1) return textureLod(shadowMap_texture_1, coords, 0.0).r;
+	if (cascade_index == 2) return textureLod(shadowMap_texture_2, coords, 0.0).r;
+	return textureLod(shadowMap_texture_3, coords, 0.0).r;
+}
+
 float CalculateShadow()
 {
+	// pick the closest cascade covering the fragment, fragments past the last one receive no shadows
+	int cascade_index = 0;
+	while (cascade_index < shadow_cascade_count && frag_view_depth > shadow_cascade_split_depths[cascade_index]) cascade_index++;
+	if (cascade_index >= shadow_cascade_count) return 0.0f;
+
 	// perform perspective divide
+	vec4 frag_pos_in_light_space = light_space_matrices[cascade_index] * vec4(frag_unprojected_pos, 1.0f);
     vec3 projected_coords = frag_pos_in_light_space.xyz / frag_pos_in_light_space.w;
 
     // transform to [0,1] range
     projected_coords = projected_coords * 0.5 + 0.5;
 
     // get closest depth value from light's perspective (using [0,1] range fragPosLight as coords)
-    float closestDepth = texture(shadowMap_texture, projected_coords.xy).r; 
+    float closestDepth = SampleShadowCascade(cascade_index, projected_coords.xy);
 
     // get depth of current fragment from light's perspective
     float currentDepth = projected_coords.z;
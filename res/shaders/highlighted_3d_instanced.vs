@@ -0,0 +1,38 @@
+#version 330 core
+
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec2 uv;
+layout(location = 2) in vec3 normal;
+
+// Per instance attributes
+layout(location = 3)  in mat4 instance_world;
+layout(location = 7)  in mat4 instance_norm;
+layout(location = 11) in vec4 instance_material_ambient;
+layout(location = 12) in vec4 instance_material_diffuse;
+layout(location = 13) in vec4 instance_material_specular;
+layout(location = 14) in float instance_material_shininess;
+
+#include "include/frame_data_common.glsl"
+
+out vec2 uv_frag;
+out vec3 normal_interp;
+out vec3 frag_pos;
+out vec3 frag_unprojected_pos;
+flat out vec4 material_ambient;
+flat out vec4 material_diffuse;
+flat out vec4 material_specular;
+flat out float material_shininess;
+
+void main()
+{
+    uv_frag = uv;
+    normal_interp = (instance_norm * vec4(normal, 0.0f)).rgb;
+    frag_unprojected_pos = (instance_world * vec4(position, 1.0f)).rgb;
+    gl_Position = proj * view * vec4(frag_unprojected_pos, 1.0f);
+    frag_pos = gl_Position.rgb;
+
+    material_ambient = instance_material_ambient;
+    material_diffuse = instance_material_diffuse;
+    material_specular = instance_material_specular;
+    material_shininess = instance_material_shininess;
+}
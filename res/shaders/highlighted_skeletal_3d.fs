@@ -2,6 +2,8 @@
 
 const vec4 HIGHLIGHT_COLOR = vec4(0.1f, 0.1f, 0.1f, 0.0f);
 
+#include "include/frame_data_common.glsl"
+
 uniform sampler2D tex;
 uniform bool flip_tex_hor;
 uniform bool flip_tex_ver;
@@ -10,9 +12,6 @@ uniform vec4 material_diffuse;
 uniform vec4 material_specular;
 uniform float material_shininess;
 uniform int is_affected_by_light;
-uniform vec3 light_positions[32];
-uniform float light_powers[32];
-uniform vec3 eye_pos;
 
 in vec2 uv_frag;
 in vec3 normal_interp;
@@ -6,10 +6,10 @@ layout(location = 2) in vec3 normal;
 layout(location = 3) in ivec4 boneIds;
 layout(location = 4) in vec4 weights;
 
+#include "include/frame_data_common.glsl"
+
 uniform mat4 norm;
 uniform mat4 world;
-uniform mat4 view;
-uniform mat4 proj;
 uniform mat4 bones[100];
 
 out vec2 uv_frag;
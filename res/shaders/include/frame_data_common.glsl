@@ -0,0 +1,13 @@
+layout (std140) uniform FrameData
+{
+	mat4 view;
+	mat4 proj;
+	mat4 light_space_matrices[4];
+	vec3 light_positions[32];
+	float light_powers[32];
+	vec4 shadow_cascade_split_depths;
+	vec3 eye_pos;
+	float dt_accumulator;
+	bool shadows_enabled;
+	int shadow_cascade_count;
+};
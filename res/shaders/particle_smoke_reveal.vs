@@ -6,8 +6,7 @@ layout(location = 2) in vec3 position;
 layout(location = 3) in float lifetime;
 layout(location = 4) in float size;
 
-uniform mat4 view;
-uniform mat4 proj;
+#include "include/frame_data_common.glsl"
 
 out float frag_lifetime;
 out vec2 uv_frag;
@@ -6,9 +6,11 @@ layout(location = 2) in vec3 normal;
 layout(location = 3) in ivec4 boneIds;
 layout(location = 4) in vec4 weights;
 
+#include "include/frame_data_common.glsl"
+
 uniform mat4 world;
-uniform mat4 light_space_matrix;
 uniform mat4 bones[100];
+uniform int shadow_cascade_index;
 
 void main()
 {
@@ -17,5 +19,5 @@ void main()
 	boneTransform += bones[boneIds[2]] * weights[2];
 	boneTransform += bones[boneIds[3]] * weights[3];
 
-    gl_Position = light_space_matrix * world * boneTransform * vec4(position, 1.0);
+    gl_Position = light_space_matrices[shadow_cascade_index] * world * boneTransform * vec4(position, 1.0);
 }
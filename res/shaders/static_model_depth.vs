@@ -2,10 +2,12 @@
 
 layout(location = 0) in vec3 position;
 
-uniform mat4 light_space_matrix;
+#include "include/frame_data_common.glsl"
+
 uniform mat4 world;
+uniform int shadow_cascade_index;
 
 void main()
 {
-    gl_Position = light_space_matrix * world * vec4(position, 1.0);
+    gl_Position = light_space_matrices[shadow_cascade_index] * world * vec4(position, 1.0);
 }
@@ -4,9 +4,9 @@ layout(location = 0) in vec3 position;
 layout(location = 1) in vec2 uv;
 layout(location = 2) in vec3 normal;
 
+#include "include/frame_data_common.glsl"
+
 uniform mat4 world;
-uniform mat4 view;
-uniform mat4 proj;
 
 out vec2 uv_frag;
 
@@ -0,0 +1,23 @@
+#version 330 core
+
+in vec2 uv_frag;
+in vec4 custom_color_frag;
+
+out vec4 frag_color;
+
+uniform sampler2D tex;
+
+void main()
+{
+	// Calculate final uvs
+    float finalUvX = uv_frag.x;    
+    float finalUvY = 1.00 - uv_frag.y;    
+
+	// Get texture color
+    frag_color = texture(tex, vec2(finalUvX, finalUvY));
+	
+	// Apply custom color if any
+	frag_color.r = min(1.0f, frag_color.r + custom_color_frag.r);
+	frag_color.g = min(1.0f, frag_color.g + custom_color_frag.g);
+	frag_color.b = min(1.0f, frag_color.b + custom_color_frag.b);		
+}
@@ -0,0 +1,17 @@
+#version 330 core
+
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec2 uv;
+layout(location = 2) in vec4 color;
+
+#include "include/frame_data_common.glsl"
+
+out vec2 uv_frag;
+out vec4 custom_color_frag;
+
+void main()
+{
+    uv_frag = uv;
+    custom_color_frag = color;
+    gl_Position = proj * view * vec4(position, 1.0f);
+}
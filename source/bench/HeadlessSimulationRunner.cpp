@@ -0,0 +1,218 @@
+///------------------------------------------------------------------------------------------------
+///  HeadlessSimulationRunner.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "HeadlessSimulationRunner.h"
+#include "IBenchmarkScenario.h"
+#include "systems/NullRenderingSystem.h"
+#include "../engine/ECS.h"
+#include "../engine/animation/systems/ModelAnimationSystem.h"
+#include "../engine/common/utils/Logging.h"
+#include "../engine/debug/Profiler.h"
+#include "../engine/debug/components/DebugViewStateSingletonComponent.h"
+#include "../engine/input/systems/RawInputHandlingSystem.h"
+#include "../engine/rendering/components/RenderingContextSingletonComponent.h"
+#include "../engine/rendering/components/WindowSingletonComponent.h"
+#include "../engine/rendering/opengl/RecordingRenderDevice.h"
+#include "../engine/rendering/systems/ParticleUpdaterSystem.h"
+#include "../engine/resources/ResourceLoadingService.h"
+#include "../engine/scripting/DefaultEngineExportableFunctions.h"
+#include "../engine/scripting/service/LuaScriptingService.h"
+#include "../engine/scripting/systems/ScriptingSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const StringId FRAME_STATISTICS_NAME = StringId("Frame");
+
+    // Nominal resolution for the systems that lay out entities in screen space
+    const float HEADLESS_RENDERABLE_WIDTH  = 1920.0f;
+    const float HEADLESS_RENDERABLE_HEIGHT = 1080.0f;
+
+    const double MICROS_PER_MILLI = 1000.0;
+    const long long NANOS_PER_MICRO = 1000LL;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static long long GetPercentile(const std::vector<long long>& sortedSamples, const double percentile);
+
+///------------------------------------------------------------------------------------------------
+
+HeadlessSimulationRunner::HeadlessSimulationRunner()
+{
+    InitializeHeadlessSingletonComponents();
+    InitializeServices();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool HeadlessSimulationRunner::RunScenario(IBenchmarkScenario& scenario, const float fixedDt)
+{
+    auto& world = genesis::ecs::World::GetInstance();
+
+    world.AddSystem(std::make_unique<genesis::input::RawInputHandlingSystem>());
+    world.AddSystem(std::make_unique<genesis::scripting::ScriptingSystem>());
+
+    scenario.VOnSystemsInit();
+
+    world.AddSystem(std::make_unique<genesis::animation::ModelAnimationSystem>());
+    world.AddSystem(std::make_unique<genesis::rendering::ParticleUpdaterSystem>());
+    world.AddSystem(std::make_unique<NullRenderingSystem>());
+
+    scenario.VOnScenarioInit();
+
+    Log(LogType::INFO, "Running scenario: %s", scenario.VGetDescription().c_str());
+
+    const auto frameCount = static_cast<int>(std::ceil(scenario.VGetSimulatedDuration()/fixedDt));
+    auto simulatedFrameCount = 0;
+    while (simulatedFrameCount < frameCount && !scenario.VHasFinishedEarly())
+    {
+        const auto frameStartNanos = genesis::debug::Profiler::GetTimestampNanos();
+        world.Update(fixedDt);
+        RecordFrameTimes((genesis::debug::Profiler::GetTimestampNanos() - frameStartNanos)/NANOS_PER_MICRO);
+
+        simulatedFrameCount++;
+    }
+
+    if (simulatedFrameCount < frameCount)
+    {
+        Log(LogType::INFO, "Scenario finished early after %d of %d frames", simulatedFrameCount, frameCount);
+    }
+
+    PrintFrameTimeStatistics(scenario, simulatedFrameCount, fixedDt);
+    
+    if (!scenario.VVerifyResults())
+    {
+        Log(LogType::ERROR, "Scenario failed verification: %s", scenario.VGetDescription().c_str());
+        return false;
+    }
+    
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void HeadlessSimulationRunner::InitializeHeadlessSingletonComponents() const
+{
+    auto& world = genesis::ecs::World::GetInstance();
+
+    auto windowComponent = std::make_unique<genesis::rendering::WindowSingletonComponent>();
+    windowComponent->mWindowTitle      = "Headless";
+    windowComponent->mRenderableWidth  = HEADLESS_RENDERABLE_WIDTH;
+    windowComponent->mRenderableHeight = HEADLESS_RENDERABLE_HEIGHT;
+    windowComponent->mAspectRatio      = HEADLESS_RENDERABLE_WIDTH/HEADLESS_RENDERABLE_HEIGHT;
+
+    world.SetSingletonComponent<genesis::rendering::WindowSingletonComponent>(std::move(windowComponent));
+
+    // Rendering commands are only recorded, as there is no GL context to issue them to
+    auto renderingContextComponent = std::make_unique<genesis::rendering::RenderingContextSingletonComponent>();
+    renderingContextComponent->mRenderDevice = std::make_unique<genesis::rendering::RecordingRenderDevice>(false);
+    renderingContextComponent->mGLStateCache.SetRenderDevice(*renderingContextComponent->mRenderDevice);
+    
+    world.SetSingletonComponent<genesis::rendering::RenderingContextSingletonComponent>(std::move(renderingContextComponent));
+    world.SetSingletonComponent<genesis::debug::DebugViewStateSingletonComponent>(std::make_unique<genesis::debug::DebugViewStateSingletonComponent>());
+}
+
+///------------------------------------------------------------------------------------------------
+
+void HeadlessSimulationRunner::InitializeServices() const
+{
+    // No sound service, as nothing will be played back
+    genesis::resources::ResourceLoadingService::GetInstance().Initialize();
+    genesis::scripting::LuaScriptingService::GetInstance().Initialize();
+    genesis::scripting::BindDefaultEngineFunctionsToLua();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void HeadlessSimulationRunner::RecordFrameTimes(const long long frameDurationMicros)
+{
+    mFrameTimesMicros.push_back(frameDurationMicros);
+
+    for (const auto& systemUpdateTimeEntry: genesis::ecs::World::GetInstance().GetSystemUpdateTimes())
+    {
+        mSystemFrameTimesMicros[systemUpdateTimeEntry.first].push_back(systemUpdateTimeEntry.second);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void HeadlessSimulationRunner::PrintFrameTimeStatistics(const IBenchmarkScenario& scenario, const int frameCount, const float fixedDt) const
+{
+    struct FrameTimeStatistics
+    {
+        StringId mName;
+        double mMeanMillis;
+        double mP50Millis;
+        double mP99Millis;
+        double mMaxMillis;
+    };
+
+    const auto calculateStatistics = [](const StringId& name, std::vector<long long> samples)
+    {
+        std::sort(samples.begin(), samples.end());
+
+        FrameTimeStatistics statistics;
+        statistics.mName       = name;
+        statistics.mMeanMillis = std::accumulate(samples.cbegin(), samples.cend(), 0.0)/samples.size()/MICROS_PER_MILLI;
+        statistics.mP50Millis  = GetPercentile(samples, 0.5)/MICROS_PER_MILLI;
+        statistics.mP99Millis  = GetPercentile(samples, 0.99)/MICROS_PER_MILLI;
+        statistics.mMaxMillis  = samples.back()/MICROS_PER_MILLI;
+        return statistics;
+    };
+
+    if (mFrameTimesMicros.empty())
+    {
+        Log(LogType::WARNING, "No frames were simulated for scenario: %s", scenario.VGetDescription().c_str());
+        return;
+    }
+
+    std::vector<FrameTimeStatistics> systemStatistics;
+    for (const auto& systemFrameTimesEntry: mSystemFrameTimesMicros)
+    {
+        systemStatistics.push_back(calculateStatistics(systemFrameTimesEntry.first, systemFrameTimesEntry.second));
+    }
+
+    // Most expensive systems first
+    std::sort(systemStatistics.begin(), systemStatistics.end(), [](const FrameTimeStatistics& lhs, const FrameTimeStatistics& rhs)
+    {
+        return lhs.mMeanMillis > rhs.mMeanMillis;
+    });
+    systemStatistics.insert(systemStatistics.begin(), calculateStatistics(FRAME_STATISTICS_NAME, mFrameTimesMicros));
+
+    Log(LogType::INFO, "%s: %d frames at a fixed dt of %.4fs (%.1fs simulated)", scenario.VGetDescription().c_str(), frameCount, fixedDt, frameCount * fixedDt);
+    Log(LogType::INFO, "%-48s %10s %10s %10s %10s", "System", "mean(ms)", "p50(ms)", "p99(ms)", "max(ms)");
+    for (const auto& statistics: systemStatistics)
+    {
+        Log(LogType::INFO, "%-48s %10.3f %10.3f %10.3f %10.3f", statistics.mName.GetString().c_str(), statistics.mMeanMillis, statistics.mP50Millis, statistics.mP99Millis, statistics.mMaxMillis);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+long long GetPercentile(const std::vector<long long>& sortedSamples, const double percentile)
+{
+    // Nearest rank
+    const auto rank = static_cast<std::size_t>(std::ceil(percentile * sortedSamples.size()));
+    return sortedSamples[std::max(rank, static_cast<std::size_t>(1)) - 1];
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
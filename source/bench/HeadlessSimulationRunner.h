@@ -0,0 +1,60 @@
+///------------------------------------------------------------------------------------------------
+///  HeadlessSimulationRunner.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef HeadlessSimulationRunner_h
+#define HeadlessSimulationRunner_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "../engine/common/utils/StringUtils.h"
+
+#include <tsl/robin_map.h>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+class IBenchmarkScenario;
+
+///------------------------------------------------------------------------------------------------
+/// Runs benchmark scenarios without a window or GL context, stepping the world at a fixed
+/// delta time and reporting the frame time distribution of every system.
+class HeadlessSimulationRunner final
+{
+public:
+    /// Initializes the services and singleton components the engine would normally create
+    /// alongside the SDL window and GL context.
+    HeadlessSimulationRunner();
+
+    /// Initializes and runs the given scenario, then prints the frame time statistics of the run.
+    /// @param[in] scenario the scenario to run.
+    /// @param[in] fixedDt the delta time in seconds of every simulated frame.
+    /// @returns whether the scenario verified its results after the run.
+    bool RunScenario(IBenchmarkScenario& scenario, const float fixedDt);
+
+private:
+    void InitializeHeadlessSingletonComponents() const;
+    void InitializeServices() const;
+    void RecordFrameTimes(const long long frameDurationMicros);
+    void PrintFrameTimeStatistics(const IBenchmarkScenario& scenario, const int frameCount, const float fixedDt) const;
+
+private:
+    tsl::robin_map<StringId, std::vector<long long>, StringIdHasher> mSystemFrameTimesMicros;
+    std::vector<long long> mFrameTimesMicros;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* HeadlessSimulationRunner_h */
@@ -0,0 +1,63 @@
+///------------------------------------------------------------------------------------------------
+///  IBenchmarkScenario.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef IBenchmarkScenario_h
+#define IBenchmarkScenario_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+/// The interface of a scripted simulation scenario. This should be subclassed and supplied
+/// to the runner's RunScenario method \see HeadlessSimulationRunner::RunScenario()
+class IBenchmarkScenario
+{
+public:
+    virtual ~IBenchmarkScenario() = default;
+
+    /// @returns a human readable description of the scenario.
+    virtual std::string VGetDescription() const = 0;
+
+    /// Scenario systems initialization method.
+    ///
+    /// This is where all game systems exercised by the scenario should be initialized.
+    /// The engine systems preceding and following them are added by the runner.
+    virtual void VOnSystemsInit() = 0;
+
+    /// Scenario initialization method.
+    ///
+    /// This will be called after all systems have been initialized, and should
+    /// populate the world with the entities the scenario will simulate.
+    virtual void VOnScenarioInit() = 0;
+
+    /// @returns the simulated time in seconds that the scenario should run for.
+    virtual float VGetSimulatedDuration() const = 0;
+
+    /// @returns whether the scenario has reached an end state before its simulated duration elapsed.
+    virtual bool VHasFinishedEarly() const = 0;
+
+    /// Scenario verification method.
+    ///
+    /// This will be called after the scenario has finished running, and should check
+    /// the end state of the world for the behaviour the scenario exercises.
+    /// @returns whether the scenario ran as expected.
+    virtual bool VVerifyResults() const = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* IBenchmarkScenario_h */
@@ -0,0 +1,91 @@
+///------------------------------------------------------------------------------------------------
+///  Main.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "HeadlessSimulationRunner.h"
+#include "scenarios/BattleBenchmarkScenario.h"
+#include "scenarios/EntityChurnValidationScenario.h"
+#include "scenarios/NameIndexValidationScenario.h"
+#include "scenarios/OverworldBenchmarkScenario.h"
+#include "scenarios/RenderStreamValidationScenario.h"
+#include "scenarios/UniformUploadBenchmarkScenario.h"
+#include "../engine/common/utils/Logging.h"
+#include "../engine/common/utils/MathUtils.h"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const std::string USAGE_STRING = "Usage: simulation_benchmark battle [units_per_side=400] [seconds=60] | overworld [ai_units=300] [days=30] | name_index [entities=500] [seconds=10] | churn [entities=2000] [seconds=10] | render_stream [seconds=2] | uniforms [draws=20000] [bones=50]";
+
+    // Fixed so that consecutive runs simulate the exact same scenario
+    static const unsigned int RANDOM_SEED = 1337U;
+
+    static const float FIXED_DT = 1.0f/60.0f;
+
+    static const int DEFAULT_BATTLE_UNITS_PER_SIDE  = 400;
+    static const int DEFAULT_BATTLE_SECONDS         = 60;
+    static const int DEFAULT_OVERWORLD_AI_UNITS     = 300;
+    static const int DEFAULT_OVERWORLD_IN_GAME_DAYS = 30;
+    static const int DEFAULT_NAME_INDEX_ENTITIES    = 500;
+    static const int DEFAULT_NAME_INDEX_SECONDS     = 10;
+    static const int DEFAULT_CHURN_ENTITIES         = 2000;
+    static const int DEFAULT_CHURN_SECONDS          = 10;
+    static const int DEFAULT_RENDER_STREAM_SECONDS  = 2;
+    static const int DEFAULT_UNIFORM_DRAWS          = 20000;
+    static const int DEFAULT_UNIFORM_BONES          = 50;
+}
+
+///------------------------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    const auto scenarioName = argc > 1 ? std::string(argv[1]) : std::string("battle");
+    const auto firstArgument = [&](const int defaultValue) { return argc > 2 ? std::atoi(argv[2]) : defaultValue; };
+    const auto secondArgument = [&](const int defaultValue) { return argc > 3 ? std::atoi(argv[3]) : defaultValue; };
+
+    std::unique_ptr<bench::IBenchmarkScenario> scenario;
+    if (scenarioName == "battle")
+    {
+        scenario = std::make_unique<bench::BattleBenchmarkScenario>(firstArgument(DEFAULT_BATTLE_UNITS_PER_SIDE), static_cast<float>(secondArgument(DEFAULT_BATTLE_SECONDS)));
+    }
+    else if (scenarioName == "overworld")
+    {
+        scenario = std::make_unique<bench::OverworldBenchmarkScenario>(firstArgument(DEFAULT_OVERWORLD_AI_UNITS), secondArgument(DEFAULT_OVERWORLD_IN_GAME_DAYS));
+    }
+    else if (scenarioName == "name_index")
+    {
+        scenario = std::make_unique<bench::NameIndexValidationScenario>(firstArgument(DEFAULT_NAME_INDEX_ENTITIES), static_cast<float>(secondArgument(DEFAULT_NAME_INDEX_SECONDS)));
+    }
+    else if (scenarioName == "churn")
+    {
+        scenario = std::make_unique<bench::EntityChurnValidationScenario>(firstArgument(DEFAULT_CHURN_ENTITIES), static_cast<float>(secondArgument(DEFAULT_CHURN_SECONDS)));
+    }
+    else if (scenarioName == "render_stream")
+    {
+        scenario = std::make_unique<bench::RenderStreamValidationScenario>(static_cast<float>(firstArgument(DEFAULT_RENDER_STREAM_SECONDS)));
+    }
+    else if (scenarioName == "uniforms")
+    {
+        scenario = std::make_unique<bench::UniformUploadBenchmarkScenario>(firstArgument(DEFAULT_UNIFORM_DRAWS), secondArgument(DEFAULT_UNIFORM_BONES));
+    }
+    else
+    {
+        Log(LogType::ERROR, "%s", USAGE_STRING.c_str());
+        return EXIT_FAILURE;
+    }
+
+    genesis::math::GetRandomEngine().seed(RANDOM_SEED);
+
+    bench::HeadlessSimulationRunner runner;
+    return runner.RunScenario(*scenario, FIXED_DT) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,133 @@
+///------------------------------------------------------------------------------------------------
+///  BattleBenchmarkScenario.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "BattleBenchmarkScenario.h"
+#include "ScenarioUtils.h"
+#include "../../game/GameContexts.h"
+#include "../../game/battle/systems/BattleAttackTriggerHandlingSystem.h"
+#include "../../game/battle/systems/BattleCameraControllerSystem.h"
+#include "../../game/battle/systems/BattleCollisionHandlingSystem.h"
+#include "../../game/battle/systems/BattleDamageApplicationSystem.h"
+#include "../../game/battle/systems/BattleDestructionTimerProcessingSystem.h"
+#include "../../game/battle/systems/BattleEndHandlingSystem.h"
+#include "../../game/battle/systems/BattleMovementControllerSystem.h"
+#include "../../game/battle/systems/BattleTargetAcquisitionSystem.h"
+#include "../../game/battle/utils/BattleUtils.h"
+#include "../../game/components/UnitStatsComponent.h"
+#include "../../game/scene/systems/SceneUpdaterSystem.h"
+#include "../../game/systems/ModelAnimationTogglingSystem.h"
+#include "../../game/utils/UnitFactoryUtils.h"
+#include "../../game/utils/UnitInfoUtils.h"
+#include "../../game/view/systems/ViewManagementSystem.h"
+
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const StringId BATTLE_LEADER_ENTITY_NAME = StringId("benchmark_battle_leader");
+}
+
+///------------------------------------------------------------------------------------------------
+
+BattleBenchmarkScenario::BattleBenchmarkScenario(const int unitsPerSide, const float simulatedSeconds)
+    : mUnitsPerSide(unitsPerSide)
+    , mSimulatedSeconds(simulatedSeconds)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string BattleBenchmarkScenario::VGetDescription() const
+{
+    return std::to_string(mUnitsPerSide) + " vs " + std::to_string(mUnitsPerSide) + " battle for " + std::to_string(static_cast<int>(mSimulatedSeconds)) + " simulated seconds";
+}
+
+///------------------------------------------------------------------------------------------------
+
+void BattleBenchmarkScenario::VOnSystemsInit()
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    world.AddSystem(std::make_unique<ModelAnimationTogglingSystem>());
+    world.AddSystem(std::make_unique<view::ViewManagementSystem>());
+
+    world.AddSystem(std::make_unique<battle::BattleEndHandlingSystem>(), BATTLE_CONTEXT);
+    world.AddSystem(std::make_unique<battle::BattleCameraControllerSystem>(), BATTLE_CONTEXT);
+    world.AddSystem(std::make_unique<battle::BattleTargetAcquisitionSystem>(), BATTLE_CONTEXT);
+    world.AddSystem(std::make_unique<battle::BattleMovementControllerSystem>(), BATTLE_CONTEXT);
+    world.AddSystem(std::make_unique<battle::BattleCollisionHandlingSystem>(), BATTLE_CONTEXT);
+    world.AddSystem(std::make_unique<battle::BattleAttackTriggerHandlingSystem>(), BATTLE_CONTEXT);
+    world.AddSystem(std::make_unique<battle::BattleDamageApplicationSystem>(), BATTLE_CONTEXT);
+    world.AddSystem(std::make_unique<battle::BattleDestructionTimerProcessingSystem>(), BATTLE_CONTEXT);
+
+    world.AddSystem(std::make_unique<scene::SceneUpdaterSystem>());
+}
+
+///------------------------------------------------------------------------------------------------
+
+void BattleBenchmarkScenario::VOnScenarioInit()
+{
+    auto& world = genesis::ecs::World::GetInstance();
+
+    LoadUnitBaseStats();
+
+    const auto attackingLeaderEntity = CreateUnit(GetRandomUnitType(), GetRandomAvailableUnitName(), BATTLE_LEADER_ENTITY_NAME);
+    const auto defendingLeaderEntity = CreateUnit(GetRandomUnitType(), GetRandomAvailableUnitName(), BATTLE_LEADER_ENTITY_NAME);
+    FillUnitParty(attackingLeaderEntity, mUnitsPerSide);
+    FillUnitParty(defendingLeaderEntity, mUnitsPerSide);
+
+    const auto attackingLeaderUnitName = world.GetComponent<UnitStatsComponent>(attackingLeaderEntity).mStats.mUnitName;
+    const auto defendingLeaderUnitName = world.GetComponent<UnitStatsComponent>(defendingLeaderEntity).mStats.mUnitName;
+    const auto attackingSideParty = world.GetComponent<UnitStatsComponent>(attackingLeaderEntity).mParty;
+    const auto defendingSideParty = world.GetComponent<UnitStatsComponent>(defendingLeaderEntity).mParty;
+
+    // Mirrors the transition from the overworld to a live battle
+    battle::PrepareBattleCamera(false);
+    battle::PopulateBattleEntities(attackingSideParty, defendingSideParty, {}, {}, attackingLeaderEntity, defendingLeaderEntity, genesis::ecs::NULL_ENTITY_ID, genesis::ecs::NULL_ENTITY_ID);
+
+    world.DestroyEntities(world.FindAllEntitiesWithName(BATTLE_LEADER_ENTITY_NAME));
+    world.ChangeContext(BATTLE_CONTEXT);
+    battle::SetBattleState(battle::BattleState::ONGOING);
+    battle::SetBattleLeaderNames(attackingLeaderUnitName, defendingLeaderUnitName, StringId(), StringId(), attackingLeaderUnitName);
+    battle::InitCasualties(attackingLeaderUnitName, defendingLeaderUnitName, StringId(), StringId());
+}
+
+///------------------------------------------------------------------------------------------------
+
+float BattleBenchmarkScenario::VGetSimulatedDuration() const
+{
+    return mSimulatedSeconds;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool BattleBenchmarkScenario::VHasFinishedEarly() const
+{
+    // Once finished, the battle would hand control back to the overworld
+    const auto& world = genesis::ecs::World::GetInstance();
+    return world.GetSingletonComponent<battle::BattleStateSingletonComponent>().mBattleState == battle::BattleState::FINISHED;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool BattleBenchmarkScenario::VVerifyResults() const
+{
+    // Only measured
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,48 @@
+///------------------------------------------------------------------------------------------------
+///  BattleBenchmarkScenario.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef BattleBenchmarkScenario_h
+#define BattleBenchmarkScenario_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "../IBenchmarkScenario.h"
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+/// A battle between two parties of equal size, started the same way the overworld starts a
+/// live battle. The attacking side takes the place of the player's party.
+class BattleBenchmarkScenario final: public IBenchmarkScenario
+{
+public:
+    /// @param[in] unitsPerSide the party size (including the leader) of each side.
+    /// @param[in] simulatedSeconds the simulated time to run the battle for, unless it is decided sooner.
+    BattleBenchmarkScenario(const int unitsPerSide, const float simulatedSeconds);
+
+    std::string VGetDescription() const override;
+    void VOnSystemsInit() override;
+    void VOnScenarioInit() override;
+    float VGetSimulatedDuration() const override;
+    bool VHasFinishedEarly() const override;
+    bool VVerifyResults() const override;
+
+private:
+    const int mUnitsPerSide;
+    const float mSimulatedSeconds;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* BattleBenchmarkScenario_h */
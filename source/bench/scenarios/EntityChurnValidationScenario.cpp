@@ -0,0 +1,232 @@
+///------------------------------------------------------------------------------------------------
+///  EntityChurnValidationScenario.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "EntityChurnValidationScenario.h"
+#include "../../engine/common/components/NameComponent.h"
+#include "../../engine/common/components/TransformComponent.h"
+#include "../../engine/common/utils/Logging.h"
+#include "../../engine/common/utils/MathUtils.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const StringId CHURNED_ENTITY_NAME = StringId("churned_entity");
+
+    static const int MUTATIONS_PER_FRAME = 64;
+
+    enum class ChurnMutation
+    {
+        TOGGLE_TRANSFORM,
+        TOGGLE_NAME,
+        DESTROY_ENTITY,
+        RECORD_ENTITY_DESTRUCTION,
+        COUNT
+    };
+}
+
+///------------------------------------------------------------------------------------------------
+
+EntityChurnValidationScenario::EntityChurnValidationScenario(const int entityCount, const float seconds)
+    : ValidationScenario("reclaimed entities", seconds)
+    , mEntityCount(entityCount)
+    , mHasScannedEntities(false)
+    , mReclaimedEntityCount(0)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string EntityChurnValidationScenario::VGetDescription() const
+{
+    return "Entity churn validation with " + std::to_string(mEntityCount) + " entities for " + std::to_string(static_cast<int>(VGetSimulatedDuration())) + " seconds";
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntityChurnValidationScenario::VOnSystemsInit()
+{
+#if defined(NDEBUG)
+    Log(LogType::ERROR, "Entity churn validation needs the world's debug-only removal scan, and has to be run from a debug build");
+#else
+    AddFrameSystem([this]()
+    {
+        ValidateReclaimedEntities();
+        ApplyRandomMutations();
+    });
+
+    // Scanned in a later system, after its sync point has applied the destructions recorded above
+    AddFrameSystem([this]()
+    {
+        mScannedEntitiesPendingRemoval = genesis::ecs::World::GetInstance().FindEntitiesPendingRemoval();
+        mHasScannedEntities = true;
+    });
+#endif
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntityChurnValidationScenario::VOnScenarioInit()
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    for (auto i = 0; i < mEntityCount; ++i)
+    {
+        const auto entityId = world.CreateEntity();
+        world.AddComponent<genesis::TransformComponent>(entityId, std::make_unique<genesis::TransformComponent>());
+        mTrackedEntities.push_back(entityId);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool EntityChurnValidationScenario::VVerifyResults() const
+{
+    if (mReclaimedEntityCount == 0)
+    {
+        Log(LogType::ERROR, "No entities were reclaimed");
+        return false;
+    }
+
+    Log(LogType::INFO, "%d entities were reclaimed", mReclaimedEntityCount);
+    return ValidationScenario::VVerifyResults();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntityChurnValidationScenario::ValidateReclaimedEntities()
+{
+    if (!mHasScannedEntities)
+    {
+        return;
+    }
+
+    const auto& world = genesis::ecs::World::GetInstance();
+    for (const auto entityId: mScannedEntitiesPendingRemoval)
+    {
+        if (world.HasEntity(entityId))
+        {
+            Log(LogType::ERROR, "Entity %lld was kept at frame %d, the scan found it pending removal", static_cast<long long>(entityId), GetValidatedFrameCount());
+            RecordMismatch();
+        }
+        else
+        {
+            mReclaimedEntityCount++;
+        }
+    }
+
+    std::sort(mScannedEntitiesPendingRemoval.begin(), mScannedEntitiesPendingRemoval.end());
+    for (const auto entityId: mTrackedEntities)
+    {
+        if (!world.HasEntity(entityId) && !std::binary_search(mScannedEntitiesPendingRemoval.cbegin(), mScannedEntitiesPendingRemoval.cend(), entityId))
+        {
+            Log(LogType::ERROR, "Entity %lld was reclaimed at frame %d, the scan did not find it pending removal", static_cast<long long>(entityId), GetValidatedFrameCount());
+            RecordMismatch();
+        }
+    }
+
+    mTrackedEntities.erase(std::remove_if(mTrackedEntities.begin(), mTrackedEntities.end(), [&world](const genesis::ecs::EntityId entityId)
+    {
+        return !world.HasEntity(entityId);
+    }), mTrackedEntities.end());
+
+    RecordValidatedFrame();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntityChurnValidationScenario::ApplyRandomMutations()
+{
+    auto& world = genesis::ecs::World::GetInstance();
+
+    // Every entity is mutated at most once per frame, so that none is touched after its destruction
+    std::vector<std::size_t> mutableEntityIndices(mTrackedEntities.size());
+    std::iota(mutableEntityIndices.begin(), mutableEntityIndices.end(), 0U);
+    const auto takeRandomEntity = [&]()
+    {
+        const auto index = genesis::math::RandomInt(0, static_cast<int>(mutableEntityIndices.size()) - 1);
+        const auto trackedEntityIndex = mutableEntityIndices[index];
+        mutableEntityIndices[index] = mutableEntityIndices.back();
+        mutableEntityIndices.pop_back();
+        return mTrackedEntities[trackedEntityIndex];
+    };
+
+    for (auto i = 0; i < MUTATIONS_PER_FRAME; ++i)
+    {
+        // Entities created without any components are reclaimed as well
+        const auto createdEntityId = world.CreateEntity();
+        if (genesis::math::RandomInt(0, 1) == 0)
+        {
+            world.AddComponent<genesis::TransformComponent>(createdEntityId, std::make_unique<genesis::TransformComponent>());
+        }
+        if (genesis::math::RandomInt(0, 1) == 0)
+        {
+            world.AddComponent<genesis::NameComponent>(createdEntityId, std::make_unique<genesis::NameComponent>(CHURNED_ENTITY_NAME));
+        }
+        mTrackedEntities.push_back(createdEntityId);
+
+        if (mutableEntityIndices.empty())
+        {
+            continue;
+        }
+
+        const auto entityId = takeRandomEntity();
+        const auto mutation = static_cast<ChurnMutation>(genesis::math::RandomInt(0, static_cast<int>(ChurnMutation::COUNT) - 1));
+        switch (mutation)
+        {
+            case ChurnMutation::TOGGLE_TRANSFORM:
+            {
+                if (world.HasComponent<genesis::TransformComponent>(entityId))
+                {
+                    world.RemoveComponent<genesis::TransformComponent>(entityId);
+                }
+                else
+                {
+                    world.AddComponent<genesis::TransformComponent>(entityId, std::make_unique<genesis::TransformComponent>());
+                }
+            } break;
+
+            case ChurnMutation::TOGGLE_NAME:
+            {
+                if (world.HasComponent<genesis::NameComponent>(entityId))
+                {
+                    world.RemoveComponent<genesis::NameComponent>(entityId);
+                }
+                else
+                {
+                    world.AddComponent<genesis::NameComponent>(entityId, std::make_unique<genesis::NameComponent>(CHURNED_ENTITY_NAME));
+                }
+            } break;
+
+            case ChurnMutation::DESTROY_ENTITY:
+            {
+                world.DestroyEntity(entityId);
+            } break;
+
+            case ChurnMutation::RECORD_ENTITY_DESTRUCTION:
+            {
+                world.GetCommandBuffer().DestroyEntity(entityId);
+            } break;
+
+            case ChurnMutation::COUNT: break;
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
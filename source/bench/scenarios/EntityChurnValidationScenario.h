@@ -0,0 +1,58 @@
+///------------------------------------------------------------------------------------------------
+///  EntityChurnValidationScenario.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef EntityChurnValidationScenario_h
+#define EntityChurnValidationScenario_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "ValidationScenario.h"
+#include "../../engine/ECS.h"
+
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+/// Entities that are randomly created, destroyed and given or stripped of components every frame.
+/// The world's full scan of all entity records for the ones pending removal is taken after the
+/// mutations, and compared in the following frame against the entities the world actually reclaimed.
+/// The scan only exists in debug builds, so the scenario fails in release builds.
+class EntityChurnValidationScenario final: public ValidationScenario
+{
+public:
+    /// @param[in] entityCount the number of entities to start with.
+    /// @param[in] seconds the simulated seconds to run the scenario for.
+    EntityChurnValidationScenario(const int entityCount, const float seconds);
+
+    std::string VGetDescription() const override;
+    void VOnSystemsInit() override;
+    void VOnScenarioInit() override;
+    bool VVerifyResults() const override;
+
+private:
+    void ValidateReclaimedEntities();
+    void ApplyRandomMutations();
+
+private:
+    const int mEntityCount;
+    std::vector<genesis::ecs::EntityId> mTrackedEntities;
+    std::vector<genesis::ecs::EntityId> mScannedEntitiesPendingRemoval;
+    bool mHasScannedEntities;
+    int mReclaimedEntityCount;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* EntityChurnValidationScenario_h */
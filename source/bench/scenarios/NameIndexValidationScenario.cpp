@@ -0,0 +1,240 @@
+///------------------------------------------------------------------------------------------------
+///  NameIndexValidationScenario.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "NameIndexValidationScenario.h"
+#include "../../engine/common/components/NameComponent.h"
+#include "../../engine/common/components/TransformComponent.h"
+#include "../../engine/common/utils/Logging.h"
+#include "../../engine/common/utils/MathUtils.h"
+
+#include <algorithm>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    // Few enough for most names to be shared by many entities at once
+    static const int NAME_POOL_SIZE = 16;
+
+    static const int MUTATIONS_PER_FRAME = 32;
+
+    enum class NameMutation
+    {
+        CREATE_NAMED_ENTITY,
+        RECORD_NAMED_ENTITY_CREATION,
+        RENAME_ENTITY,
+        REMOVE_NAME,
+        ADD_NAME,
+        DESTROY_ENTITY,
+        RECORD_ENTITY_DESTRUCTION,
+        COUNT
+    };
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::vector<StringId> CreateNamePool();
+
+///------------------------------------------------------------------------------------------------
+
+NameIndexValidationScenario::NameIndexValidationScenario(const int entityCount, const float seconds)
+    : ValidationScenario("name lookups", seconds)
+    , mEntityCount(entityCount)
+    , mNamePool(CreateNamePool())
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string NameIndexValidationScenario::VGetDescription() const
+{
+    return "Name index validation with " + std::to_string(mEntityCount) + " named entities for " + std::to_string(static_cast<int>(VGetSimulatedDuration())) + " seconds";
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NameIndexValidationScenario::VOnSystemsInit()
+{
+    AddFrameSystem([this]()
+    {
+        // The brute-force scan walks the name columns directly, bypassing the index altogether
+        std::vector<genesis::ecs::EntityId> namedEntities;
+        genesis::ecs::World::GetInstance().ForEachChunk<genesis::NameComponent>([&](const genesis::ecs::EntityId* entityIds, const std::size_t entityCount, const genesis::NameComponent*)
+        {
+            namedEntities.insert(namedEntities.end(), entityIds, entityIds + entityCount);
+        });
+
+        ValidateNameLookups(namedEntities);
+        ApplyRandomMutations(namedEntities);
+    });
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NameIndexValidationScenario::VOnScenarioInit()
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    for (auto i = 0; i < mEntityCount; ++i)
+    {
+        const auto entityId = world.CreateEntity(GetRandomName());
+        world.AddComponent<genesis::TransformComponent>(entityId, std::make_unique<genesis::TransformComponent>());
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NameIndexValidationScenario::ValidateNameLookups(const std::vector<genesis::ecs::EntityId>& namedEntities)
+{
+    const auto& world = genesis::ecs::World::GetInstance();
+    for (const auto& name: mNamePool)
+    {
+        std::vector<genesis::ecs::EntityId> scannedEntities;
+        for (const auto entityId: namedEntities)
+        {
+            if (world.GetComponent<genesis::NameComponent>(entityId).GetName() == name)
+            {
+                scannedEntities.push_back(entityId);
+            }
+        }
+
+        auto indexedEntities = world.FindAllEntitiesWithName(name);
+        std::sort(scannedEntities.begin(), scannedEntities.end());
+        std::sort(indexedEntities.begin(), indexedEntities.end());
+
+        const auto firstIndexedEntity = world.FindEntityWithName(name);
+        const auto isFirstIndexedEntityValid = scannedEntities.empty() ?
+            firstIndexedEntity == genesis::ecs::NULL_ENTITY_ID :
+            std::binary_search(scannedEntities.cbegin(), scannedEntities.cend(), firstIndexedEntity);
+
+        if (indexedEntities != scannedEntities || !isFirstIndexedEntityValid)
+        {
+            Log(LogType::ERROR, "Name lookup of %s at frame %d found %d entities, scan found %d", name.GetString().c_str(), GetValidatedFrameCount(), static_cast<int>(indexedEntities.size()), static_cast<int>(scannedEntities.size()));
+            RecordMismatch();
+        }
+    }
+
+    RecordValidatedFrame();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void NameIndexValidationScenario::ApplyRandomMutations(const std::vector<genesis::ecs::EntityId>& namedEntities)
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    auto& commandBuffer = world.GetCommandBuffer();
+
+    // Every entity is mutated at most once per frame, so that none is touched after its destruction
+    auto mutableEntities = namedEntities;
+    const auto takeRandomEntity = [](std::vector<genesis::ecs::EntityId>& entities)
+    {
+        const auto entityIndex = genesis::math::RandomInt(0, static_cast<int>(entities.size()) - 1);
+        const auto entityId = entities[entityIndex];
+        entities[entityIndex] = entities.back();
+        entities.pop_back();
+        return entityId;
+    };
+
+    // Unnamed entities keep their transform, so that they outlive the removal of their name
+    auto unnamedEntities = std::move(mUnnamedEntities);
+    mUnnamedEntities.clear();
+
+    for (auto i = 0; i < MUTATIONS_PER_FRAME; ++i)
+    {
+        const auto mutation = static_cast<NameMutation>(genesis::math::RandomInt(0, static_cast<int>(NameMutation::COUNT) - 1));
+        switch (mutation)
+        {
+            case NameMutation::CREATE_NAMED_ENTITY:
+            {
+                const auto entityId = world.CreateEntity(GetRandomName());
+                world.AddComponent<genesis::TransformComponent>(entityId, std::make_unique<genesis::TransformComponent>());
+            } break;
+
+            case NameMutation::RECORD_NAMED_ENTITY_CREATION:
+            {
+                const auto entityId = commandBuffer.CreateEntity(GetRandomName());
+                commandBuffer.AddComponent<genesis::TransformComponent>(entityId, std::make_unique<genesis::TransformComponent>());
+            } break;
+
+            case NameMutation::RENAME_ENTITY:
+            {
+                if (!mutableEntities.empty())
+                {
+                    world.ChangeEntityName(takeRandomEntity(mutableEntities), GetRandomName());
+                }
+            } break;
+
+            case NameMutation::REMOVE_NAME:
+            {
+                if (!mutableEntities.empty())
+                {
+                    const auto entityId = takeRandomEntity(mutableEntities);
+                    world.RemoveComponent<genesis::NameComponent>(entityId);
+                    mUnnamedEntities.push_back(entityId);
+                }
+            } break;
+
+            case NameMutation::ADD_NAME:
+            {
+                if (!unnamedEntities.empty())
+                {
+                    world.AddComponent<genesis::NameComponent>(takeRandomEntity(unnamedEntities), std::make_unique<genesis::NameComponent>(GetRandomName()));
+                }
+            } break;
+
+            case NameMutation::DESTROY_ENTITY:
+            {
+                if (!mutableEntities.empty())
+                {
+                    world.DestroyEntity(takeRandomEntity(mutableEntities));
+                }
+            } break;
+
+            case NameMutation::RECORD_ENTITY_DESTRUCTION:
+            {
+                if (!mutableEntities.empty())
+                {
+                    commandBuffer.DestroyEntity(takeRandomEntity(mutableEntities));
+                }
+            } break;
+
+            case NameMutation::COUNT: break;
+        }
+    }
+
+    mUnnamedEntities.insert(mUnnamedEntities.end(), unnamedEntities.cbegin(), unnamedEntities.cend());
+}
+
+///------------------------------------------------------------------------------------------------
+
+const StringId& NameIndexValidationScenario::GetRandomName() const
+{
+    return mNamePool[genesis::math::RandomInt(0, static_cast<int>(mNamePool.size()) - 1)];
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::vector<StringId> CreateNamePool()
+{
+    std::vector<StringId> namePool;
+    for (auto i = 0; i < NAME_POOL_SIZE; ++i)
+    {
+        namePool.push_back(StringId("entity_" + std::to_string(i)));
+    }
+    return namePool;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
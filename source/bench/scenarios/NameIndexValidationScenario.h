@@ -0,0 +1,54 @@
+///------------------------------------------------------------------------------------------------
+///  NameIndexValidationScenario.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef NameIndexValidationScenario_h
+#define NameIndexValidationScenario_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "ValidationScenario.h"
+#include "../../engine/ECS.h"
+
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+/// Named entities that are randomly created, renamed, destroyed and (un)named every frame, with
+/// the world's name lookups compared against a brute-force scan of all named entities in between.
+class NameIndexValidationScenario final: public ValidationScenario
+{
+public:
+    /// @param[in] entityCount the number of named entities to start with.
+    /// @param[in] seconds the simulated seconds to run the scenario for.
+    NameIndexValidationScenario(const int entityCount, const float seconds);
+
+    std::string VGetDescription() const override;
+    void VOnSystemsInit() override;
+    void VOnScenarioInit() override;
+
+private:
+    void ValidateNameLookups(const std::vector<genesis::ecs::EntityId>& namedEntities);
+    void ApplyRandomMutations(const std::vector<genesis::ecs::EntityId>& namedEntities);
+    const StringId& GetRandomName() const;
+
+private:
+    const int mEntityCount;
+    const std::vector<StringId> mNamePool;
+    std::vector<genesis::ecs::EntityId> mUnnamedEntities;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* NameIndexValidationScenario_h */
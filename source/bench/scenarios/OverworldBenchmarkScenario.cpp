@@ -0,0 +1,203 @@
+///------------------------------------------------------------------------------------------------
+///  OverworldBenchmarkScenario.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "OverworldBenchmarkScenario.h"
+#include "ScenarioUtils.h"
+#include "../../game/GameContexts.h"
+#include "../../game/components/CityStateInfoSingletonComponent.h"
+#include "../../game/components/UnitStatsComponent.h"
+#include "../../game/overworld/systems/OverworldBattleProcessingSystem.h"
+#include "../../game/overworld/systems/OverworldCameraControllerSystem.h"
+#include "../../game/overworld/systems/OverworldDayTimeDisplaySystem.h"
+#include "../../game/overworld/systems/OverworldDayTimeUpdaterSystem.h"
+#include "../../game/overworld/systems/OverworldHighlightingSystem.h"
+#include "../../game/overworld/systems/OverworldMapPickingInfoSystem.h"
+#include "../../game/overworld/systems/OverworldMovementControllerSystem.h"
+#include "../../game/overworld/systems/OverworldPlayerTargetInteractionHandlingSystem.h"
+#include "../../game/overworld/systems/OverworldPlayerTargetSelectionSystem.h"
+#include "../../game/overworld/systems/OverworldShipTogglingSystem.h"
+#include "../../game/overworld/ai/systems/OverworldUnitAiUpdaterSystem.h"
+#include "../../game/overworld/utils/OverworldDayTimeUtils.h"
+#include "../../game/overworld/utils/OverworldUtils.h"
+#include "../../game/scene/systems/SceneUpdaterSystem.h"
+#include "../../game/systems/ModelAnimationTogglingSystem.h"
+#include "../../game/utils/CityStateInfoUtils.h"
+#include "../../game/utils/UnitFactoryUtils.h"
+#include "../../game/utils/UnitInfoUtils.h"
+#include "../../game/view/systems/ViewManagementSystem.h"
+#include "../../engine/common/utils/MathUtils.h"
+#include "../../engine/rendering/components/RenderableComponent.h"
+#include "../../engine/rendering/utils/FontUtils.h"
+#include "../../engine/rendering/utils/HeightMapUtils.h"
+#include "../../engine/rendering/utils/LightUtils.h"
+#include "../../engine/rendering/utils/MeshUtils.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const StringId PLAYER_UNIT_NAME = StringId("ALEX");
+
+    static const int MAX_STARTING_PARTY_SIZE = 80;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static genesis::ecs::EntityId CreateOverworldUnit(const StringId& unitTypeName, const StringId& unitName, const StringId& entityName, glm::vec3 position);
+
+///------------------------------------------------------------------------------------------------
+
+OverworldBenchmarkScenario::OverworldBenchmarkScenario(const int aiUnitCount, const int inGameDays)
+    : mAiUnitCount(aiUnitCount)
+    , mInGameDays(inGameDays)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string OverworldBenchmarkScenario::VGetDescription() const
+{
+    return "Overworld with " + std::to_string(mAiUnitCount) + " AI units for " + std::to_string(mInGameDays) + " in-game days";
+}
+
+///------------------------------------------------------------------------------------------------
+
+void OverworldBenchmarkScenario::VOnSystemsInit()
+{
+    // Same as the game's overworld systems. With no input events the picking and
+    // player target selection systems still run, but never select anything.
+    auto& world = genesis::ecs::World::GetInstance();
+    world.AddSystem(std::make_unique<ModelAnimationTogglingSystem>());
+    world.AddSystem(std::make_unique<overworld::OverworldDayTimeUpdaterSystem>(), MAP_CONTEXT);
+    world.AddSystem(std::make_unique<view::ViewManagementSystem>());
+
+    world.AddSystem(std::make_unique<overworld::OverworldHighlightingSystem>(), 0);
+
+    world.AddSystem(std::make_unique<overworld::OverworldDayTimeDisplaySystem>(), MAP_CONTEXT);
+    world.AddSystem(std::make_unique<overworld::ai::OverworldUnitAiUpdaterSystem>(), MAP_CONTEXT);
+    world.AddSystem(std::make_unique<overworld::OverworldMapPickingInfoSystem>(), MAP_CONTEXT);
+    world.AddSystem(std::make_unique<overworld::OverworldPlayerTargetSelectionSystem>(), MAP_CONTEXT);
+    world.AddSystem(std::make_unique<overworld::OverworldMovementControllerSystem>(), MAP_CONTEXT);
+    world.AddSystem(std::make_unique<overworld::OverworldShipTogglingSystem>(), MAP_CONTEXT);
+    world.AddSystem(std::make_unique<overworld::OverworldPlayerTargetInteractionHandlingSystem>(), MAP_CONTEXT);
+    world.AddSystem(std::make_unique<overworld::OverworldBattleProcessingSystem>(), MAP_CONTEXT);
+    world.AddSystem(std::make_unique<overworld::OverworldCameraControllerSystem>(), MAP_CONTEXT);
+
+    world.AddSystem(std::make_unique<scene::SceneUpdaterSystem>());
+}
+
+///------------------------------------------------------------------------------------------------
+
+void OverworldBenchmarkScenario::VOnScenarioInit()
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    world.ChangeContext(MAP_CONTEXT);
+
+    genesis::rendering::LoadFont(StringId("game_font"), 16, 16);
+    LoadUnitBaseStats();
+    LoadCityStateInfo();
+
+    overworld::PopulateOverworldEntities();
+
+    genesis::rendering::AddLightSource(glm::vec3(0.0f, 0.0f, 0.5f), 1.0f);
+
+    // Never loads a saved overworld state, so that every run starts from the same setup
+    auto rulersPool = std::vector<genesis::ecs::EntityId>{ CreateOverworldUnit(StringId("Horse Archer"), PLAYER_UNIT_NAME, overworld::GetPlayerEntityName(), glm::vec3(0.08f, -0.08f, 0.0f)) };
+    for (auto i = 0; i < mAiUnitCount; ++i)
+    {
+        const auto position = glm::vec3(genesis::math::RandomFloat(-0.2f, 0.2f), genesis::math::RandomFloat(-0.2f, 0.2f), 0.0f);
+        rulersPool.push_back(CreateOverworldUnit(GetRandomUnitType(), GetRandomAvailableUnitName(), overworld::GetGenericOverworldUnitEntityName(), position));
+    }
+
+    // The largest parties rule the most renowned city states
+    std::sort(rulersPool.begin(), rulersPool.end(), [&world](const genesis::ecs::EntityId& lhs, const genesis::ecs::EntityId& rhs)
+    {
+        return world.GetComponent<UnitStatsComponent>(lhs).mParty.size() > world.GetComponent<UnitStatsComponent>(rhs).mParty.size();
+    });
+
+    auto& cityStateInfoComponent = world.GetSingletonComponent<CityStateInfoSingletonComponent>();
+    std::vector<StringId> cityStateNames;
+    for (const auto& entry: cityStateInfoComponent.mCityStateNameToInfo)
+    {
+        cityStateNames.push_back(entry.first);
+    }
+
+    std::sort(cityStateNames.begin(), cityStateNames.end(), [](const StringId& lhs, const StringId& rhs)
+    {
+        return GetCityStateInfo(lhs).mRenown > GetCityStateInfo(rhs).mRenown;
+    });
+
+    for (auto i = 0U; i < cityStateNames.size(); ++i)
+    {
+        const auto rulerIndex = i >= rulersPool.size() ? 0 : i;
+        GetCityStateInfo(cityStateNames[i]).mRuler = world.GetComponent<UnitStatsComponent>(rulersPool[rulerIndex]).mStats.mUnitName;
+    }
+
+    overworld::PrepareOverworldCamera();
+}
+
+///------------------------------------------------------------------------------------------------
+
+float OverworldBenchmarkScenario::VGetSimulatedDuration() const
+{
+    return mInGameDays * overworld::GetDayDuration()/overworld::GetDayTimeSpeed();
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool OverworldBenchmarkScenario::VHasFinishedEarly() const
+{
+    // An AI unit engaging the player switches the world over to the battle context
+    return genesis::ecs::World::GetInstance().GetContext() != MAP_CONTEXT;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool OverworldBenchmarkScenario::VVerifyResults() const
+{
+    // Only measured
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+genesis::ecs::EntityId CreateOverworldUnit(const StringId& unitTypeName, const StringId& unitName, const StringId& entityName, glm::vec3 position)
+{
+    auto& world = genesis::ecs::World::GetInstance();
+
+    position.z = genesis::rendering::GetTerrainHeightAtPosition(overworld::GetMapEntity(), position);
+    const auto unitEntity = CreateUnit(unitTypeName, unitName, entityName, position);
+
+    const auto shipEntity = genesis::rendering::LoadAndCreateStaticModelByName("ship", glm::vec3(0.0f), glm::vec3(0.0f), glm::vec3(0.004f), StringId(unitName.GetString() + "_ship"));
+    auto& shipRenderableComponent = world.GetComponent<genesis::rendering::RenderableComponent>(shipEntity);
+    shipRenderableComponent.mIsVisible          = false;
+    shipRenderableComponent.mIsAffectedByLight  = true;
+    shipRenderableComponent.mIsCastingShadows   = true;
+    shipRenderableComponent.mMaterial.mAmbient  = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    shipRenderableComponent.mMaterial.mDiffuse  = glm::vec4(0.2f, 0.2f, 0.2f, 1.0f);
+    shipRenderableComponent.mMaterial.mSpecular = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    shipRenderableComponent.mMaterial.mShininess = 1.0f;
+
+    // The party size includes the leader
+    FillUnitParty(unitEntity, 1 + genesis::math::RandomInt(0, MAX_STARTING_PARTY_SIZE));
+    return unitEntity;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
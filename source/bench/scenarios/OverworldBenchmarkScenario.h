@@ -0,0 +1,48 @@
+///------------------------------------------------------------------------------------------------
+///  OverworldBenchmarkScenario.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef OverworldBenchmarkScenario_h
+#define OverworldBenchmarkScenario_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "../IBenchmarkScenario.h"
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+/// The overworld populated with AI controlled units, set up the same way a new game is. The
+/// player's unit stays idle throughout.
+class OverworldBenchmarkScenario final: public IBenchmarkScenario
+{
+public:
+    /// @param[in] aiUnitCount the number of AI controlled units to populate the overworld with.
+    /// @param[in] inGameDays the in-game days to run the overworld for, unless a battle involving the player starts sooner.
+    OverworldBenchmarkScenario(const int aiUnitCount, const int inGameDays);
+
+    std::string VGetDescription() const override;
+    void VOnSystemsInit() override;
+    void VOnScenarioInit() override;
+    float VGetSimulatedDuration() const override;
+    bool VHasFinishedEarly() const override;
+    bool VVerifyResults() const override;
+
+private:
+    const int mAiUnitCount;
+    const int mInGameDays;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* OverworldBenchmarkScenario_h */
@@ -0,0 +1,197 @@
+///------------------------------------------------------------------------------------------------
+///  RenderStreamValidationScenario.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "RenderStreamValidationScenario.h"
+#include "../../engine/common/utils/Logging.h"
+#include "../../engine/rendering/components/CameraSingletonComponent.h"
+#include "../../engine/rendering/components/LightStoreSingletonComponent.h"
+#include "../../engine/rendering/components/RenderableComponent.h"
+#include "../../engine/rendering/components/RenderingContextSingletonComponent.h"
+#include "../../engine/rendering/opengl/RecordingRenderDevice.h"
+#include "../../engine/rendering/systems/RenderingSystem.h"
+#include "../../engine/rendering/utils/MeshUtils.h"
+
+#include <fstream>
+#include <sstream>
+
+///------------------------------------------------------------------------------------------------
+
+// Set by the build to the checked-in reference directory, so that it is found from any working directory
+#if !defined(BENCHMARK_REFERENCE_ROOT)
+#define BENCHMARK_REFERENCE_ROOT "reference/"
+#endif
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const std::string REFERENCE_COMMAND_STREAM_PATH = std::string(BENCHMARK_REFERENCE_ROOT) + "render_stream.txt";
+
+    // Written to the working directory, to be inspected or copied over the reference when the change is intended
+    static const std::string MISMATCHING_COMMAND_STREAM_PATH = "render_stream_actual.txt";
+
+    static const std::string SCENE_MODEL_NAME = "ship";
+    static const int SCENE_MODEL_COUNT        = 16;
+
+    static const glm::vec3 SCENE_LIGHT_POSITION = glm::vec3(0.0f, 10.0f, -10.0f);
+    static const float SCENE_LIGHT_POWER        = 1.0f;
+
+    static const float MODEL_CAMERA_DISTANCE = 2.0f;
+    static const float MODEL_SPACING         = 0.5f;
+
+    // The first frames also carry the resource creation commands and the state cache's initial binds
+    static const int WARM_UP_FRAME_COUNT = 2;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static std::string ReadReferenceCommandStream();
+static int FindFirstDifferingLine(const std::string& commandStream, const std::string& referenceCommandStream);
+
+///------------------------------------------------------------------------------------------------
+
+RenderStreamValidationScenario::RenderStreamValidationScenario(const float seconds)
+    : ValidationScenario("render command streams", seconds)
+    , mRecordedFrameCount(0)
+    , mHasReportedMismatch(false)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string RenderStreamValidationScenario::VGetDescription() const
+{
+    return "Render stream validation with " + std::to_string(SCENE_MODEL_COUNT) + " models for " + std::to_string(static_cast<int>(VGetSimulatedDuration())) + " seconds";
+}
+
+///------------------------------------------------------------------------------------------------
+
+void RenderStreamValidationScenario::VOnSystemsInit()
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    
+    // The runner's render device only counts commands, whereas these need to be kept around to be compared
+    auto& renderingContextComponent = world.GetSingletonComponent<genesis::rendering::RenderingContextSingletonComponent>();
+    renderingContextComponent.mRenderDevice = std::make_unique<genesis::rendering::RecordingRenderDevice>(true);
+    renderingContextComponent.mGLStateCache.SetRenderDevice(*renderingContextComponent.mRenderDevice);
+    
+    world.AddSystem(std::make_unique<genesis::rendering::RenderingSystem>());
+    AddFrameSystem([this]()
+    {
+        ValidateFrameCommandStream();
+    });
+    
+    mReferenceCommandStream = ReadReferenceCommandStream();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void RenderStreamValidationScenario::VOnScenarioInit()
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    
+    auto& lightStoreComponent = world.GetSingletonComponent<genesis::rendering::LightStoreSingletonComponent>();
+    lightStoreComponent.mLightPositions.push_back(SCENE_LIGHT_POSITION);
+    lightStoreComponent.mLightPowers.push_back(SCENE_LIGHT_POWER);
+    
+    // Every other model is placed behind the camera, so that the culled ones are part of the scene too
+    const auto& cameraComponent = world.GetSingletonComponent<genesis::rendering::CameraSingletonComponent>();
+    for (auto i = 0; i < SCENE_MODEL_COUNT; ++i)
+    {
+        const auto cameraDirection = i % 2 == 0 ? cameraComponent.mFrontVector : -cameraComponent.mFrontVector;
+        const auto modelPosition = cameraComponent.mPosition + cameraDirection * MODEL_CAMERA_DISTANCE + glm::vec3((i/2) * MODEL_SPACING, 0.0f, 0.0f);
+        
+        const auto modelEntity = genesis::rendering::LoadAndCreateStaticModelByName(SCENE_MODEL_NAME, modelPosition);
+        world.GetComponent<genesis::rendering::RenderableComponent>(modelEntity).mIsCastingShadows = true;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void RenderStreamValidationScenario::ValidateFrameCommandStream()
+{
+    auto& renderingContextComponent = genesis::ecs::World::GetInstance().GetSingletonComponent<genesis::rendering::RenderingContextSingletonComponent>();
+    
+    auto* renderDevice = dynamic_cast<genesis::rendering::RecordingRenderDevice*>(renderingContextComponent.mRenderDevice.get());
+    assert(renderDevice != nullptr && "Command streams can only be validated on a recording render device");
+    
+    std::ostringstream commandStream;
+    renderDevice->WriteCommandStream(commandStream);
+    renderDevice->Reset();
+    
+    if (++mRecordedFrameCount <= WARM_UP_FRAME_COUNT)
+    {
+        return;
+    }
+    
+    if (commandStream.str() != mReferenceCommandStream)
+    {
+        // Only the first mismatching frame is reported in detail, the rest are only counted
+        if (!mHasReportedMismatch)
+        {
+            Log(LogType::ERROR, "Command stream of frame %d differs from the reference %s at line %d", mRecordedFrameCount, REFERENCE_COMMAND_STREAM_PATH.c_str(), FindFirstDifferingLine(commandStream.str(), mReferenceCommandStream));
+            
+            std::ofstream mismatchingCommandStreamFile(MISMATCHING_COMMAND_STREAM_PATH);
+            mismatchingCommandStreamFile << commandStream.str();
+            Log(LogType::INFO, "Wrote the mismatching command stream to %s", MISMATCHING_COMMAND_STREAM_PATH.c_str());
+            
+            mHasReportedMismatch = true;
+        }
+        RecordMismatch();
+    }
+    
+    RecordValidatedFrame();
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string ReadReferenceCommandStream()
+{
+    std::ifstream file(REFERENCE_COMMAND_STREAM_PATH);
+    
+    if (!file.good())
+    {
+        Log(LogType::ERROR, "Reference command stream %s could not be found", REFERENCE_COMMAND_STREAM_PATH.c_str());
+        return std::string();
+    }
+    
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+///------------------------------------------------------------------------------------------------
+
+int FindFirstDifferingLine(const std::string& commandStream, const std::string& referenceCommandStream)
+{
+    std::istringstream commandLines(commandStream);
+    std::istringstream referenceCommandLines(referenceCommandStream);
+    
+    std::string commandLine, referenceCommandLine;
+    auto lineNumber = 1;
+    while (true)
+    {
+        const auto hasCommandLine = static_cast<bool>(std::getline(commandLines, commandLine));
+        const auto hasReferenceCommandLine = static_cast<bool>(std::getline(referenceCommandLines, referenceCommandLine));
+        
+        if (hasCommandLine != hasReferenceCommandLine || commandLine != referenceCommandLine || !hasCommandLine)
+        {
+            return lineNumber;
+        }
+        
+        ++lineNumber;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
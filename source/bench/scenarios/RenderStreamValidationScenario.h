@@ -0,0 +1,51 @@
+///------------------------------------------------------------------------------------------------
+///  RenderStreamValidationScenario.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef RenderStreamValidationScenario_h
+#define RenderStreamValidationScenario_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "ValidationScenario.h"
+
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+/// A fixed static scene of shadow casting models, some in front of and some behind the camera, drawn
+/// by the RenderingSystem on a recording render device. Every frame's command stream past the warm-up
+/// is compared against the checked-in reference stream of the scene (bench/reference/render_stream.txt).
+class RenderStreamValidationScenario final: public ValidationScenario
+{
+public:
+    /// @param[in] seconds the simulated seconds to run the scenario for.
+    explicit RenderStreamValidationScenario(const float seconds);
+
+    std::string VGetDescription() const override;
+    void VOnSystemsInit() override;
+    void VOnScenarioInit() override;
+
+private:
+    void ValidateFrameCommandStream();
+
+private:
+    std::string mReferenceCommandStream;
+    int mRecordedFrameCount;
+    bool mHasReportedMismatch;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* RenderStreamValidationScenario_h */
@@ -0,0 +1,61 @@
+///------------------------------------------------------------------------------------------------
+///  ScenarioUtils.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "ScenarioUtils.h"
+#include "../../game/components/UnitStatsComponent.h"
+#include "../../game/utils/UnitInfoUtils.h"
+#include "../../engine/common/utils/MathUtils.h"
+
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const std::vector<StringId> UNIT_TYPES =
+    {
+        StringId("Spearman"),
+        StringId("Elite Spearman"),
+        StringId("Horse Archer"),
+        StringId("Novice Spearman"),
+        StringId("Novice Horse Archer"),
+        StringId("Horse Lancer"),
+        StringId("Barbarian Axeman"),
+        StringId("Bandit Horseman")
+    };
+}
+
+///------------------------------------------------------------------------------------------------
+
+StringId GetRandomUnitType()
+{
+    return UNIT_TYPES.at(genesis::math::RandomInt(0, static_cast<int>(UNIT_TYPES.size()) - 1));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void FillUnitParty(const genesis::ecs::EntityId unitEntity, const int partySize)
+{
+    auto& unitStatsComponent = genesis::ecs::World::GetInstance().GetComponent<UnitStatsComponent>(unitEntity);
+
+    // The leader is already the first member of its party
+    while (static_cast<int>(unitStatsComponent.mParty.size()) < partySize)
+    {
+        unitStatsComponent.mParty.push_back(GetUnitBaseStats(GetRandomUnitType()));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,34 @@
+///------------------------------------------------------------------------------------------------
+///  ScenarioUtils.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef ScenarioUtils_h
+#define ScenarioUtils_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "../../engine/ECS.h"
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+StringId GetRandomUnitType();
+
+///------------------------------------------------------------------------------------------------
+
+void FillUnitParty(const genesis::ecs::EntityId unitEntity, const int partySize);
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* ScenarioUtils_h */
@@ -0,0 +1,285 @@
+///------------------------------------------------------------------------------------------------
+///  UniformUploadBenchmarkScenario.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "UniformUploadBenchmarkScenario.h"
+#include "../../engine/common/utils/Logging.h"
+#include "../../engine/debug/Profiler.h"
+#include "../../engine/rendering/components/RenderableComponent.h"
+#include "../../engine/rendering/components/RenderingContextSingletonComponent.h"
+#include "../../engine/rendering/opengl/RecordingRenderDevice.h"
+
+#include <algorithm>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const StringId CUSTOM_COLOR_UNIFORM_NAME   = StringId("custom_color");
+    static const StringId DAMAGED_EFFECT_UNIFORM_NAME = StringId("damaged_effect");
+    static const StringId BONES_UNIFORM_NAME          = StringId("bones");
+
+    static const float SIMULATED_SECONDS = 5.0f;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static genesis::resources::ShaderResource CreateBenchmarkShader(const int boneCount);
+static LegacyUniformLocations CreateLegacyUniformLocations(const int boneCount);
+
+template<class ValueType, class UploadFunctionType>
+static bool UploadLegacyUniform(const LegacyUniformLocations& uniformLocations, const StringId& uniformName, const ValueType& value, UploadFunctionType uploadFunction);
+
+template<class ValueType, class UploadFunctionType>
+static bool UploadLegacyUniformArray(const LegacyUniformLocations& uniformLocations, const StringId& uniformName, const std::vector<ValueType>& values, UploadFunctionType uploadFunction);
+
+///------------------------------------------------------------------------------------------------
+
+UniformUploadBenchmarkScenario::UniformUploadBenchmarkScenario(const int drawCount, const int boneCount)
+    : ValidationScenario("uploaded uniform bytes", SIMULATED_SECONDS)
+    , mDrawCount(drawCount)
+    , mBoneCount(boneCount)
+    , mShader(CreateBenchmarkShader(boneCount))
+    , mLegacyUniformLocations(CreateLegacyUniformLocations(boneCount))
+    , mUploadCount(0)
+    , mSlotUploadNanos(0)
+    , mNameUploadNanos(0)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string UniformUploadBenchmarkScenario::VGetDescription() const
+{
+    return "Uniform upload benchmark with " + std::to_string(mDrawCount) + " draws of " + std::to_string(mBoneCount) + " bones";
+}
+
+///------------------------------------------------------------------------------------------------
+
+void UniformUploadBenchmarkScenario::VOnSystemsInit()
+{
+    AddFrameSystem([this]()
+    {
+        UploadAndValidateUniforms();
+    });
+}
+
+///------------------------------------------------------------------------------------------------
+
+void UniformUploadBenchmarkScenario::VOnScenarioInit()
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    
+    const auto customColorSlot   = genesis::rendering::GetUniformSlot(CUSTOM_COLOR_UNIFORM_NAME);
+    const auto damagedEffectSlot = genesis::rendering::GetUniformSlot(DAMAGED_EFFECT_UNIFORM_NAME);
+    const auto bonesSlot         = genesis::rendering::GetUniformSlot(BONES_UNIFORM_NAME);
+    
+    // Both paths are given the same values, for each to upload its own copy of them
+    for (auto i = 0; i < mDrawCount; ++i)
+    {
+        const auto customColor   = glm::vec4(genesis::math::RandomFloat(), genesis::math::RandomFloat(), genesis::math::RandomFloat(), 1.0f);
+        const auto damagedEffect = i % 2 == 0;
+        const auto bones         = std::vector<glm::mat4>(mBoneCount, glm::mat4(1.0f));
+        
+        auto renderableComponent = std::make_unique<genesis::rendering::RenderableComponent>();
+        renderableComponent->mShaderUniforms.SetFloatVec4(customColorSlot, customColor);
+        renderableComponent->mShaderUniforms.SetBool(damagedEffectSlot, damagedEffect);
+        
+        LegacyShaderUniforms legacyShaderUniforms;
+        legacyShaderUniforms.mShaderFloatVec4Uniforms[CUSTOM_COLOR_UNIFORM_NAME] = customColor;
+        legacyShaderUniforms.mShaderBoolUniforms[DAMAGED_EFFECT_UNIFORM_NAME] = damagedEffect;
+        
+        if (mBoneCount > 0)
+        {
+            renderableComponent->mShaderUniforms.SetMatrixArray(bonesSlot, bones);
+            legacyShaderUniforms.mShaderMatrixArrayUniforms[BONES_UNIFORM_NAME] = bones;
+        }
+        
+        const auto entityId = world.CreateEntity();
+        world.AddComponent<genesis::rendering::RenderableComponent>(entityId, std::move(renderableComponent));
+        mLegacyShaderUniforms.push_back(std::move(legacyShaderUniforms));
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool UniformUploadBenchmarkScenario::VVerifyResults() const
+{
+    const auto getMeanUploadNanos = [this](const long long uploadNanos)
+    {
+        return mUploadCount == 0 ? 0.0 : static_cast<double>(uploadNanos)/mUploadCount;
+    };
+    
+    Log(LogType::INFO, "Uploaded %lld uniform blocks per path, %.1f ns per draw by slot, %.1f ns per draw by name", mUploadCount, getMeanUploadNanos(mSlotUploadNanos), getMeanUploadNanos(mNameUploadNanos));
+    return ValidationScenario::VVerifyResults();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void UniformUploadBenchmarkScenario::UploadAndValidateUniforms()
+{
+    auto& renderingContextComponent = genesis::ecs::World::GetInstance().GetSingletonComponent<genesis::rendering::RenderingContextSingletonComponent>();
+    
+    auto* renderDevice = dynamic_cast<genesis::rendering::RecordingRenderDevice*>(renderingContextComponent.mRenderDevice.get());
+    assert(renderDevice != nullptr && "Uploaded uniform bytes can only be counted on a recording render device");
+    
+    std::size_t slotUploadedByteCount = 0;
+    const auto uploadBySlot = [&]()
+    {
+        const auto uploadedByteCount = renderDevice->GetUploadedByteCount();
+        const auto uploadStartNanos = genesis::debug::Profiler::GetTimestampNanos();
+        mUploadCount += UploadUniformsBySlot(*renderDevice);
+        mSlotUploadNanos += genesis::debug::Profiler::GetTimestampNanos() - uploadStartNanos;
+        slotUploadedByteCount = renderDevice->GetUploadedByteCount() - uploadedByteCount;
+    };
+    
+    std::size_t nameUploadedByteCount = 0;
+    const auto uploadByName = [&]()
+    {
+        const auto uploadedByteCount = renderDevice->GetUploadedByteCount();
+        const auto uploadStartNanos = genesis::debug::Profiler::GetTimestampNanos();
+        UploadUniformsByName(*renderDevice);
+        mNameUploadNanos += genesis::debug::Profiler::GetTimestampNanos() - uploadStartNanos;
+        nameUploadedByteCount = renderDevice->GetUploadedByteCount() - uploadedByteCount;
+    };
+    
+    // The paths take turns going first, so that neither one always runs on caches warmed up by the other
+    if (GetValidatedFrameCount() % 2 == 0)
+    {
+        uploadBySlot();
+        uploadByName();
+    }
+    else
+    {
+        uploadByName();
+        uploadBySlot();
+    }
+    
+    if (slotUploadedByteCount != nameUploadedByteCount)
+    {
+        Log(LogType::ERROR, "Uniforms uploaded by slot at frame %d amount to %d bytes, by name to %d bytes", GetValidatedFrameCount(), static_cast<int>(slotUploadedByteCount), static_cast<int>(nameUploadedByteCount));
+        RecordMismatch();
+    }
+    
+    RecordValidatedFrame();
+}
+
+///------------------------------------------------------------------------------------------------
+
+long long UniformUploadBenchmarkScenario::UploadUniformsBySlot(genesis::rendering::IRenderDevice& renderDevice) const
+{
+    // The same upload the RenderingSystem performs before each draw call
+    long long uploadCount = 0;
+    genesis::ecs::World::GetInstance().ForEachChunk<genesis::rendering::RenderableComponent>([&](const genesis::ecs::EntityId*, const std::size_t entityCount, const genesis::rendering::RenderableComponent* renderableComponents)
+    {
+        for (auto i = 0U; i < entityCount; ++i)
+        {
+            mShader.SetUniforms(renderDevice, renderableComponents[i].mShaderUniforms);
+        }
+        uploadCount += entityCount;
+    });
+    return uploadCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void UniformUploadBenchmarkScenario::UploadUniformsByName(genesis::rendering::IRenderDevice& renderDevice) const
+{
+    const auto uploadMatrix = [&renderDevice](const genesis::resources::GLint location, const glm::mat4& value) { renderDevice.VSetUniformMatrix4(location, 1, &value[0][0]); };
+    const auto uploadFloatVec4 = [&renderDevice](const genesis::resources::GLint location, const glm::vec4& value) { renderDevice.VSetUniformVec4(location, 1, &value.x); };
+    const auto uploadFloatVec3 = [&renderDevice](const genesis::resources::GLint location, const glm::vec3& value) { renderDevice.VSetUniformVec3(location, 1, &value.x); };
+    const auto uploadFloat = [&renderDevice](const genesis::resources::GLint location, const float value) { renderDevice.VSetUniformFloat(location, 1, &value); };
+    const auto uploadInt = [&renderDevice](const genesis::resources::GLint location, const int value) { renderDevice.VSetUniformInt(location, 1, &value); };
+    const auto uploadBool = [&renderDevice](const genesis::resources::GLint location, const bool value) { const auto intValue = value ? 1 : 0; renderDevice.VSetUniformInt(location, 1, &intValue); };
+    
+    // Every map is walked before each draw call, in the order the RenderingSystem used to
+    for (const auto& shaderUniforms: mLegacyShaderUniforms)
+    {
+        for (const auto& uniformEntry: shaderUniforms.mShaderMatrixUniforms) UploadLegacyUniform(mLegacyUniformLocations, uniformEntry.first, uniformEntry.second, uploadMatrix);
+        for (const auto& uniformEntry: shaderUniforms.mShaderMatrixArrayUniforms) UploadLegacyUniformArray(mLegacyUniformLocations, uniformEntry.first, uniformEntry.second, uploadMatrix);
+        for (const auto& uniformEntry: shaderUniforms.mShaderFloatVec4ArrayUniforms) UploadLegacyUniformArray(mLegacyUniformLocations, uniformEntry.first, uniformEntry.second, uploadFloatVec4);
+        for (const auto& uniformEntry: shaderUniforms.mShaderFloatVec3ArrayUniforms) UploadLegacyUniformArray(mLegacyUniformLocations, uniformEntry.first, uniformEntry.second, uploadFloatVec3);
+        for (const auto& uniformEntry: shaderUniforms.mShaderFloatVec4Uniforms) UploadLegacyUniform(mLegacyUniformLocations, uniformEntry.first, uniformEntry.second, uploadFloatVec4);
+        for (const auto& uniformEntry: shaderUniforms.mShaderFloatVec3Uniforms) UploadLegacyUniform(mLegacyUniformLocations, uniformEntry.first, uniformEntry.second, uploadFloatVec3);
+        for (const auto& uniformEntry: shaderUniforms.mShaderFloatUniforms) UploadLegacyUniform(mLegacyUniformLocations, uniformEntry.first, uniformEntry.second, uploadFloat);
+        for (const auto& uniformEntry: shaderUniforms.mShaderIntUniforms) UploadLegacyUniform(mLegacyUniformLocations, uniformEntry.first, uniformEntry.second, uploadInt);
+        for (const auto& uniformEntry: shaderUniforms.mShaderBoolUniforms) UploadLegacyUniform(mLegacyUniformLocations, uniformEntry.first, uniformEntry.second, uploadBool);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+genesis::resources::ShaderResource CreateBenchmarkShader(const int boneCount)
+{
+    const auto bonesSlot         = genesis::rendering::GetUniformSlot(BONES_UNIFORM_NAME);
+    const auto customColorSlot   = genesis::rendering::GetUniformSlot(CUSTOM_COLOR_UNIFORM_NAME);
+    const auto damagedEffectSlot = genesis::rendering::GetUniformSlot(DAMAGED_EFFECT_UNIFORM_NAME);
+    
+    // Locations as a linked shader would hand them out, with the bones array taking up one per element
+    std::vector<genesis::resources::GLint> uniformSlotLocations(std::max({ bonesSlot, customColorSlot, damagedEffectSlot }) + 1, -1);
+    uniformSlotLocations[bonesSlot]         = 0;
+    uniformSlotLocations[customColorSlot]   = boneCount;
+    uniformSlotLocations[damagedEffectSlot] = boneCount + 1;
+    
+    return genesis::resources::ShaderResource(uniformSlotLocations, 0);
+}
+
+///------------------------------------------------------------------------------------------------
+
+LegacyUniformLocations CreateLegacyUniformLocations(const int boneCount)
+{
+    // The same locations as the benchmark shader's, under the names they were looked up by before
+    LegacyUniformLocations uniformLocations;
+    for (auto i = 0; i < boneCount; ++i)
+    {
+        uniformLocations[StringId(BONES_UNIFORM_NAME.GetString() + "[" + std::to_string(i) + "]")] = i;
+    }
+    uniformLocations[CUSTOM_COLOR_UNIFORM_NAME]   = boneCount;
+    uniformLocations[DAMAGED_EFFECT_UNIFORM_NAME] = boneCount + 1;
+    
+    return uniformLocations;
+}
+
+///------------------------------------------------------------------------------------------------
+
+template<class ValueType, class UploadFunctionType>
+bool UploadLegacyUniform(const LegacyUniformLocations& uniformLocations, const StringId& uniformName, const ValueType& value, UploadFunctionType uploadFunction)
+{
+    if (uniformLocations.count(uniformName) > 0)
+    {
+        uploadFunction(uniformLocations.at(uniformName), value);
+        return true;
+    }
+    return false;
+}
+
+///------------------------------------------------------------------------------------------------
+
+template<class ValueType, class UploadFunctionType>
+bool UploadLegacyUniformArray(const LegacyUniformLocations& uniformLocations, const StringId& uniformName, const std::vector<ValueType>& values, UploadFunctionType uploadFunction)
+{
+    // Every element is looked up under its own subscripted name, built anew for every upload
+    for (auto i = 0U; i < values.size(); ++i)
+    {
+        if (!UploadLegacyUniform(uniformLocations, StringId(uniformName.GetString() + "[" + std::to_string(i) + "]"), values[i], uploadFunction))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,95 @@
+///------------------------------------------------------------------------------------------------
+///  UniformUploadBenchmarkScenario.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef UniformUploadBenchmarkScenario_h
+#define UniformUploadBenchmarkScenario_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "ValidationScenario.h"
+#include "../../engine/common/utils/MathUtils.h"
+#include "../../engine/common/utils/StringUtils.h"
+#include "../../engine/resources/ShaderResource.h"
+
+#include <tsl/robin_map.h>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+    namespace rendering
+    {
+        class IRenderDevice;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+/// The name keyed uniform maps renderables carried before uniforms were resolved to slots.
+struct LegacyShaderUniforms
+{
+    tsl::robin_map<StringId, std::vector<glm::mat4>, StringIdHasher> mShaderMatrixArrayUniforms;
+    tsl::robin_map<StringId, std::vector<glm::vec4>, StringIdHasher> mShaderFloatVec4ArrayUniforms;
+    tsl::robin_map<StringId, std::vector<glm::vec3>, StringIdHasher> mShaderFloatVec3ArrayUniforms;
+    tsl::robin_map<StringId, glm::mat4, StringIdHasher> mShaderMatrixUniforms;
+    tsl::robin_map<StringId, glm::vec4, StringIdHasher> mShaderFloatVec4Uniforms;
+    tsl::robin_map<StringId, glm::vec3, StringIdHasher> mShaderFloatVec3Uniforms;
+    tsl::robin_map<StringId, float, StringIdHasher> mShaderFloatUniforms;
+    tsl::robin_map<StringId, int, StringIdHasher> mShaderIntUniforms;
+    tsl::robin_map<StringId, bool, StringIdHasher> mShaderBoolUniforms;
+};
+
+///------------------------------------------------------------------------------------------------
+/// The uniform name to location map shaders looked uniforms up in before uniform slots, holding
+/// every array element under its own subscripted name.
+using LegacyUniformLocations = tsl::robin_map<StringId, genesis::resources::GLint, StringIdHasher>;
+
+///------------------------------------------------------------------------------------------------
+/// Renderables carrying the game's per draw uniforms, with every one of their uniform blocks
+/// uploaded to a shader each frame, once through the shader's uniform slots and once through
+/// the name keyed maps they were uploaded from before. Both paths are timed and reported, and
+/// are validated to upload the same number of bytes every frame.
+class UniformUploadBenchmarkScenario final: public ValidationScenario
+{
+public:
+    /// @param[in] drawCount the number of renderables whose uniforms are uploaded each frame.
+    /// @param[in] boneCount the number of bone matrices each renderable carries.
+    UniformUploadBenchmarkScenario(const int drawCount, const int boneCount);
+
+    std::string VGetDescription() const override;
+    void VOnSystemsInit() override;
+    void VOnScenarioInit() override;
+    bool VVerifyResults() const override;
+
+private:
+    void UploadAndValidateUniforms();
+    long long UploadUniformsBySlot(genesis::rendering::IRenderDevice& renderDevice) const;
+    void UploadUniformsByName(genesis::rendering::IRenderDevice& renderDevice) const;
+
+private:
+    const int mDrawCount;
+    const int mBoneCount;
+    const genesis::resources::ShaderResource mShader;
+    const LegacyUniformLocations mLegacyUniformLocations;
+    std::vector<LegacyShaderUniforms> mLegacyShaderUniforms;
+    long long mUploadCount;
+    long long mSlotUploadNanos;
+    long long mNameUploadNanos;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* UniformUploadBenchmarkScenario_h */
@@ -0,0 +1,88 @@
+///------------------------------------------------------------------------------------------------
+///  ValidationScenario.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "ValidationScenario.h"
+#include "../systems/ScenarioFrameSystem.h"
+#include "../../engine/ECS.h"
+#include "../../engine/common/utils/Logging.h"
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+
+ValidationScenario::ValidationScenario(const std::string& validatedSubject, const float seconds)
+    : mValidatedSubject(validatedSubject)
+    , mSeconds(seconds)
+    , mValidatedFrameCount(0)
+    , mMismatchCount(0)
+{
+}
+
+///------------------------------------------------------------------------------------------------
+
+float ValidationScenario::VGetSimulatedDuration() const
+{
+    return mSeconds;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool ValidationScenario::VHasFinishedEarly() const
+{
+    return false;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool ValidationScenario::VVerifyResults() const
+{
+    if (mValidatedFrameCount == 0)
+    {
+        Log(LogType::ERROR, "The %s were never validated", mValidatedSubject.c_str());
+        return false;
+    }
+
+    Log(LogType::INFO, "Validated the %s in %d frames with %d mismatches", mValidatedSubject.c_str(), mValidatedFrameCount, mMismatchCount);
+    return mMismatchCount == 0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ValidationScenario::AddFrameSystem(std::function<void()> frameCallback) const
+{
+    genesis::ecs::World::GetInstance().AddSystem(std::make_unique<ScenarioFrameSystem>(std::move(frameCallback)));
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ValidationScenario::RecordValidatedFrame()
+{
+    mValidatedFrameCount++;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ValidationScenario::RecordMismatch()
+{
+    mMismatchCount++;
+}
+
+///------------------------------------------------------------------------------------------------
+
+int ValidationScenario::GetValidatedFrameCount() const
+{
+    return mValidatedFrameCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
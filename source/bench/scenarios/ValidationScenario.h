@@ -0,0 +1,66 @@
+///------------------------------------------------------------------------------------------------
+///  ValidationScenario.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef ValidationScenario_h
+#define ValidationScenario_h
+
+///------------------------------------------------------------------------------------------------
+
+#include "../IBenchmarkScenario.h"
+
+#include <functional>
+#include <string>
+
+///------------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///------------------------------------------------------------------------------------------------
+/// Base of the scenarios that check engine behaviour frame by frame against an independent oracle.
+/// Subclasses drive and inspect the world through frame callbacks, and record every validated
+/// frame and every disagreement with the oracle here, for the results to be reported uniformly.
+class ValidationScenario: public IBenchmarkScenario
+{
+public:
+    float VGetSimulatedDuration() const override;
+    bool VHasFinishedEarly() const override;
+    bool VVerifyResults() const override;
+
+protected:
+    /// @param[in] validatedSubject what the scenario validates, as it should read in the results (e.g. "name lookups").
+    /// @param[in] seconds the simulated seconds to run the scenario for.
+    ValidationScenario(const std::string& validatedSubject, const float seconds);
+
+    /// Adds a system calling back into the scenario every frame. Callbacks run in the
+    /// order they were added in, each one after the sync point preceding its system.
+    /// @param[in] frameCallback the scenario step to run every frame.
+    void AddFrameSystem(std::function<void()> frameCallback) const;
+
+    /// Marks the end of a frame that was compared against the oracle.
+    void RecordValidatedFrame();
+
+    /// Marks a disagreement with the oracle in the current frame.
+    void RecordMismatch();
+
+    /// @returns the number of frames compared against the oracle so far.
+    int GetValidatedFrameCount() const;
+
+private:
+    const std::string mValidatedSubject;
+    const float mSeconds;
+    int mValidatedFrameCount;
+    int mMismatchCount;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* ValidationScenario_h */
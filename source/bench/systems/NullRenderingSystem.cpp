@@ -0,0 +1,47 @@
+///------------------------------------------------------------------------------------------------
+///  NullRenderingSystem.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "NullRenderingSystem.h"
+#include "../../engine/common/components/TransformComponent.h"
+#include "../../engine/rendering/components/CameraSingletonComponent.h"
+#include "../../engine/rendering/components/LightStoreSingletonComponent.h"
+#include "../../engine/rendering/components/RenderableComponent.h"
+
+///-----------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///-----------------------------------------------------------------------------------------------
+
+NullRenderingSystem::NullRenderingSystem()
+    : BaseSystem()
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    
+    // Scenarios that render through the RenderingSystem have these set up by it already
+    if (!world.HasSingletonComponent<genesis::rendering::CameraSingletonComponent>())
+    {
+        world.SetSingletonComponent<genesis::rendering::CameraSingletonComponent>(std::make_unique<genesis::rendering::CameraSingletonComponent>());
+    }
+    if (!world.HasSingletonComponent<genesis::rendering::LightStoreSingletonComponent>())
+    {
+        world.SetSingletonComponent<genesis::rendering::LightStoreSingletonComponent>(std::make_unique<genesis::rendering::LightStoreSingletonComponent>());
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void NullRenderingSystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>&) const
+{
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
@@ -0,0 +1,49 @@
+///------------------------------------------------------------------------------------------------
+///  NullRenderingSystem.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef NullRenderingSystem_h
+#define NullRenderingSystem_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../engine/ECS.h"
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+    class TransformComponent;
+
+    namespace rendering
+    {
+        class RenderableComponent;
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///-----------------------------------------------------------------------------------------------
+/// Stands in for the RenderingSystem in headless runs. Owns the same rendering singleton
+/// components the game systems depend on, and tracks the same entities, but draws nothing.
+class NullRenderingSystem final: public genesis::ecs::BaseSystem<genesis::TransformComponent, genesis::rendering::RenderableComponent>
+{
+public:
+    NullRenderingSystem();
+
+    void VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const override;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* NullRenderingSystem_h */
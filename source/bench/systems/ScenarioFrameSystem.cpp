@@ -0,0 +1,34 @@
+///------------------------------------------------------------------------------------------------
+///  ScenarioFrameSystem.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "ScenarioFrameSystem.h"
+
+///-----------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///-----------------------------------------------------------------------------------------------
+
+ScenarioFrameSystem::ScenarioFrameSystem(std::function<void()> frameCallback)
+    : BaseSystem()
+    , mFrameCallback(std::move(frameCallback))
+{
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ScenarioFrameSystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>&) const
+{
+    mFrameCallback();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
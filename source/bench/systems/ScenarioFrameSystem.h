@@ -0,0 +1,43 @@
+///------------------------------------------------------------------------------------------------
+///  ScenarioFrameSystem.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef ScenarioFrameSystem_h
+#define ScenarioFrameSystem_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../engine/ECS.h"
+
+#include <functional>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace bench
+{
+
+///-----------------------------------------------------------------------------------------------
+/// Calls back into a scenario once per frame, at the point of the system order it was added at.
+/// Holds no state of its own, so that everything a scenario tracks across frames stays in the scenario.
+class ScenarioFrameSystem final: public genesis::ecs::BaseSystem<genesis::ecs::NullComponent>
+{
+public:
+    /// @param[in] frameCallback the scenario step to run every frame.
+    explicit ScenarioFrameSystem(std::function<void()> frameCallback);
+
+    void VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const override;
+
+private:
+    const std::function<void()> mFrameCallback;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* ScenarioFrameSystem_h */
@@ -7,9 +7,10 @@
 
 #include "ECS.h"
 #include "common/components/NameComponent.h"
+#include "debug/Profiler.h"
+#include "jobs/JobSystem.h"
 
 #include <chrono>
-#include <thread>
 #include <typeinfo>
 
 ///------------------------------------------------------------------------------------------------
@@ -24,67 +25,247 @@ namespace ecs
 
 ///------------------------------------------------------------------------------------------------
 
-class SystemUpdateWorker
+static constexpr long long NANOS_PER_MICRO = 1000LL;
+
+///------------------------------------------------------------------------------------------------
+
+#if !defined(NDEBUG)
+/// The system currently being updated on this thread, if any
+static thread_local const ISystem* sUpdatingSystem = nullptr;
+#endif
+
+/// The world's command buffer for this thread, created the first time it is requested
+static thread_local EntityCommandBuffer* sThreadCommandBuffer = nullptr;
+
+///------------------------------------------------------------------------------------------------
+
+static std::size_t AlignToChunkBoundary(const std::size_t offset)
+{
+    static constexpr auto CHUNK_ALIGNMENT = alignof(std::max_align_t);
+    return (offset + CHUNK_ALIGNMENT - 1) & ~(CHUNK_ALIGNMENT - 1);
+}
+
+///------------------------------------------------------------------------------------------------
+
+static StringId GetSystemNameFromTypeIdString(const std::string& typeIdString)
 {
-public:
-    void StartWorker(const std::function<void()>& onCompleteCallback)
+    std::string unsymbolifiedName;
+    for (int i = typeIdString.size() - 1; i >= 0; i--)
     {
-        mOnCompleteCallback = onCompleteCallback;
-        mThread = std::thread([&]
+        if (std::isdigit(typeIdString[i])) break;
+        unsymbolifiedName = typeIdString[i] + unsymbolifiedName;
+    }
+    
+    const auto& systemNameSplitByWhiteSpace = StringSplit(unsymbolifiedName, ' ');
+    const auto& systemNameSplitByColumn = StringSplit(systemNameSplitByWhiteSpace[systemNameSplitByWhiteSpace.size() - 1], ':');
+    return StringId(systemNameSplitByColumn[systemNameSplitByColumn.size() - 1]);
+}
+
+///------------------------------------------------------------------------------------------------
+
+ArchetypeChunk::ArchetypeChunk(const Archetype& archetype)
+    : mArchetype(archetype)
+    , mData(new unsigned char[archetype.mChunkSizeInBytes])
+{
+    mEntities = reinterpret_cast<EntityId*>(mData.get());
+    for (const auto columnOffset: archetype.mColumnOffsets)
+    {
+        mColumnData.push_back(mData.get() + columnOffset);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+Archetype::Archetype(const ComponentMask& componentMask, const std::array<ComponentTypeInfo, MAX_COMPONENTS>& componentTypeInfos)
+    : mComponentMask(componentMask)
+{
+    mColumnIndices.fill(-1);
+    
+    auto rowSizeInBytes = sizeof(EntityId);
+    for (auto componentTypeId = 0; componentTypeId < MAX_COMPONENTS; ++componentTypeId)
+    {
+        if (componentMask.test(componentTypeId))
+        {
+            assert(componentTypeInfos[componentTypeId].mSize != 0 && "Component type has not been registered");
+            
+            mColumnIndices[componentTypeId] = static_cast<int>(mColumnTypeInfos.size());
+            mColumnTypeInfos.push_back(&componentTypeInfos[componentTypeId]);
+            rowSizeInBytes += componentTypeInfos[componentTypeId].mSize;
+        }
+    }
+    
+    mChunkCapacity = std::max(static_cast<std::size_t>(1), ARCHETYPE_CHUNK_SIZE_IN_BYTES/rowSizeInBytes);
+    
+    // Entity ids first, followed by one array per component type
+    auto currentOffset = AlignToChunkBoundary(mChunkCapacity * sizeof(EntityId));
+    for (const auto* componentTypeInfo: mColumnTypeInfos)
+    {
+        mColumnOffsets.push_back(currentOffset);
+        currentOffset = AlignToChunkBoundary(currentOffset + mChunkCapacity * componentTypeInfo->mSize);
+    }
+    
+    mChunkSizeInBytes = currentOffset;
+}
+
+///------------------------------------------------------------------------------------------------
+
+Archetype::~Archetype()
+{
+    for (auto& chunk: mChunks)
+    {
+        for (auto columnIndex = 0U; columnIndex < mColumnTypeInfos.size(); ++columnIndex)
         {
-            while(true)
+            const auto& componentTypeInfo = *mColumnTypeInfos[columnIndex];
+            for (auto row = 0U; row < chunk->mEntityCount; ++row)
             {
-                if (mCurrentProcessingVec.size() > 0 && mHasAssignedWorkParams)
-                {
-                    mSystem->VUpdate(mCurrentDt, mCurrentProcessingVec);
-                    mCurrentProcessingVec.clear();
-                    mHasAssignedWorkParams = false;
-                    mOnCompleteCallback();
-                }
+                componentTypeInfo.mDestruct(chunk->mColumnData[columnIndex] + row * componentTypeInfo.mSize);
             }
-        });
-        mThread.detach();
+        }
     }
+}
 
-    void AssignWorkParams
-    (
-        const float dt, 
-        const std::vector<EntityId> entityVec,
-        ISystem* system
-    )
+///------------------------------------------------------------------------------------------------
+
+std::pair<ArchetypeChunk*, std::size_t> Archetype::AllocateRow(const EntityId entityId)
+{
+    if (mChunks.empty() || mChunks.back()->mEntityCount == mChunkCapacity)
     {
-        mCurrentProcessingVec = std::move(entityVec);
-        mCurrentDt = dt;
-        mSystem = system;
-        mHasAssignedWorkParams = true;
+        mChunks.push_back(std::make_unique<ArchetypeChunk>(*this));
     }
     
-private:
-    std::vector<genesis::ecs::EntityId> mCurrentProcessingVec;
-    std::thread mThread;
-    std::function<void()> mOnCompleteCallback;
-    ISystem* mSystem;
-    float mCurrentDt;
-    bool mHasAssignedWorkParams = false;
-};
+    auto& chunk = *mChunks.back();
+    const auto row = chunk.mEntityCount++;
+    chunk.mEntities[row] = entityId;
+    
+    return std::make_pair(&chunk, row);
+}
 
 ///------------------------------------------------------------------------------------------------
 
-#if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)
-static StringId GetSystemNameFromTypeIdString(const std::string& typeIdString)
+EntityId Archetype::RemoveRow(ArchetypeChunk& chunk, const std::size_t row)
 {
-    std::string unsymbolifiedName;
-    for (int i = typeIdString.size() - 1; i >= 0; i--)
+    auto& lastChunk = *mChunks.back();
+    const auto lastRow = lastChunk.mEntityCount - 1;
+    const auto isLastRow = &chunk == &lastChunk && row == lastRow;
+    
+    for (auto columnIndex = 0U; columnIndex < mColumnTypeInfos.size(); ++columnIndex)
     {
-        if (std::isdigit(typeIdString[i])) break;
-        unsymbolifiedName = typeIdString[i] + unsymbolifiedName;
+        const auto& componentTypeInfo = *mColumnTypeInfos[columnIndex];
+        auto* componentSlot = chunk.mColumnData[columnIndex] + row * componentTypeInfo.mSize;
+        componentTypeInfo.mDestruct(componentSlot);
+        
+        if (!isLastRow)
+        {
+            auto* lastComponentSlot = lastChunk.mColumnData[columnIndex] + lastRow * componentTypeInfo.mSize;
+            componentTypeInfo.mMoveConstructFromSlot(componentSlot, lastComponentSlot);
+            componentTypeInfo.mDestruct(lastComponentSlot);
+        }
     }
     
-    const auto& systemNameSplitByWhiteSpace = StringSplit(unsymbolifiedName, ' ');
-    const auto& systemNameSplitByColumn = StringSplit(systemNameSplitByWhiteSpace[systemNameSplitByWhiteSpace.size() - 1], ':');
-    return StringId(systemNameSplitByColumn[systemNameSplitByColumn.size() - 1]);
+    const auto relocatedEntityId = isLastRow ? NULL_ENTITY_ID : lastChunk.mEntities[lastRow];
+    chunk.mEntities[row] = relocatedEntityId;
+    
+    if (--lastChunk.mEntityCount == 0)
+    {
+        mChunks.pop_back();
+    }
+    
+    return relocatedEntityId;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntitySparseSet::Insert(const EntityId entityId)
+{
+    assert(!Contains(entityId) && "Entity is already part of the set");
+    
+    GetOrCreateSparseEntry(entityId) = static_cast<std::uint32_t>(mDenseEntities.size());
+    mDenseEntities.push_back(entityId);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntitySparseSet::Erase(const EntityId entityId)
+{
+    assert(Contains(entityId) && "Entity is not part of the set");
+    
+    auto& sparseEntry = GetOrCreateSparseEntry(entityId);
+    mDenseEntities[sparseEntry] = NULL_ENTITY_ID;
+    sparseEntry = INVALID_DENSE_INDEX;
+    mHoleCount++;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const std::vector<EntityId>& EntitySparseSet::GetEntities()
+{
+    if (mHoleCount == 0)
+    {
+        return mDenseEntities;
+    }
+    
+    auto compactedSize = 0U;
+    for (const auto entityId: mDenseEntities)
+    {
+        if (entityId != NULL_ENTITY_ID)
+        {
+            GetOrCreateSparseEntry(entityId) = compactedSize;
+            mDenseEntities[compactedSize++] = entityId;
+        }
+    }
+    
+    mDenseEntities.resize(compactedSize);
+    mHoleCount = 0;
+    
+    return mDenseEntities;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::uint32_t& EntitySparseSet::GetOrCreateSparseEntry(const EntityId entityId)
+{
+    const auto pageIndex = GetEntityIndex(entityId) / ENTITY_SPARSE_SET_PAGE_SIZE;
+    if (pageIndex >= mSparsePages.size())
+    {
+        mSparsePages.resize(pageIndex + 1);
+    }
+    
+    if (!mSparsePages[pageIndex])
+    {
+        mSparsePages[pageIndex] = std::make_unique<SparsePage>();
+        mSparsePages[pageIndex]->fill(INVALID_DENSE_INDEX);
+    }
+    
+    return (*mSparsePages[pageIndex])[GetEntityIndex(entityId) % ENTITY_SPARSE_SET_PAGE_SIZE];
+}
+
+///------------------------------------------------------------------------------------------------
+
+EntityId EntityCommandBuffer::CreateEntity()
+{
+    const auto entityId = World::GetInstance().ReserveEntityId();
+    mCommands.push_back({ CommandType::CREATE_ENTITY, entityId, nullptr, nullptr });
+    return entityId;
+}
+
+///------------------------------------------------------------------------------------------------
+
+EntityId EntityCommandBuffer::CreateEntity(const StringId& name)
+{
+    const auto entityId = CreateEntity();
+    AddComponent<NameComponent>(entityId, std::make_unique<NameComponent>(name));
+    return entityId;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void EntityCommandBuffer::DestroyEntity(const EntityId entityId)
+{
+    assert(entityId != NULL_ENTITY_ID &&
+        "NULL_ENTITY_ID entity removal request");
+    
+    mCommands.push_back({ CommandType::DESTROY_ENTITY, entityId, nullptr, nullptr });
 }
-#endif
 
 ///------------------------------------------------------------------------------------------------
 
@@ -107,19 +288,17 @@ const tsl::robin_map<StringId, long long, StringIdHasher>& World::GetSystemUpdat
 void World::AddSystem(std::unique_ptr<ISystem> system, const int contextIdToOperateIn /* 0 */, SystemOperationMode operationMode /* SystemOperationMode::SINGLE_THREADED */)
 {
     auto& systemRef = *system;
-    
-#if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)
     system->mSystemName = GetSystemNameFromTypeIdString(std::string(typeid(systemRef).name()));
-#endif
+    mSystemUpdateToDuration[system->mSystemName] = 0;
     
-    if (operationMode == SystemOperationMode::MULTI_THREADED && mSystemUpdateWorkers.size() > 0)
+    if (operationMode == SystemOperationMode::MULTI_THREADED && jobs::JobSystem::GetInstance().GetWorkerCount() > 0)
     {
         system->mMultithreadedOperation = true;
     }
     system->mContextIdToOperateIn = contextIdToOperateIn;
     
     mSystems.push_back(std::move(system));
-    mEntitiesToUpdatePerSystem[typeid(systemRef)];
+    mEntitiesToUpdatePerSystem.emplace_back();
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -140,36 +319,59 @@ int World::GetContext() const
 
 void World::Update(const float dt)
 {
+    ApplyCommandBuffers();
     RemoveEntitiesWithoutAnyComponents();
     
-    for(const auto& system: mSystems)
-    {     
-        if (system->mContextIdToOperateIn == 0 || mCurrentContextId == system->mContextIdToOperateIn)
+    auto systemIndex = 0U;
+    while (systemIndex < mSystems.size())
+    {
+        auto& system = *mSystems[systemIndex];
+        if (!IsSystemActive(system))
         {
-            auto& systemRef = *system;
-            const auto& entityVec = mEntitiesToUpdatePerSystem.at(typeid(systemRef));
-            
-            const auto systemUpdateWorkerCount = mSystemUpdateWorkers.size();
-            if (system->mMultithreadedOperation && systemUpdateWorkerCount > 0 && entityVec.size() >= systemUpdateWorkerCount)
+            system.mLastUpdateDurationMicros = 0;
+            ++systemIndex;
+            continue;
+        }
+        
+        // Sync point. No component references are held across system updates
+        ApplyCommandBuffers();
+        MigrateQueuedEntities();
+        
+        if (!system.CanRunConcurrently())
+        {
+            UpdateSystem(system, dt, mEntitiesToUpdatePerSystem[systemIndex].GetEntities());
+            ++systemIndex;
+            continue;
+        }
+        
+        // Gather the run of systems up to the next one that needs to be updated on its own
+        mConcurrentSystemIndices.clear();
+        for (; systemIndex < mSystems.size(); ++systemIndex)
+        {
+            auto& candidateSystem = *mSystems[systemIndex];
+            if (!IsSystemActive(candidateSystem))
             {
-                const auto entityVecSlice = static_cast<int>(entityVec.size()/systemUpdateWorkerCount);
-                for (auto i = 0U; i < systemUpdateWorkerCount - 1; ++i)
-                {
-                    const auto startSlice = i * entityVecSlice;
-                    const auto endSlice = (i + 1) * entityVecSlice;
-                    mSystemUpdateWorkers[i]->AssignWorkParams(dt, std::vector<ecs::EntityId>(entityVec.cbegin() + startSlice, entityVec.cbegin() + endSlice), system.get());
-                }
-                const auto startSlice = (systemUpdateWorkerCount - 1) * entityVecSlice;
-                mSystemUpdateWorkers[systemUpdateWorkerCount - 1]->AssignWorkParams(dt, std::vector<ecs::EntityId>(entityVec.cbegin() + startSlice, entityVec.end()), system.get());
-
-                while (mSystemUpdateWorkers.size() > mSystemUpdateWorkersComplete);                
-                mSystemUpdateWorkersComplete = 0;
+                candidateSystem.mLastUpdateDurationMicros = 0;
+                continue;
             }
-            else
+            
+            if (!candidateSystem.CanRunConcurrently())
             {
-                system->VUpdate(dt, entityVec);
+                break;
             }
+            
+            mConcurrentSystemIndices.push_back(systemIndex);
         }
+        
+        UpdateSystemsConcurrently(dt);
+    }
+    
+    // Commands recorded by the last systems are applied within the frame that recorded them
+    ApplyCommandBuffers();
+    
+    for (const auto& system: mSystems)
+    {
+        mSystemUpdateToDuration[system->mSystemName] = system->mLastUpdateDurationMicros;
     }
 }
 
@@ -177,8 +379,11 @@ void World::Update(const float dt)
 
 EntityId World::CreateEntity()
 {
-    mEntityComponentStore.operator[](mEntityCounter);
-    return mEntityCounter++;
+#if !defined(NDEBUG)
+    ValidateStructuralChange();
+#endif
+    
+    return CreateEntityWithId(ReserveEntityId());
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -192,9 +397,51 @@ EntityId World::CreateEntity(const StringId& name)
 
 ///------------------------------------------------------------------------------------------------
 
+EntityId World::ReserveEntityId()
+{
+    // Recycled slots already carry the generation they were bumped to when their last entity was removed
+    const auto freeEntityIndicesCursor = mFreeEntityIndicesCursor--;
+    if (freeEntityIndicesCursor > 0)
+    {
+        const auto entityIndex = mFreeEntityIndices[static_cast<std::size_t>(freeEntityIndicesCursor - 1)];
+        return MakeEntityId(entityIndex, mEntityRecords[entityIndex].mGeneration);
+    }
+    
+    return MakeEntityId(mNextEntityIndex++, 0U);
+}
+
+///------------------------------------------------------------------------------------------------
+
+EntityId World::CreateEntityWithId(const EntityId entityId)
+{
+    const auto entityIndex = GetEntityIndex(entityId);
+    if (entityIndex >= mEntityRecords.size())
+    {
+        mEntityRecords.resize(entityIndex + 1);
+    }
+    
+    auto& entityRecord = mEntityRecords[entityIndex];
+    assert(entityRecord.mArchetype == nullptr && entityRecord.mGeneration == GetEntityGeneration(entityId) &&
+        "Entity id was not reserved through ReserveEntityId()");
+    
+    auto& emptyArchetype = GetOrCreateArchetype(ComponentMask());
+    const auto chunkAndRow = emptyArchetype.AllocateRow(entityId);
+    
+    entityRecord.mArchetype = &emptyArchetype;
+    entityRecord.mChunk = chunkAndRow.first;
+    entityRecord.mRow = chunkAndRow.second;
+    QueueEntityRemovalCheck(entityId, entityRecord);
+    mEntityCount++;
+    
+    return entityId;
+}
+
+///------------------------------------------------------------------------------------------------
+
 bool World::HasEntity(const EntityId entityId) const
 {
-    return mEntityComponentStore.count(entityId) != 0;
+    const auto entityIndex = GetEntityIndex(entityId);
+    return entityIndex < mEntityRecords.size() && mEntityRecords[entityIndex].mArchetype != nullptr && mEntityRecords[entityIndex].mGeneration == GetEntityGeneration(entityId);
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -204,10 +451,25 @@ void World::DestroyEntity(const EntityId entityId)
     assert(entityId != NULL_ENTITY_ID &&
         "NULL_ENTITY_ID entity removal request");
 
-    assert(mEntityComponentStore.count(entityId) != 0 &&
+    assert(HasEntity(entityId) &&
         "Entity does not exist in the world");
+    
+#if !defined(NDEBUG)
+    ValidateStructuralChange();
+#endif
 
-    mEntityComponentStore.at(entityId).mMask.reset();
+    auto& entityRecord = GetEntityRecord(entityId);
+    if (entityRecord.mMask.test(mNameComponentTypeId) && !entityRecord.mIsDestroyed)
+    {
+        RemoveEntityFromNameIndex(entityId);
+    }
+    
+    // Components are released at the next sync point and the entity's slot at the start of the next
+    // frame, but are already considered gone, so that later systems of this frame no longer find them
+    entityRecord.mMask.reset();
+    entityRecord.mIsDestroyed = true;
+    QueueEntityMigration(entityId, entityRecord);
+    QueueEntityRemovalCheck(entityId, entityRecord);
     OnEntityChanged(entityId, ComponentMask());
 }
 
@@ -223,114 +485,558 @@ void World::DestroyEntities(const std::vector<EntityId>& entityIds)
 
 ///------------------------------------------------------------------------------------------------
 
+EntityCommandBuffer& World::GetCommandBuffer()
+{
+    if (sThreadCommandBuffer == nullptr)
+    {
+        std::lock_guard<std::mutex> commandBuffersLock(mCommandBuffersMutex);
+        mCommandBuffers.push_back(std::make_unique<EntityCommandBuffer>());
+        sThreadCommandBuffer = mCommandBuffers.back().get();
+    }
+    
+    return *sThreadCommandBuffer;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::ChangeEntityName(const EntityId entityId, const StringId& newName)
+{
+    const auto isIndexed = !GetEntityRecord(entityId).mIsDestroyed;
+    if (isIndexed)
+    {
+        RemoveEntityFromNameIndex(entityId);
+    }
+    
+    GetComponent<NameComponent>(entityId).mName = newName;
+    
+    if (isIndexed)
+    {
+        AddEntityToNameIndex(entityId);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
 EntityId World::FindEntityWithName(const StringId& entityName) const
 {
-    for (const auto& entityComponentStoreEntry: mEntityComponentStore)
+    const auto entityNameIndexIter = mEntityNameIndex.find(entityName);
+    return entityNameIndexIter == mEntityNameIndex.cend() ? ecs::NULL_ENTITY_ID : entityNameIndexIter->second.front();
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::vector<EntityId> World::FindAllEntitiesWithName(const StringId &entityName) const
+{
+    const auto entityNameIndexIter = mEntityNameIndex.find(entityName);
+    return entityNameIndexIter == mEntityNameIndex.cend() ? std::vector<EntityId>() : entityNameIndexIter->second;
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::size_t World::GetEntityCount() const
+{
+    return mEntityCount;
+}
+
+///------------------------------------------------------------------------------------------------
+
+#if !defined(NDEBUG)
+std::vector<EntityId> World::FindEntitiesPendingRemoval() const
+{
+    std::vector<EntityId> entitiesPendingRemoval;
+    for (auto entityIndex = 0U; entityIndex < mEntityRecords.size(); ++entityIndex)
     {
-        const auto& entityId = entityComponentStoreEntry.first;
-        if (HasComponent<NameComponent>(entityId) && GetComponent<NameComponent>(entityId).mName == entityName)
+        const auto& entityRecord = mEntityRecords[entityIndex];
+        if (entityRecord.mArchetype != nullptr && (entityRecord.mIsDestroyed || entityRecord.mMask.any() == false))
         {
-            return entityId;
+            entitiesPendingRemoval.push_back(MakeEntityId(entityIndex, entityRecord.mGeneration));
         }
     }
-    
-    return ecs::NULL_ENTITY_ID;
+    return entitiesPendingRemoval;
 }
+#endif
 
 ///------------------------------------------------------------------------------------------------
 
-std::vector<EntityId> World::FindAllEntitiesWithName(const StringId &entityName) const
+void World::RemoveEntitiesWithoutAnyComponents()
 {
-    std::vector<EntityId> mEntityIds;
+    // Slots reserved since the last call are handed out from the back of the free list
+    mFreeEntityIndices.resize(static_cast<std::size_t>(std::max(0LL, mFreeEntityIndicesCursor.load())));
     
-    for (const auto& entityComponentStoreEntry: mEntityComponentStore)
+    for (const auto entityId: mEntitiesQueuedForRemovalCheck)
     {
-        const auto& entityId = entityComponentStoreEntry.first;
-        if (HasComponent<NameComponent>(entityId) && GetComponent<NameComponent>(entityId).mName == entityName)
+        auto& entityRecord = GetEntityRecord(entityId);
+        entityRecord.mIsQueuedForRemovalCheck = false;
+        
+        if (entityRecord.mIsDestroyed || entityRecord.mMask.any() == false)
         {
-            mEntityIds.push_back(entityId);
+            ReleaseEntityRow(entityRecord);
+            
+            const auto nextGeneration = entityRecord.mGeneration + 1;
+            entityRecord = EntityRecord();
+            entityRecord.mGeneration = nextGeneration;
+            
+            mFreeEntityIndices.push_back(GetEntityIndex(entityId));
+            mEntityCount--;
         }
     }
     
-    return mEntityIds;
+    mEntitiesQueuedForRemovalCheck.clear();
+    mFreeEntityIndicesCursor = static_cast<long long>(mFreeEntityIndices.size());
 }
 
 ///------------------------------------------------------------------------------------------------
 
-std::size_t World::GetEntityCount() const
+void World::ApplyCommandBuffers()
 {
-    return mEntityComponentStore.size();
+    // Only ever called in between system updates, so no thread is recording at this point
+    mIsApplyingCommandBuffers = true;
+    for (const auto& commandBuffer: mCommandBuffers)
+    {
+        for (auto& command: commandBuffer->mCommands)
+        {
+            switch (command.mType)
+            {
+                case EntityCommandBuffer::CommandType::CREATE_ENTITY: CreateEntityWithId(command.mEntityId); break;
+                case EntityCommandBuffer::CommandType::DESTROY_ENTITY: DestroyEntity(command.mEntityId); break;
+                case EntityCommandBuffer::CommandType::ADD_COMPONENT:
+                case EntityCommandBuffer::CommandType::REMOVE_COMPONENT:
+                {
+                    // Component changes recorded for entities that got destroyed in the meantime are dropped
+                    if (!GetEntityRecord(command.mEntityId).mIsDestroyed)
+                    {
+                        command.mComponentCommandFunction(*this, command.mEntityId, std::move(command.mComponent));
+                    }
+                } break;
+            }
+        }
+        
+        commandBuffer->mCommands.clear();
+    }
+    mIsApplyingCommandBuffers = false;
+    
+    for (const auto entityId: mEntitiesQueuedForMembershipUpdate)
+    {
+        auto& entityRecord = GetEntityRecord(entityId);
+        entityRecord.mIsQueuedForMembershipUpdate = false;
+        OnEntityChanged(entityId, entityRecord.mIsDestroyed ? ComponentMask() : entityRecord.mMask);
+    }
+    
+    mEntitiesQueuedForMembershipUpdate.clear();
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void World::RemoveEntitiesWithoutAnyComponents()
+void World::MigrateQueuedEntities()
 {
-    auto entityIter = mEntityComponentStore.begin();
-    while (entityIter != mEntityComponentStore.end())
-    {                
-        if (entityIter->second.mMask.any() == false)
+    for (const auto entityId: mEntitiesQueuedForMigration)
+    {
+        // Entities removed since they were queued may have had their slot recycled already
+        if (!HasEntity(entityId))
+        {
+            continue;
+        }
+        
+        // Destroyed entities move to the empty archetype, releasing their components, so that chunk
+        // sweeps no longer find them. Components added after their destruction are dropped as well
+        auto& entityRecord = GetEntityRecord(entityId);
+        entityRecord.mIsQueuedForMigration = false;
+        if (entityRecord.mIsDestroyed && entityRecord.mMask.any())
+        {
+            entityRecord.mMask.reset();
+            OnEntityChanged(entityId, entityRecord.mMask);
+        }
+        
+        auto& targetArchetype = GetOrCreateArchetype(entityRecord.mMask);
+        if (&targetArchetype != entityRecord.mArchetype)
+        {
+            MigrateEntity(entityId, entityRecord, targetArchetype);
+        }
+    }
+    
+    mEntitiesQueuedForMigration.clear();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::MigrateEntity(const EntityId entityId, EntityRecord& entityRecord, Archetype& targetArchetype)
+{
+    const auto& sourceArchetype = *entityRecord.mArchetype;
+    const auto& sourceChunk = *entityRecord.mChunk;
+    const auto sourceRow = entityRecord.mRow;
+    
+    const auto targetChunkAndRow = targetArchetype.AllocateRow(entityId);
+    auto& targetChunk = *targetChunkAndRow.first;
+    const auto targetRow = targetChunkAndRow.second;
+    
+    for (auto componentTypeId = 0; componentTypeId < MAX_COMPONENTS; ++componentTypeId)
+    {
+        const auto targetColumnIndex = targetArchetype.mColumnIndices[componentTypeId];
+        if (targetColumnIndex == -1)
         {
-            entityIter = mEntityComponentStore.erase(entityIter);
+            continue;
+        }
+        
+        const auto& componentTypeInfo = *targetArchetype.mColumnTypeInfos[targetColumnIndex];
+        auto* targetComponentSlot = targetChunk.mColumnData[targetColumnIndex] + targetRow * componentTypeInfo.mSize;
+        
+        const auto sourceColumnIndex = sourceArchetype.mColumnIndices[componentTypeId];
+        if (sourceColumnIndex != -1)
+        {
+            componentTypeInfo.mMoveConstructFromSlot(targetComponentSlot, sourceChunk.mColumnData[sourceColumnIndex] + sourceRow * componentTypeInfo.mSize);
         }
         else
         {
-            entityIter++;
+            componentTypeInfo.mMoveConstructFromComponent(targetComponentSlot, GetPendingComponent(entityRecord, componentTypeId));
         }
     }
+    
+    // Releases the moved-from components along with any removed ones
+    ReleaseEntityRow(entityRecord);
+    
+    entityRecord.mArchetype = &targetArchetype;
+    entityRecord.mChunk = &targetChunk;
+    entityRecord.mRow = targetRow;
+    entityRecord.mPendingComponents.clear();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::ReleaseEntityRow(const EntityRecord& entityRecord)
+{
+    const auto relocatedEntityId = entityRecord.mArchetype->RemoveRow(*entityRecord.mChunk, entityRecord.mRow);
+    if (relocatedEntityId != NULL_ENTITY_ID)
+    {
+        auto& relocatedEntityRecord = GetEntityRecord(relocatedEntityId);
+        relocatedEntityRecord.mChunk = entityRecord.mChunk;
+        relocatedEntityRecord.mRow = entityRecord.mRow;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+Archetype& World::GetOrCreateArchetype(const ComponentMask& componentMask)
+{
+    auto archetypeIter = mComponentMaskToArchetype.find(componentMask);
+    if (archetypeIter != mComponentMaskToArchetype.end())
+    {
+        return *archetypeIter->second;
+    }
+    
+    mArchetypes.push_back(std::make_unique<Archetype>(componentMask, mComponentTypeInfos));
+    mComponentMaskToArchetype[componentMask] = mArchetypes.back().get();
+    return *mArchetypes.back();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::QueueEntityMigration(const EntityId entityId, EntityRecord& entityRecord)
+{
+    if (!entityRecord.mIsQueuedForMigration)
+    {
+        entityRecord.mIsQueuedForMigration = true;
+        mEntitiesQueuedForMigration.push_back(entityId);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::QueueEntityRemovalCheck(const EntityId entityId, EntityRecord& entityRecord)
+{
+    if (!entityRecord.mIsQueuedForRemovalCheck)
+    {
+        entityRecord.mIsQueuedForRemovalCheck = true;
+        mEntitiesQueuedForRemovalCheck.push_back(entityId);
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::SweepChunksConcurrently(const ComponentMask& requiredComponentMask, const std::function<void(const ArchetypeChunk&)>& chunkFunction) const
+{
+    std::vector<const ArchetypeChunk*> chunks;
+    for (const auto& archetype: mArchetypes)
+    {
+        if ((archetype->mComponentMask & requiredComponentMask) != requiredComponentMask)
+        {
+            continue;
+        }
+        
+        for (const auto& chunk: archetype->mChunks)
+        {
+            if (chunk->mEntityCount > 0)
+            {
+                chunks.push_back(chunk.get());
+            }
+        }
+    }
+    
+    auto& jobSystem = jobs::JobSystem::GetInstance();
+    const auto chunkBatchCount = std::min(chunks.size(), (jobSystem.GetWorkerCount() + 1) * ENTITY_BATCHES_PER_THREAD);
+    if (jobSystem.GetWorkerCount() == 0 || chunkBatchCount <= 1)
+    {
+        for (const auto* chunk: chunks)
+        {
+            chunkFunction(*chunk);
+        }
+        return;
+    }
+    
+#if !defined(NDEBUG)
+    // Component accesses in the jobs are validated against the system that requested the sweep
+    const auto* sweepingSystem = sUpdatingSystem;
+#endif
+    
+    jobs::JobCounter sweepCounter;
+    for (auto i = 0U; i < chunkBatchCount; ++i)
+    {
+        const auto batchBegin = i * chunks.size() / chunkBatchCount;
+        const auto batchEnd = (i + 1) * chunks.size() / chunkBatchCount;
+        
+        jobSystem.Run([&, batchBegin, batchEnd]()
+        {
+#if !defined(NDEBUG)
+            const auto* previouslyUpdatingSystem = sUpdatingSystem;
+            sUpdatingSystem = sweepingSystem;
+#endif
+            for (auto chunkIndex = batchBegin; chunkIndex < batchEnd; ++chunkIndex)
+            {
+                chunkFunction(*chunks[chunkIndex]);
+            }
+#if !defined(NDEBUG)
+            sUpdatingSystem = previouslyUpdatingSystem;
+#endif
+        }, sweepCounter);
+    }
+    
+    jobSystem.Wait(sweepCounter);
+}
+
+///------------------------------------------------------------------------------------------------
+
+IComponent& World::GetPendingComponent(const EntityRecord& entityRecord, const ComponentTypeId componentTypeId) const
+{
+    const auto pendingComponentIter = std::find_if(entityRecord.mPendingComponents.cbegin(), entityRecord.mPendingComponents.cend(), [=](const auto& pendingComponent)
+    {
+        return pendingComponent.first == componentTypeId;
+    });
+    
+    assert(pendingComponentIter != entityRecord.mPendingComponents.cend() &&
+        "Component is not present in this entity's component store");
+    
+    return *pendingComponentIter->second;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::RemovePendingComponent(EntityRecord& entityRecord, const ComponentTypeId componentTypeId)
+{
+    auto& pendingComponents = entityRecord.mPendingComponents;
+    pendingComponents.erase(std::remove_if(pendingComponents.begin(), pendingComponents.end(), [=](const auto& pendingComponent)
+    {
+        return pendingComponent.first == componentTypeId;
+    }), pendingComponents.end());
 }
 
 ///------------------------------------------------------------------------------------------------
 
 void World::OnEntityChanged(const EntityId entityId, const ComponentMask& newComponentMask)
 {
-    for (auto& system: mSystems)
+    if (mIsApplyingCommandBuffers)
+    {
+        auto& entityRecord = GetEntityRecord(entityId);
+        if (!entityRecord.mIsQueuedForMembershipUpdate)
+        {
+            entityRecord.mIsQueuedForMembershipUpdate = true;
+            mEntitiesQueuedForMembershipUpdate.push_back(entityId);
+        }
+        return;
+    }
+    
+    for (auto systemIndex = 0U; systemIndex < mSystems.size(); ++systemIndex)
     {
-        auto& systemRef = *system;
-        auto& systemEntityVec = mEntitiesToUpdatePerSystem[typeid(systemRef)];
+        auto& systemEntitySet = mEntitiesToUpdatePerSystem[systemIndex];
+        const auto shouldProcessEntity = mSystems[systemIndex]->ShouldProcessComponentMask(newComponentMask);
         
-        if
-        (
-            system->ShouldProcessComponentMask(newComponentMask) &&
-            std::find(systemEntityVec.cbegin(), systemEntityVec.cend(), entityId) == systemEntityVec.cend()
-        )
+        if (shouldProcessEntity && !systemEntitySet.Contains(entityId))
         {
-            systemEntityVec.push_back(entityId);
+            systemEntitySet.Insert(entityId);
         }
-        else if
-        (
-            system->ShouldProcessComponentMask(newComponentMask) == false &&
-            std::find(systemEntityVec.cbegin(), systemEntityVec.cend(), entityId) != systemEntityVec.cend()
-        )
+        else if (!shouldProcessEntity && systemEntitySet.Contains(entityId))
         {
-            systemEntityVec.erase(std::remove(systemEntityVec.begin(), systemEntityVec.end(), entityId), systemEntityVec.end());
+            systemEntitySet.Erase(entityId);
         }
     }
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void World::OnWorkerCompleteCallback()
+bool World::IsSystemActive(const ISystem& system) const
 {
-    mSystemUpdateWorkersComplete++;
+    return system.mContextIdToOperateIn == 0 || mCurrentContextId == system.mContextIdToOperateIn;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-World::World()
+void World::UpdateSystem(ISystem& system, const float dt, const std::vector<EntityId>& entitiesToProcess)
+{
+    const debug::ProfilerZone systemUpdateZone(system.mSystemName.GetString().c_str());
+    const auto updateStartNanos = debug::Profiler::GetTimestampNanos();
+    
+    auto& jobSystem = jobs::JobSystem::GetInstance();
+    const auto entityBatchCount = std::min(entitiesToProcess.size(), (jobSystem.GetWorkerCount() + 1) * ENTITY_BATCHES_PER_THREAD);
+    if (system.mMultithreadedOperation && jobSystem.GetWorkerCount() > 0 && entityBatchCount > 1)
+    {
+        system.mEntityBatches.resize(entityBatchCount);
+        
+        jobs::JobCounter systemUpdateCounter;
+        for (auto i = 0U; i < entityBatchCount; ++i)
+        {
+            const auto batchBegin = entitiesToProcess.cbegin() + i * entitiesToProcess.size() / entityBatchCount;
+            const auto batchEnd = entitiesToProcess.cbegin() + (i + 1) * entitiesToProcess.size() / entityBatchCount;
+            
+            auto& entityBatch = system.mEntityBatches[i];
+            entityBatch.assign(batchBegin, batchEnd);
+            jobSystem.Run([&system, &entityBatch, dt](){ InvokeSystemUpdate(system, dt, entityBatch); }, systemUpdateCounter);
+        }
+        
+        jobSystem.Wait(systemUpdateCounter);
+    }
+    else
+    {
+        InvokeSystemUpdate(system, dt, entitiesToProcess);
+    }
+    
+    system.mLastUpdateDurationMicros = (debug::Profiler::GetTimestampNanos() - updateStartNanos)/NANOS_PER_MICRO;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::UpdateSystemsConcurrently(const float dt)
+{
+    auto& jobSystem = jobs::JobSystem::GetInstance();
+    if (mConcurrentSystemIndices.size() == 1 || jobSystem.GetWorkerCount() == 0)
+    {
+        for (const auto systemIndex: mConcurrentSystemIndices)
+        {
+            UpdateSystem(*mSystems[systemIndex], dt, mEntitiesToUpdatePerSystem[systemIndex].GetEntities());
+        }
+        return;
+    }
+    
+    // Build the dependency graph of the group. The entity sets are compacted here,
+    // before any of the systems starts running
+    std::vector<SystemGraphNode> systemGraph(mConcurrentSystemIndices.size());
+    for (auto i = 0U; i < systemGraph.size(); ++i)
+    {
+        auto& systemNode = systemGraph[i];
+        systemNode.mSystemIndex = mConcurrentSystemIndices[i];
+        systemNode.mEntities = &mEntitiesToUpdatePerSystem[systemNode.mSystemIndex].GetEntities();
+        
+        for (auto j = 0U; j < i; ++j)
+        {
+            if (mSystems[systemGraph[j].mSystemIndex]->ConflictsWith(*mSystems[systemNode.mSystemIndex]))
+            {
+                systemGraph[j].mDependentNodeIndices.push_back(i);
+                systemNode.mRemainingDependencyCount++;
+            }
+        }
+    }
+    
+    jobs::JobCounter systemsUpdateCounter;
+    std::function<void(std::size_t)> scheduleSystemNode = [&](const std::size_t nodeIndex)
+    {
+        jobSystem.Run([&, nodeIndex]()
+        {
+            const auto& systemNode = systemGraph[nodeIndex];
+            UpdateSystem(*mSystems[systemNode.mSystemIndex], dt, *systemNode.mEntities);
+            
+            for (const auto dependentNodeIndex: systemNode.mDependentNodeIndices)
+            {
+                if (systemGraph[dependentNodeIndex].mRemainingDependencyCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    scheduleSystemNode(dependentNodeIndex);
+                }
+            }
+        }, systemsUpdateCounter);
+    };
+    
+    for (auto i = 0U; i < systemGraph.size(); ++i)
+    {
+        if (systemGraph[i].mRemainingDependencyCount == 0)
+        {
+            scheduleSystemNode(i);
+        }
+    }
+    
+    jobSystem.Wait(systemsUpdateCounter);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::InvokeSystemUpdate(const ISystem& system, const float dt, const std::vector<EntityId>& entitiesToProcess)
+{
+#if !defined(NDEBUG)
+    const auto* previouslyUpdatingSystem = sUpdatingSystem;
+    sUpdatingSystem = &system;
+    system.VUpdate(dt, entitiesToProcess);
+    sUpdatingSystem = previouslyUpdatingSystem;
+#else
+    system.VUpdate(dt, entitiesToProcess);
+#endif
+}
+
+///------------------------------------------------------------------------------------------------
+
+#if !defined(NDEBUG)
+void World::ValidateComponentAccess(const std::size_t componentTypeId) const
+{
+    assert((sUpdatingSystem == nullptr || !sUpdatingSystem->CanRunConcurrently() || (sUpdatingSystem->mReadComponentsMask | sUpdatingSystem->mWriteComponentsMask).test(componentTypeId)) &&
+        "System accessed a component type it has not declared access to");
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::ValidateStructuralChange() const
+{
+    assert((sUpdatingSystem == nullptr || !sUpdatingSystem->CanRunConcurrently()) &&
+        "System made a structural change without declaring it");
+}
+#endif
+
+///------------------------------------------------------------------------------------------------
+
+void World::AddEntityToNameIndex(const EntityId entityId)
 {
-    mEntityComponentStore.reserve(ANTICIPATED_ENTITY_COUNT);
+    mEntityNameIndex[GetComponent<NameComponent>(entityId).GetName()].push_back(entityId);
+}
+
+///------------------------------------------------------------------------------------------------
+
+void World::RemoveEntityFromNameIndex(const EntityId entityId)
+{
+    auto entityNameIndexIter = mEntityNameIndex.find(GetComponent<NameComponent>(entityId).GetName());
+    assert(entityNameIndexIter != mEntityNameIndex.end() && "Entity is not registered under its name");
+    
+    auto& namedEntities = entityNameIndexIter.value();
+    namedEntities.erase(std::find(namedEntities.begin(), namedEntities.end(), entityId));
     
-    auto threadWorkerCount = 1;
-    for (auto i = 0U; i < threadWorkerCount; ++i)
+    if (namedEntities.empty())
     {
-        mSystemUpdateWorkers.push_back(std::make_unique<SystemUpdateWorker>());
-        mSystemUpdateWorkers.back()->StartWorker([&](){OnWorkerCompleteCallback();});
+        mEntityNameIndex.erase(entityNameIndexIter);
     }
 }
 
 ///------------------------------------------------------------------------------------------------
 
+World::World()
+{
+    mEntityRecords.reserve(ANTICIPATED_ENTITY_COUNT);
+    mNameComponentTypeId = GetTypeHash<NameComponent>();
+}
+
+///------------------------------------------------------------------------------------------------
+
 }
 
 }
@@ -21,9 +21,16 @@
 #include <array>
 #include <bitset>        
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <tsl/robin_map.h>
+#include <unordered_map>
+#include <utility>
 #include <vector>        
 #include <atomic>
 
@@ -42,19 +49,35 @@ static constexpr int MAX_COMPONENTS = 64;
 /// so that multiple resizes won't be needed
 static constexpr int ANTICIPATED_ENTITY_COUNT = 1000;
 
+/// Number of entity batches created per thread when updating a multi-threaded system,
+/// so that threads finishing early can steal the remaining batches
+static constexpr std::size_t ENTITY_BATCHES_PER_THREAD = 4;
+
 /// Null entity ID
 static constexpr long long NULL_ENTITY_ID = 0LL;
 
+/// Number of entity ids covered by a single page of an EntitySparseSet's sparse index
+static constexpr std::size_t ENTITY_SPARSE_SET_PAGE_SIZE = 4096;
+
+/// Target size of the memory block backing a single archetype chunk.
+/// The entity capacity of each chunk is derived from this and the archetype's row size
+static constexpr std::size_t ARCHETYPE_CHUNK_SIZE_IN_BYTES = 16 * 1024;
+
 ///------------------------------------------------------------------------------------------------
 
+class Archetype;
 class World;
 class ISystem;
 class IComponent;
-class SystemUpdateWorker;
 
 using ComponentMask   = std::bitset<MAX_COMPONENTS>;
 using ComponentTypeId = int;
 using SystemTypeId    = int;
+
+/// Entity ids pack the index of the entity's slot in the world (lower 32 bits) with the generation
+/// of that slot (upper 32 bits). Slots are recycled after their entity is removed, bumping their
+/// generation, so that ids kept around past their entity's removal can be detected as stale.
+/// First generation ids are equal to their slot index.
 using EntityId        = long long;
 
 ///------------------------------------------------------------------------------------------------
@@ -74,13 +97,31 @@ struct ComponentTypeIdHasher
     }
 };
 
-struct EntityIdHasher
+///------------------------------------------------------------------------------------------------
+/// Packs the given slot index and generation in to an entity id.
+/// @param[in] entityIndex the index of the entity's slot in the world.
+/// @param[in] entityGeneration the generation of the entity's slot.
+/// @returns the packed entity id.
+inline constexpr EntityId MakeEntityId(const std::uint32_t entityIndex, const std::uint32_t entityGeneration)
 {
-    std::size_t operator()(const EntityId& key) const
-    {
-        return static_cast<std::size_t>(key);
-    }
-};
+    return static_cast<EntityId>((static_cast<std::uint64_t>(entityGeneration) << 32) | entityIndex);
+}
+
+///------------------------------------------------------------------------------------------------
+/// @param[in] entityId the entity id to unpack.
+/// @returns the index of the entity's slot in the world.
+inline constexpr std::uint32_t GetEntityIndex(const EntityId entityId)
+{
+    return static_cast<std::uint32_t>(static_cast<std::uint64_t>(entityId) & 0xFFFFFFFFULL);
+}
+
+///------------------------------------------------------------------------------------------------
+/// @param[in] entityId the entity id to unpack.
+/// @returns the generation of the entity's slot that the id was handed out for.
+inline constexpr std::uint32_t GetEntityGeneration(const EntityId entityId)
+{
+    return static_cast<std::uint32_t>(static_cast<std::uint64_t>(entityId) >> 32);
+}
 
 ///------------------------------------------------------------------------------------------------
 /// Base class of all components in the engine. All custom components needs to inherit from
@@ -94,6 +135,8 @@ public:
     IComponent(const IComponent&) = delete;
     IComponent& operator=(const IComponent&) = delete;
     
+    IComponent(IComponent&&) = default;
+    IComponent& operator=(IComponent&&) = default;
 };
 
 ///------------------------------------------------------------------------------------------------
@@ -102,10 +145,222 @@ class NullComponent final: public IComponent
 {
 };
 
+///------------------------------------------------------------------------------------------------
+/// A set of entity ids with constant time insertion, removal and membership tests. The entities are
+/// kept in a dense vector in insertion order; a removal leaves a hole behind which is compacted away,
+/// preserving the order of the remaining entities, the next time the dense vector is requested.
+class EntitySparseSet final
+{
+public:
+    EntitySparseSet() = default;
+    ~EntitySparseSet() = default;
+    EntitySparseSet(EntitySparseSet&&) = default;
+    EntitySparseSet& operator=(EntitySparseSet&&) = default;
+    EntitySparseSet(const EntitySparseSet&) = delete;
+    EntitySparseSet& operator=(const EntitySparseSet&) = delete;
+    
+    /// Checks whether the given entity is part of the set.
+    /// @param[in] entityId the entity to check for.
+    /// @returns whether the entity is part of the set.
+    inline bool Contains(const EntityId entityId) const
+    {
+        // The sparse index is keyed by slot, so the dense entry tells apart the different generations of a slot
+        const auto pageIndex = GetEntityIndex(entityId) / ENTITY_SPARSE_SET_PAGE_SIZE;
+        if (pageIndex >= mSparsePages.size() || !mSparsePages[pageIndex])
+        {
+            return false;
+        }
+        
+        const auto denseIndex = (*mSparsePages[pageIndex])[GetEntityIndex(entityId) % ENTITY_SPARSE_SET_PAGE_SIZE];
+        return denseIndex != INVALID_DENSE_INDEX && mDenseEntities[denseIndex] == entityId;
+    }
+    
+    /// Appends the given entity to the set. The entity must not already be part of the set.
+    /// @param[in] entityId the entity to insert.
+    void Insert(const EntityId entityId);
+    
+    /// Removes the given entity from the set. The entity must be part of the set.
+    /// @param[in] entityId the entity to erase.
+    void Erase(const EntityId entityId);
+    
+    /// Compacts any holes left behind by removals and returns the entities of the set.
+    /// @returns the entities of the set, in the order they were inserted.
+    const std::vector<EntityId>& GetEntities();
+    
+private:
+    static constexpr std::uint32_t INVALID_DENSE_INDEX = ~std::uint32_t(0);
+    using SparsePage = std::array<std::uint32_t, ENTITY_SPARSE_SET_PAGE_SIZE>;
+    
+    std::uint32_t& GetOrCreateSparseEntry(const EntityId entityId);
+    
+private:
+    std::vector<EntityId> mDenseEntities;
+    std::vector<std::unique_ptr<SparsePage>> mSparsePages;
+    std::size_t mHoleCount = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Type-erased lifetime operations of a component type, used to relocate and destroy
+/// components stored inside archetype chunks.
+struct ComponentTypeInfo
+{
+    std::size_t mSize = 0;
+    void (*mMoveConstructFromSlot)(void* destination, void* source) = nullptr;
+    void (*mMoveConstructFromComponent)(void* destination, IComponent& source) = nullptr;
+    void (*mDestruct)(void* component) = nullptr;
+};
+
+///------------------------------------------------------------------------------------------------
+/// A fixed capacity block of entities that share the same archetype. Each component type of the
+/// archetype is stored in its own contiguous array (column) inside the chunk's memory block.
+class ArchetypeChunk final
+{
+    friend class Archetype;
+    friend class World;
+public:
+    ArchetypeChunk(const Archetype& archetype);
+    ~ArchetypeChunk() = default;
+    ArchetypeChunk(const ArchetypeChunk&) = delete;
+    ArchetypeChunk& operator=(const ArchetypeChunk&) = delete;
+    
+    /// @returns the number of entities currently stored in this chunk.
+    inline std::size_t GetEntityCount() const { return mEntityCount; }
+    
+    /// @returns the ids of the entities stored in this chunk, in row order.
+    inline const EntityId* GetEntities() const { return mEntities; }
+    
+    /// Gets the contiguous array of components of the given type stored in this chunk.
+    ///
+    /// The array is GetEntityCount() long and is indexed in the same row order as GetEntities().
+    /// @tparam ComponentType the component type class whose array to return. Must be part of the chunk's archetype.
+    /// @returns a pointer to the first component of the array.
+    template<class ComponentType>
+    [[nodiscard]] inline ComponentType* GetComponentArray() const;
+
+private:
+    const Archetype& mArchetype;
+    std::unique_ptr<unsigned char[]> mData;
+    std::vector<unsigned char*> mColumnData;
+    EntityId* mEntities = nullptr;
+    std::size_t mEntityCount = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Storage for all entities that have exactly the same set of components. Entities are
+/// packed densely across a list of chunks.
+class Archetype final
+{
+    friend class ArchetypeChunk;
+    friend class World;
+public:
+    /// Calculates the chunk layout for the given component mask.
+    /// @param[in] componentMask the component mask shared by all entities of this archetype.
+    /// @param[in] componentTypeInfos the lifetime operations of all registered component types.
+    Archetype(const ComponentMask& componentMask, const std::array<ComponentTypeInfo, MAX_COMPONENTS>& componentTypeInfos);
+    ~Archetype();
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+    
+private:
+    /// Reserves a row for the given entity at the end of the archetype. The
+    /// component slots of the row are left unconstructed.
+    std::pair<ArchetypeChunk*, std::size_t> AllocateRow(const EntityId entityId);
+    
+    /// Destructs the components of the given row and fills the gap with the archetype's last row.
+    /// @returns the id of the entity that was relocated to fill the gap, or NULL_ENTITY_ID if none was.
+    EntityId RemoveRow(ArchetypeChunk& chunk, const std::size_t row);
+    
+private:
+    ComponentMask mComponentMask;
+    std::array<int, MAX_COMPONENTS> mColumnIndices;
+    std::vector<const ComponentTypeInfo*> mColumnTypeInfos;
+    std::vector<std::size_t> mColumnOffsets;
+    std::vector<std::unique_ptr<ArchetypeChunk>> mChunks;
+    std::size_t mChunkCapacity = 0;
+    std::size_t mChunkSizeInBytes = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+
+template<class ComponentType>
+inline ComponentType* ArchetypeChunk::GetComponentArray() const
+{
+    const auto componentTypeId = GetTypeHash<ComponentType>();
+    assert(componentTypeId < MAX_COMPONENTS && "Maximum amount of components exceeded");
+    
+    const auto columnIndex = mArchetype.mColumnIndices[componentTypeId];
+    assert(columnIndex != -1 && "Component type is not part of this chunk's archetype");
+    
+    return reinterpret_cast<ComponentType*>(mColumnData[columnIndex]);
+}
+
+///------------------------------------------------------------------------------------------------
+/// Records structural changes (entity creation and destruction, component addition and removal)
+/// that the world applies in a batch at its next sync point. This allows systems to request them
+/// while iterating over their entities, which stay unchanged until the system's update is over.
+/// Every thread records into its own buffer. @see World::GetCommandBuffer()
+class EntityCommandBuffer final
+{
+    friend class World;
+public:
+    EntityCommandBuffer() = default;
+    ~EntityCommandBuffer() = default;
+    EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+    EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+    /// Reserves an entity id; the entity itself is created at the next sync point.
+    ///
+    /// Until then the returned id can only be used in further commands of this buffer.
+    /// @returns the entity id of the entity to be created.
+    EntityId CreateEntity();
+
+    /// Reserves an entity id for an entity that will be created with the given name at the next sync point.
+    /// @param[in] name the name to associate the entity with.
+    /// @returns the entity id of the entity to be created.
+    EntityId CreateEntity(const StringId& name);
+
+    /// Records the destruction of the given entity. @see World::DestroyEntity()
+    /// @param[in] entityId the entity with this id will be destroyed.
+    void DestroyEntity(const EntityId entityId);
+
+    /// Records the addition of the given component to the given entity. @see World::AddComponent()
+    /// @tparam ComponentType the derived component type.
+    /// @param[in] entityId the entity to add the component to.
+    /// @param[in] component the pointer to the component instance to be added to the entity.
+    template<class ComponentType>
+    inline void AddComponent(const EntityId entityId, std::unique_ptr<IComponent> component);
+
+    /// Records the removal of the component with the given type from the given entity. @see World::RemoveComponent()
+    /// @tparam ComponentType the derived component type class to remove from the entity.
+    /// @param[in] entityId the entity to remove the component from.
+    template<class ComponentType>
+    inline void RemoveComponent(const EntityId entityId);
+
+private:
+    enum class CommandType
+    {
+        CREATE_ENTITY, DESTROY_ENTITY, ADD_COMPONENT, REMOVE_COMPONENT
+    };
+
+    using ComponentCommandFunction = void(*)(World& world, const EntityId entityId, std::unique_ptr<IComponent> component);
+
+    struct Command
+    {
+        CommandType mType;
+        EntityId mEntityId;
+        std::unique_ptr<IComponent> mComponent;
+        ComponentCommandFunction mComponentCommandFunction;
+    };
+
+private:
+    std::vector<Command> mCommands;
+};
+
 ///------------------------------------------------------------------------------------------------
 /// The kernel of the ECS engine. Manages all registered systems and entities.
 class World final
 {
+    friend class EntityCommandBuffer;
 public:     
     /// The default method of getting a hold of this singleton.
     ///
@@ -114,7 +369,7 @@ public:
     /// @returns a reference to the single instance of this class.    
     static World& GetInstance();
 
-    /// @returns a map containing the system name strings mapped to their current update times in miliseconds.
+    /// @returns a map containing the system name strings mapped to their last update times in microseconds.
     const tsl::robin_map<StringId, long long, StringIdHasher>& GetSystemUpdateTimes() const;
 
     /// Changes the context of the world.
@@ -162,6 +417,20 @@ public:
     /// Removes all entities with the given ids from the world.
     /// @param[in] entityIds the ids of all entities to be destroyed.
     void DestroyEntities(const std::vector<EntityId>& entityIds);
+
+    /// Gets the command buffer of the calling thread.
+    ///
+    /// Structural changes recorded in it are applied before the next system update (or at the end of the
+    /// frame), so they are safe to request while iterating over a system's entities, from any thread.
+    /// @returns the command buffer of the calling thread.
+    EntityCommandBuffer& GetCommandBuffer();
+
+    /// Changes the name of the given entity, keeping the name lookups up to date.
+    ///
+    /// Should be used instead of writing to the entity's NameComponent directly.
+    /// @param[in] entityId the entity to rename. Needs to have a NameComponent.
+    /// @param[in] newName the new name of the entity.
+    void ChangeEntityName(const EntityId entityId, const StringId& newName);
     
     /// Finds and returns the first entity found with the name provided.
     /// @param[in] name the name to search for the entities with.
@@ -177,6 +446,13 @@ public:
     /// @returns the current entity count in this world
     std::size_t GetEntityCount() const;
     
+#if !defined(NDEBUG)
+    /// Debug-only oracle for the removal check at the start of every update. Scans all entity
+    /// records, the way every update did before only the entities queued for the check were visited.
+    /// @returns the ids of all live entities that are destroyed, or left without any components.
+    std::vector<EntityId> FindEntitiesPendingRemoval() const;
+#endif
+    
     /// Gets the respective component from the entity with the given entity id.
     ///
     /// The accessor will fail silently if the entity does not have a component of the respective component class.
@@ -190,18 +466,28 @@ public:
         assert(entityId != NULL_ENTITY_ID &&
             "Requested a component from NULL_ENTITY_ID");
 
-        assert(mEntityComponentStore.count(entityId) != 0 &&
+        assert(HasEntity(entityId) &&
             "Entity does not exist in the world");
 
         const auto componentTypeId = GetTypeHash<ComponentType>();
-        const auto& entityEntry = mEntityComponentStore.at(entityId);
+        const auto& entityRecord = GetEntityRecord(entityId);
         
         assert(componentTypeId < MAX_COMPONENTS && "Maximum amount of components exceeded");
         
-        assert(entityEntry.mComponents[componentTypeId] &&
+        assert(entityRecord.mMask.test(componentTypeId) &&
             "Component is not present in this entity's component store");
         
-        return static_cast<ComponentType&>(*entityEntry.mComponents[componentTypeId]);
+#if !defined(NDEBUG)
+        ValidateComponentAccess(componentTypeId);
+#endif
+        
+        const auto columnIndex = entityRecord.mArchetype->mColumnIndices[componentTypeId];
+        if (columnIndex != -1)
+        {
+            return reinterpret_cast<ComponentType*>(entityRecord.mChunk->mColumnData[columnIndex])[entityRecord.mRow];
+        }
+        
+        return static_cast<ComponentType&>(GetPendingComponent(entityRecord, componentTypeId));
     }
 
     /// Checks whether the given entity has a component of the given component class type.
@@ -214,44 +500,86 @@ public:
         assert(entityId != NULL_ENTITY_ID &&
             "Component check from NULL_ENTITY_ID");
 
-        assert(mEntityComponentStore.count(entityId) != 0 &&
+        assert(HasEntity(entityId) &&
             "Entity does not exist in the world");
 
         const auto componentTypeId = GetTypeHash<ComponentType>();
         
         assert(componentTypeId < MAX_COMPONENTS && "Maximum amount of components exceeded");
         
-        return mEntityComponentStore.at(entityId).mComponents[componentTypeId] != nullptr;
+        return GetEntityRecord(entityId).mMask.test(componentTypeId);
     }
 
     /// Adds and <b>takes ownership</b> of the given component and adds it to the entity with the given id.
+    ///
+    /// The entity is moved to the chunk of its new archetype at the next sync point (before the next system update),
+    /// so references to its other components stay valid until then.
     /// @tparam ComponentType the derived component type.
     /// @param[in] entityId the entity with the respective id to check component ownership from.
     /// @param[in] component the pointer to the component instance to be added to the entity.
     template<class ComponentType>
     inline void AddComponent(const EntityId entityId, std::unique_ptr<IComponent> component)
     {
+        static_assert(std::is_base_of<IComponent, ComponentType>::value,
+            "ComponentType does not derive from IComponent");
+        
+        static_assert(std::is_move_constructible<ComponentType>::value,
+            "ComponentType needs to be move constructible in order to be stored in archetype chunks");
+        
+        static_assert(alignof(ComponentType) <= alignof(std::max_align_t),
+            "ComponentType alignment exceeds the alignment of archetype chunks");
+        
         assert(entityId != NULL_ENTITY_ID &&
             "Component addition for NULL_ENTITY_ID");
 
-        assert(mEntityComponentStore.count(entityId) != 0 &&
+        assert(HasEntity(entityId) &&
             "Entity does not exist in the world");
+        
+        assert(dynamic_cast<ComponentType*>(component.get()) != nullptr &&
+            "Component instance type does not match the requested component type");
+        
+#if !defined(NDEBUG)
+        ValidateStructuralChange();
+#endif
 
         const auto componentTypeId = GetTypeHash<ComponentType>();
 
         assert(componentTypeId < MAX_COMPONENTS && "Maximum amount of components exceeded");
         
-        auto& entityEntry = mEntityComponentStore.at(entityId);
-        assert(entityEntry.mComponents[componentTypeId] == nullptr &&
+        RegisterComponentType<ComponentType>(componentTypeId);
+        
+        auto& entityRecord = GetEntityRecord(entityId);
+        assert(entityRecord.mMask.test(componentTypeId) == false &&
             "Component is already present in this entity's component store");
         
-        entityEntry.mComponents[componentTypeId] = std::move(component);
-        entityEntry.mMask |= 1LL << componentTypeId;
+        const auto columnIndex = entityRecord.mArchetype->mColumnIndices[componentTypeId];
+        if (columnIndex != -1)
+        {
+            // A component of this type was removed earlier in the frame and its slot has
+            // not been released yet, so the new component can simply take its place
+            auto* componentSlot = reinterpret_cast<ComponentType*>(entityRecord.mChunk->mColumnData[columnIndex]) + entityRecord.mRow;
+            componentSlot->~ComponentType();
+            new (componentSlot) ComponentType(std::move(static_cast<ComponentType&>(*component)));
+        }
+        else
+        {
+            entityRecord.mPendingComponents.emplace_back(componentTypeId, std::move(component));
+        }
+        
+        entityRecord.mMask.set(componentTypeId);
+        QueueEntityMigration(entityId, entityRecord);
+        
+        if (componentTypeId == mNameComponentTypeId && !entityRecord.mIsDestroyed)
+        {
+            AddEntityToNameIndex(entityId);
+        }
         
-        OnEntityChanged(entityId, entityEntry.mMask);
+        OnEntityChanged(entityId, entityRecord.mMask);
     }
 
     /// Removes the component with the given type from the entity with the given entity id.
+    ///
+    /// As with AddComponent() the entity is moved to the chunk of its new archetype at the next sync point.
     /// @tparam ComponentType the derived component type class to remove from the entity.
     /// @param[in] entityId the entity with the respective id to check component ownership from.    
     template<class ComponentType>
@@ -260,21 +588,86 @@ public:
         assert(entityId != NULL_ENTITY_ID &&
             "Component removal from NULL_ENTITY_ID");
 
-        assert(mEntityComponentStore.count(entityId) != 0 &&
+        assert(HasEntity(entityId) &&
             "Entity does not exist in the world");
 
+#if !defined(NDEBUG)
+        ValidateStructuralChange();
+#endif
+        
         const auto componentTypeId = GetTypeHash<ComponentType>();
-        auto& entityEntry = mEntityComponentStore.at(entityId);
+        auto& entityRecord = GetEntityRecord(entityId);
         
         assert(componentTypeId < MAX_COMPONENTS && "Maximum amount of components exceeded");
         
-        assert(entityEntry.mComponents[componentTypeId] &&
+        assert(entityRecord.mMask.test(componentTypeId) &&
             "Component is not present in this entity's component store");
         
-        entityEntry.mComponents[componentTypeId] = nullptr;
-        entityEntry.mMask ^= 1LL << componentTypeId;
+        if (componentTypeId == mNameComponentTypeId && !entityRecord.mIsDestroyed)
+        {
+            RemoveEntityFromNameIndex(entityId);
+        }
+        
+        if (entityRecord.mArchetype->mColumnIndices[componentTypeId] == -1)
+        {
+            RemovePendingComponent(entityRecord, componentTypeId);
+        }
+        
+        entityRecord.mMask.reset(componentTypeId);
+        QueueEntityMigration(entityId, entityRecord);
+        QueueEntityRemovalCheck(entityId, entityRecord);
+        
+        OnEntityChanged(entityId, entityRecord.mMask);
+    }
+    
+    /// Invokes the given function for every archetype chunk whose entities have at least all of the given
+    /// component types, allowing linear sweeps over the chunks' component arrays.
+    ///
+    /// The function is invoked as chunkFunction(entities, entityCount, componentArrays...), with one array
+    /// of entityCount components per given component type, all in the same row order as the entity ids.
+    /// Chunks reflect the world as of the last sync point, like the entities handed to system updates.
+    /// @tparam UtilizedComponentTypes the component type classes that the chunks need to contain.
+    /// @param[in] chunkFunction the function to invoke with each matching chunk.
+    template<class... UtilizedComponentTypes, class ChunkFunctionType>
+    inline void ForEachChunk(ChunkFunctionType chunkFunction) const
+    {
+#if !defined(NDEBUG)
+        (ValidateComponentAccess(GetTypeHash<UtilizedComponentTypes>()), ...);
+#endif
         
-        OnEntityChanged(entityId, entityEntry.mMask);
+        const auto requiredComponentMask = CalculateComponentUsageMask<UtilizedComponentTypes...>();
+        for (const auto& archetype: mArchetypes)
+        {
+            if ((archetype->mComponentMask & requiredComponentMask) != requiredComponentMask)
+            {
+                continue;
+            }
+            
+            for (const auto& chunk: archetype->mChunks)
+            {
+                if (chunk->mEntityCount > 0)
+                {
+                    chunkFunction(chunk->GetEntities(), chunk->GetEntityCount(), chunk->template GetComponentArray<UtilizedComponentTypes>()...);
+                }
+            }
+        }
+    }
+    
+    /// Same as ForEachChunk(), but splits the matching chunks into batches that are swept as jobs, and
+    /// waits for all of them. The function therefore needs to be safe to invoke concurrently for different chunks.
+    /// @tparam UtilizedComponentTypes the component type classes that the chunks need to contain.
+    /// @param[in] chunkFunction the function to invoke with each matching chunk.
+    template<class... UtilizedComponentTypes, class ChunkFunctionType>
+    inline void ForEachChunkConcurrently(ChunkFunctionType chunkFunction) const
+    {
+#if !defined(NDEBUG)
+        (ValidateComponentAccess(GetTypeHash<UtilizedComponentTypes>()), ...);
+#endif
+        
+        SweepChunksConcurrently(CalculateComponentUsageMask<UtilizedComponentTypes...>(), [&chunkFunction](const ArchetypeChunk& chunk)
+        {
+            chunkFunction(chunk.GetEntities(), chunk.GetEntityCount(), chunk.template GetComponentArray<UtilizedComponentTypes>()...);
+        });
     }
     
     /// Get the registered singleton component with the given type.
@@ -288,6 +681,11 @@ public:
 
         const auto componentTypeId = GetTypeHash<ComponentType>();
         assert(componentTypeId < MAX_COMPONENTS && "Maximum amount of components exceeded");
+        
+#if !defined(NDEBUG)
+        ValidateComponentAccess(componentTypeId);
+#endif
+        
         return static_cast<ComponentType&>(*mSingletonComponents.at(componentTypeId));
     }
 
@@ -345,7 +743,7 @@ public:
     /// Calculates the bit mask of the given template arguments.
     /// @tparam FirstUtilizedComponentType a component's type class
     template<class FirstUtilizedComponentType>
-    [[nodiscard]] inline ComponentMask CalculateComponentUsageMask()
+    [[nodiscard]] inline ComponentMask CalculateComponentUsageMask() const
     {
         static_assert(std::is_base_of<IComponent, FirstUtilizedComponentType>::value,
             "Attempted to extract mask from class not derived from IComponent");
@@ -357,7 +755,7 @@ public:
     /// @tparam FirstUtilizedComponentType a component's type class
     /// @tparam SecondUtilizedComponentType a component's type class
     template<class FirstUtilizedComponentType, class SecondUtilizedComponentType, class ...RestUtilizedComponentTypes>
-    [[nodiscard]] inline ComponentMask CalculateComponentUsageMask()
+    [[nodiscard]] inline ComponentMask CalculateComponentUsageMask() const
     {
         static_assert(std::is_base_of<IComponent, FirstUtilizedComponentType>::value,
             "Attempted to extract mask from class not derived from IComponent");
@@ -370,48 +768,183 @@ public:
     
     /// Explicit specialization for NullComponent to return a full component mask.
     template<>
-    [[nodiscard]] inline ComponentMask CalculateComponentUsageMask<NullComponent>()
+    [[nodiscard]] inline ComponentMask CalculateComponentUsageMask<NullComponent>() const
     {
         return ~ComponentMask();
     }
 
+private:
+    struct SystemGraphNode
+    {
+        std::size_t mSystemIndex = 0;
+        const std::vector<EntityId>* mEntities = nullptr;
+        std::vector<std::size_t> mDependentNodeIndices;
+        std::atomic<int> mRemainingDependencyCount = 0;
+    };
+    
+    struct EntityRecord
+    {
+        Archetype* mArchetype = nullptr;
+        ArchetypeChunk* mChunk = nullptr;
+        std::size_t mRow = 0;
+        ComponentMask mMask;
+        std::vector<std::pair<ComponentTypeId, std::unique_ptr<IComponent>>> mPendingComponents;
+        bool mIsQueuedForMigration = false;
+        bool mIsQueuedForMembershipUpdate = false;
+        bool mIsQueuedForRemovalCheck = false;
+        bool mIsDestroyed = false;
+        std::uint32_t mGeneration = 0;
+    };
+    
 private:        
     /// Reserves space for the anticipated entity count.
     World();
 
-    /// Removes all entities with no components currently attached to them.
+    /// Hands out the id of a free slot, recycling the slots of removed entities first. Safe to call
+    /// concurrently, as long as no entities are being removed at the same time.
+    /// @returns the reserved entity id, to be passed to CreateEntityWithId().
+    EntityId ReserveEntityId();
+    
+    /// Creates an entity with the given, previously reserved, entity id.
+    EntityId CreateEntityWithId(const EntityId entityId);
+    
+    /// @returns the record of the given entity. Its id is expected to not be stale.
+    inline EntityRecord& GetEntityRecord(const EntityId entityId) { return mEntityRecords[GetEntityIndex(entityId)]; }
+    inline const EntityRecord& GetEntityRecord(const EntityId entityId) const { return mEntityRecords[GetEntityIndex(entityId)]; }
+    
+    /// Removes all destroyed entities, and all entities with no components currently attached to them,
+    /// out of the ones queued for a removal check since the last call. The slots of the removed entities
+    /// are freed up for recycling under their next generation.
     void RemoveEntitiesWithoutAnyComponents();
     
-    /// Adjusts the systems' entities to process accordingly
+    /// Applies the commands recorded in all threads' command buffers, then updates the system
+    /// membership of every entity they touched once.
+    void ApplyCommandBuffers();
+    
+    /// Moves all entities whose components changed since the last sync point to the chunks of their new archetypes.
+    void MigrateQueuedEntities();
+    
+    /// Moves the entity to the given archetype, relocating its existing components and adopting its pending ones.
+    /// @param[in] entityId the entity to move.
+    /// @param[in] entityRecord the record of the entity to move.
+    /// @param[in] targetArchetype the archetype to move the entity to.
+    void MigrateEntity(const EntityId entityId, EntityRecord& entityRecord, Archetype& targetArchetype);
+    
+    /// Releases the entity's chunk row, relocating whichever entity fills its place.
+    /// @param[in] entityRecord the record of the entity whose row to release.
+    void ReleaseEntityRow(const EntityRecord& entityRecord);
+    
+    /// Finds or creates the archetype for the given component mask.
+    /// @param[in] componentMask the component mask of the archetype.
+    /// @returns the archetype matching the given component mask.
+    Archetype& GetOrCreateArchetype(const ComponentMask& componentMask);
+    
+    /// Queues the entity for migration at the next sync point, if not already queued.
+    void QueueEntityMigration(const EntityId entityId, EntityRecord& entityRecord);
+    
+    /// Queues the entity to be checked for removal at the start of the next frame, if not already queued.
+    /// Only entities that were just created, destroyed or lost a component can end up without any components.
+    void QueueEntityRemovalCheck(const EntityId entityId, EntityRecord& entityRecord);
+    
+    /// @returns the component of the given type that was added to the entity since the last sync point.
+    IComponent& GetPendingComponent(const EntityRecord& entityRecord, const ComponentTypeId componentTypeId) const;
+    
+    /// Destroys the component of the given type that was added to the entity since the last sync point.
+    void RemovePendingComponent(EntityRecord& entityRecord, const ComponentTypeId componentTypeId);
+    
+    /// Invokes the given function for every non-empty chunk of the archetypes that contain the given
+    /// component mask, in batches run as jobs. @see ForEachChunkConcurrently()
+    void SweepChunksConcurrently(const ComponentMask& requiredComponentMask, const std::function<void(const ArchetypeChunk&)>& chunkFunction) const;
+    
+    /// Records the lifetime operations of the given component type the first time it is encountered.
+    template<class ComponentType>
+    inline void RegisterComponentType(const ComponentTypeId componentTypeId)
+    {
+        auto& componentTypeInfo = mComponentTypeInfos[componentTypeId];
+        if (componentTypeInfo.mSize != 0)
+        {
+            return;
+        }
+        
+        componentTypeInfo.mSize = sizeof(ComponentType);
+        componentTypeInfo.mMoveConstructFromSlot = [](void* destination, void* source)
+        {
+            new (destination) ComponentType(std::move(*static_cast<ComponentType*>(source)));
+        };
+        componentTypeInfo.mMoveConstructFromComponent = [](void* destination, IComponent& source)
+        {
+            new (destination) ComponentType(std::move(static_cast<ComponentType&>(source)));
+        };
+        componentTypeInfo.mDestruct = [](void* component)
+        {
+            static_cast<ComponentType*>(component)->~ComponentType();
+        };
+    }
+    
+    /// Adjusts the systems' entities to process accordingly. While command buffers are being applied,
+    /// the entity is queued instead, and adjusted once all commands have been applied.
     /// @param[in] entityId the entity that has changed
     /// @param[in] newComponentMask the new component mask of the entity
     void OnEntityChanged(const EntityId entityId, const ComponentMask& newComponentMask);
 
-    /// Callback for when a system update worker completes
-    void OnWorkerCompleteCallback();
+    /// @returns whether the system should be updated in the current context.
+    bool IsSystemActive(const ISystem& system) const;
+    
+    /// Updates the given system, splitting its entities into jobs if it operates multi-threaded.
+    void UpdateSystem(ISystem& system, const float dt, const std::vector<EntityId>& entitiesToProcess);
+    
+    /// Updates the systems gathered in mConcurrentSystemIndices as jobs. Each system waits for the earlier systems
+    /// of the group it conflicts with, so that the results match updating them in registration order.
+    void UpdateSystemsConcurrently(const float dt);
+    
+    /// Invokes the system's update, tracking the system being updated on this thread for access validation.
+    static void InvokeSystemUpdate(const ISystem& system, const float dt, const std::vector<EntityId>& entitiesToProcess);
+    
+#if !defined(NDEBUG)
+    /// Asserts that the system being updated on this thread, if updated concurrently, has declared access to the given component type.
+    void ValidateComponentAccess(const std::size_t componentTypeId) const;
+    
+    /// Asserts that the system being updated on this thread, if any, is not updated concurrently.
+    void ValidateStructuralChange() const;
+#endif
+    
+    /// Registers the entity under the name of its NameComponent.
+    void AddEntityToNameIndex(const EntityId entityId);
+    
+    /// Unregisters the entity from the name of its NameComponent.
+    void RemoveEntityFromNameIndex(const EntityId entityId);
     
 private:
-    struct EntityEntry
-    {
-        std::array<std::unique_ptr<IComponent>, MAX_COMPONENTS> mComponents;
-        ComponentMask mMask;
-    };
-
-    using EntityComponentStoreMap = tsl::robin_map<EntityId, EntityEntry, EntityIdHasher>;
     using ComponentMap = tsl::robin_map<ComponentTypeId, std::unique_ptr<IComponent>, ComponentTypeIdHasher>;
     
-    EntityComponentStoreMap mEntityComponentStore;
-    ComponentMap            mSingletonComponents;
+    std::vector<EntityRecord> mEntityRecords;
+    std::vector<std::uint32_t> mFreeEntityIndices;
+    std::atomic<long long> mFreeEntityIndicesCursor = 0LL;
+    std::atomic<std::uint32_t> mNextEntityIndex = 1U;
+    std::size_t mEntityCount = 0;
+    ComponentMap    mSingletonComponents;
+    
+    std::array<ComponentTypeInfo, MAX_COMPONENTS> mComponentTypeInfos;
+    std::vector<std::unique_ptr<Archetype>> mArchetypes;
+    std::unordered_map<ComponentMask, Archetype*> mComponentMaskToArchetype;
+    std::vector<EntityId> mEntitiesQueuedForMigration;
+    std::vector<EntityId> mEntitiesQueuedForRemovalCheck;
+    
+    std::vector<std::unique_ptr<EntityCommandBuffer>> mCommandBuffers;
+    std::mutex mCommandBuffersMutex;
+    std::vector<EntityId> mEntitiesQueuedForMembershipUpdate;
+    bool mIsApplyingCommandBuffers = false;
+    
+    tsl::robin_map<StringId, std::vector<EntityId>, StringIdHasher> mEntityNameIndex;
+    std::size_t mNameComponentTypeId;
                
     tsl::robin_map<StringId, long long, StringIdHasher> mSystemUpdateToDuration;
-    tsl::robin_map<std::type_index, std::vector<EntityId>> mEntitiesToUpdatePerSystem;
+    std::vector<EntitySparseSet> mEntitiesToUpdatePerSystem;
     
     std::vector<std::unique_ptr<ISystem>> mSystems;
-    std::vector<std::unique_ptr<SystemUpdateWorker>> mSystemUpdateWorkers;
+    std::vector<std::size_t> mConcurrentSystemIndices;
     
-    EntityId mEntityCounter = 1LL;
     int mCurrentContextId = 0;
-    std::atomic<int> mSystemUpdateWorkersComplete = 0;
 };
 
 ///------------------------------------------------------------------------------------------------
@@ -419,13 +952,43 @@ private:
 class ISystem
 {
     friend class World;
-    friend class SystemUpdateWorker;
 public:
     ISystem() = default;
     virtual ~ISystem() = default;
     ISystem(const ISystem&) = delete;
     const ISystem& operator = (const ISystem&) = delete;
     
+protected:
+    /// Declares the component types (singleton components included) that the system reads.
+    ///
+    /// Systems that declare their component access are updated concurrently with the neighbouring
+    /// systems they don't conflict with. Systems that declare nothing are always updated on their own.
+    /// @tparam ComponentTypes the component type classes read by the system.
+    template<class... ComponentTypes>
+    inline void DeclareReadAccess()
+    {
+        mReadComponentsMask |= World::GetInstance().CalculateComponentUsageMask<ComponentTypes...>();
+        mHasDeclaredComponentAccess = true;
+    }
+    
+    /// Declares the component types (singleton components included) that the system writes.
+    /// @tparam ComponentTypes the component type classes written by the system.
+    template<class... ComponentTypes>
+    inline void DeclareWriteAccess()
+    {
+        mWriteComponentsMask |= World::GetInstance().CalculateComponentUsageMask<ComponentTypes...>();
+        mHasDeclaredComponentAccess = true;
+    }
+    
+    /// Declares that the system creates or destroys entities, or adds or removes components,
+    /// in which case it is always updated on its own. Structural changes recorded through
+    /// World::GetCommandBuffer() are deferred to the next sync point and need not be declared.
+    inline void DeclareStructuralChanges()
+    {
+        mMakesStructuralChanges = true;
+        mHasDeclaredComponentAccess = true;
+    }
+    
 private:
     [[nodiscard]] virtual inline bool ShouldProcessComponentMask(const ComponentMask& componentMask) const = 0;
     
@@ -434,9 +997,25 @@ private:
     /// @param[in] entitiesToProcess the entities that match this system's signature (mask) and that should be processed
     virtual void VUpdate(const float dt, const std::vector<EntityId>& entitiesToProcess) const = 0;
     
+    /// @returns whether the system can be updated concurrently with the systems it does not conflict with.
+    inline bool CanRunConcurrently() const { return mHasDeclaredComponentAccess && !mMakesStructuralChanges; }
+    
+    /// @returns whether either system writes a component type accessed by the other.
+    inline bool ConflictsWith(const ISystem& other) const
+    {
+        return (mWriteComponentsMask & (other.mReadComponentsMask | other.mWriteComponentsMask)).any() ||
+               (other.mWriteComponentsMask & mReadComponentsMask).any();
+    }
+    
 private:
     StringId mSystemName;
+    ComponentMask mReadComponentsMask;
+    ComponentMask mWriteComponentsMask;
+    std::vector<std::vector<EntityId>> mEntityBatches;
+    long long mLastUpdateDurationMicros = 0;
     bool mMultithreadedOperation = false;
+    bool mHasDeclaredComponentAccess = false;
+    bool mMakesStructuralChanges = false;
     int mContextIdToOperateIn = 0;
 };
 
@@ -467,6 +1046,36 @@ private:
     
 };
 
+///------------------------------------------------------------------------------------------------
+
+template<class ComponentType>
+inline void EntityCommandBuffer::AddComponent(const EntityId entityId, std::unique_ptr<IComponent> component)
+{
+    assert(entityId != NULL_ENTITY_ID &&
+        "Component addition for NULL_ENTITY_ID");
+    
+    mCommands.push_back({ CommandType::ADD_COMPONENT, entityId, std::move(component), [](World& world, const EntityId entityId, std::unique_ptr<IComponent> component)
+    {
+        world.AddComponent<ComponentType>(entityId, std::move(component));
+    }});
+}
+
+///------------------------------------------------------------------------------------------------
+
+template<class ComponentType>
+inline void EntityCommandBuffer::RemoveComponent(const EntityId entityId)
+{
+    assert(entityId != NULL_ENTITY_ID &&
+        "Component removal from NULL_ENTITY_ID");
+    
+    mCommands.push_back({ CommandType::REMOVE_COMPONENT, entityId, nullptr, [](World& world, const EntityId entityId, std::unique_ptr<IComponent>)
+    {
+        world.RemoveComponent<ComponentType>(entityId);
+    }});
+}
+
+///------------------------------------------------------------------------------------------------
+
 }
 
 }
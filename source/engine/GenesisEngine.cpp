@@ -11,15 +11,18 @@
 #include "common/utils/MathUtils.h"
 #include "common/utils/OSMessageBox.h"
 #include "debug/DefaultEngineConsoleCommands.h"
+#include "debug/Profiler.h"
 #include "debug/utils/ConsoleCommandUtils.h"
 #include "debug/components/DebugViewStateSingletonComponent.h"
 #include "input/components/InputStateSingletonComponent.h"
 #include "input/components/InputStateSingletonComponent.h"
 #include "input/systems/RawInputHandlingSystem.h"
 #include "input/utils/InputUtils.h"
+#include "jobs/JobSystem.h"
 #include "rendering/components/RenderingContextSingletonComponent.h"
 #include "rendering/components/WindowSingletonComponent.h"
 #include "rendering/opengl/Context.h"
+#include "rendering/opengl/GLRenderDevice.h"
 #include "rendering/systems/RenderingSystem.h"
 #include "rendering/utils/FontUtils.h"
 #include "resources/ResourceLoadingService.h"
@@ -73,10 +76,14 @@ void GenesisEngine::RunGame(const GameStartupParameters& startupParameters, IGam
 
     while (!AppShouldQuit())
     {        
+        debug::Profiler::GetInstance().BeginFrame();
         UpdateFrameStatistics(dt, elapsedTicks, dtAccumulator, framesAccumulator);
         game.VOnUpdate(dt);
         ecs::World::GetInstance().Update(dt);
+        debug::Profiler::GetInstance().EndFrame();
     }
+    
+    jobs::JobSystem::GetInstance().Shutdown();
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -163,6 +170,10 @@ void GenesisEngine::InitializeSdlContextAndWindow(const GameStartupParameters& s
     glFuncTable.initialize();
 #endif
 
+    // Route all rendering commands to the context
+    renderingContextComponent->mRenderDevice = std::make_unique<rendering::GLRenderDevice>();
+    renderingContextComponent->mGLStateCache.SetRenderDevice(*renderingContextComponent->mRenderDevice);
+
     // Get actual render buffer width/height
     auto renderableWidth  = 0;
     auto renderableHeight = 0;
@@ -188,12 +199,12 @@ void GenesisEngine::InitializeSdlContextAndWindow(const GameStartupParameters& s
     SDL_free(cwdPath);
     
     // Configure Blending
-    GL_CHECK(glEnable(GL_BLEND));
-    GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    renderingContextComponent->mGLStateCache.SetBlendEnabled(true);
+    renderingContextComponent->mGLStateCache.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     
     // Configure Depth
-    GL_CHECK(glEnable(GL_DEPTH_TEST));
-    GL_CHECK(glDepthFunc(GL_LESS));
+    renderingContextComponent->mGLStateCache.SetDepthTestEnabled(true);
+    renderingContextComponent->mRenderDevice->VSetDepthFunc(GL_LESS);
     
     // Transfer ownership of singleton components to world
     ecs::World::GetInstance().SetSingletonComponent<rendering::RenderingContextSingletonComponent>(std::move(renderingContextComponent));
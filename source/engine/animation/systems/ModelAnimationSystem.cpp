@@ -27,7 +27,7 @@ namespace animation
 namespace
 {
     static const float ANIMATION_TRANSITION_TIME = 0.2f;
-    static const StringId BONES_UNIFORM_NAME     = StringId("bones");
+    static const rendering::UniformSlot BONES_UNIFORM_SLOT = rendering::GetUniformSlot(StringId("bones"));
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -35,78 +35,85 @@ namespace
 ModelAnimationSystem::ModelAnimationSystem()
     : BaseSystem()
 {
+    DeclareReadAccess<TransformComponent>();
+    DeclareWriteAccess<rendering::RenderableComponent>();
 }
 
 ///-----------------------------------------------------------------------------------------------
 
-void ModelAnimationSystem::VUpdate(const float dt, const std::vector<ecs::EntityId>& entitiesToProcess) const
+void ModelAnimationSystem::VUpdate(const float dt, const std::vector<ecs::EntityId>&) const
 {
-    const auto& world = ecs::World::GetInstance();
-    for (const auto& entityId : entitiesToProcess)
+    // Linear sweep over the renderables of every chunk, with the chunks spread across the job system's workers
+    ecs::World::GetInstance().ForEachChunkConcurrently<TransformComponent, rendering::RenderableComponent>([this, dt](const ecs::EntityId*, const std::size_t entityCount, const TransformComponent*, rendering::RenderableComponent* renderableComponents)
     {
-        auto& renderableComponent = world.GetComponent<rendering::RenderableComponent>(entityId);
-        if (renderableComponent.mMeshResourceIds.size() <= 0)
+        for (auto i = 0U; i < entityCount; ++i)
         {
-            continue;
+            UpdateSkeletalAnimation(dt, renderableComponents[i]);
         }
-        
-        if (!renderableComponent.mShouldAnimateSkeleton)
-        {
-            continue;
-        }
-        
-        const auto& currentMesh = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex]);
-        if (!currentMesh.HasSkeleton())
-        {
-            continue;
-        }
-        
-        glm::mat4 transform(1.0f);
-        
-        if (renderableComponent.mPreviousMeshResourceIndex != -1)
+    });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ModelAnimationSystem::UpdateSkeletalAnimation(const float dt, rendering::RenderableComponent& renderableComponent) const
+{
+    if (renderableComponent.mMeshResourceIds.size() <= 0)
+    {
+        return;
+    }
+    
+    if (!renderableComponent.mShouldAnimateSkeleton)
+    {
+        return;
+    }
+    
+    const auto& currentMesh = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex]);
+    if (!currentMesh.HasSkeleton())
+    {
+        return;
+    }
+    
+    glm::mat4 transform(1.0f);
+    
+    if (renderableComponent.mPreviousMeshResourceIndex != -1)
+    {
+        renderableComponent.mTransitionAnimationTimeAccum += dt;
+        if (renderableComponent.mTransitionAnimationTimeAccum >= ANIMATION_TRANSITION_TIME)
         {
-            renderableComponent.mTransitionAnimationTimeAccum += dt;
-            if (renderableComponent.mTransitionAnimationTimeAccum >= ANIMATION_TRANSITION_TIME)
-            {
-                // Transition to next anim finished
-                renderableComponent.mPreviousMeshResourceIndex = -1;
-                renderableComponent.mTransitionAnimationTimeAccum = 0.0f;
-                renderableComponent.mAnimationTimeAccum = 0.0f;
-            }
-            else
-            {
-                // Transition to next anim ongoing
-                const auto& previousMesh = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mPreviousMeshResourceIndex]);
-                
-                const auto transitionAnimationTime = std::fmod(renderableComponent.mTransitionAnimationTimeAccum, ANIMATION_TRANSITION_TIME);
-                const auto previousAnimationTime = std::fmod(renderableComponent.mAnimationTimeAccum, previousMesh.GetAnimationInfo().mDuration);
-                
-                CalculateTransitionalTransformsInHierarchy(previousAnimationTime, transitionAnimationTime, currentMesh.GetRootSkeletonNode(), transform, previousMesh, currentMesh, renderableComponent);
-            }
+            // Transition to next anim finished
+            renderableComponent.mPreviousMeshResourceIndex = -1;
+            renderableComponent.mTransitionAnimationTimeAccum = 0.0f;
+            renderableComponent.mAnimationTimeAccum = 0.0f;
         }
         else
         {
-            // Current anim playing
-            const auto& animationInfo = currentMesh.GetAnimationInfo();
+            // Transition to next anim ongoing
+            const auto& previousMesh = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mPreviousMeshResourceIndex]);
             
-            renderableComponent.mAnimationTimeAccum += renderableComponent.mAnimationSpeed * dt;
-            if (renderableComponent.mAnimationTimeAccum >= animationInfo.mDuration && renderableComponent.mIsLoopingAnimation == false)
-            {
-                renderableComponent.mAnimationTimeAccum = animationInfo.mDuration - 0.0001f;
-                renderableComponent.mShouldAnimateSkeleton = false;
-            }
+            const auto transitionAnimationTime = std::fmod(renderableComponent.mTransitionAnimationTimeAccum, ANIMATION_TRANSITION_TIME);
+            const auto previousAnimationTime = std::fmod(renderableComponent.mAnimationTimeAccum, previousMesh.GetAnimationInfo().mDuration);
             
-            const auto animationTime = std::fmod(renderableComponent.mAnimationTimeAccum, animationInfo.mDuration);
-            
-            CalculateTransformsInHierarchy(animationTime, currentMesh.GetRootSkeletonNode(), transform, currentMesh, renderableComponent);
+            CalculateTransitionalTransformsInHierarchy(previousAnimationTime, transitionAnimationTime, currentMesh.GetRootSkeletonNode(), transform, previousMesh, currentMesh, renderableComponent);
         }
+    }
+    else
+    {
+        // Current anim playing
+        const auto& animationInfo = currentMesh.GetAnimationInfo();
         
-        const auto nBones = currentMesh.GetBoneOffsetMatrices().size();
-        for (auto i = 0U; i < nBones; ++i)
+        renderableComponent.mAnimationTimeAccum += renderableComponent.mAnimationSpeed * dt;
+        if (renderableComponent.mAnimationTimeAccum >= animationInfo.mDuration && renderableComponent.mIsLoopingAnimation == false)
         {
-            renderableComponent.mShaderUniforms.mShaderMatrixArrayUniforms[BONES_UNIFORM_NAME][i] = renderableComponent.mBoneTransformMatrices[i];
+            renderableComponent.mAnimationTimeAccum = animationInfo.mDuration - 0.0001f;
+            renderableComponent.mShouldAnimateSkeleton = false;
         }
+        
+        const auto animationTime = std::fmod(renderableComponent.mAnimationTimeAccum, animationInfo.mDuration);
+        
+        CalculateTransformsInHierarchy(animationTime, currentMesh.GetRootSkeletonNode(), transform, currentMesh, renderableComponent);
     }
+    
+    renderableComponent.mShaderUniforms.SetMatrixArray(BONES_UNIFORM_SLOT, renderableComponent.mBoneTransformMatrices);
 }
 
 ///-----------------------------------------------------------------------------------------------
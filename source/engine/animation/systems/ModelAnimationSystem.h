@@ -37,6 +37,8 @@ namespace animation
 
 ///-----------------------------------------------------------------------------------------------
 
+/// Advances the skeletal animations of all renderables. Sweeps the world's archetype chunks across the
+/// job system's workers itself, so it should be added to the world in single threaded operation mode.
 class ModelAnimationSystem final: public ecs::BaseSystem<TransformComponent, rendering::RenderableComponent>
 {
 public:
@@ -45,6 +47,7 @@ public:
     void VUpdate(const float dt, const std::vector<ecs::EntityId>&) const override;
     
 private:
+    void UpdateSkeletalAnimation(const float dt, rendering::RenderableComponent& renderableComponent) const;
     void CalculateTransitionalTransformsInHierarchy(const float previousAnimationTime, const float transitionAnimationTime, const resources::SkeletonNode* node, const glm::mat4& parentTransform, const resources::MeshResource& previousMeshResource, const resources::MeshResource& currentMeshResource, rendering::RenderableComponent& renderableComponent) const;
     void CalculateTransformsInHierarchy(const float animationTime, const resources::SkeletonNode* node, const glm::mat4& parentTransform, const resources::MeshResource& meshResource, rendering::RenderableComponent& renderableComponent) const;
 };
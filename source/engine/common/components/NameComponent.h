@@ -26,7 +26,13 @@ public:
     NameComponent() = default;
     NameComponent(const StringId& name) : mName(name) {}
 
-public:
+    const StringId& GetName() const { return mName; }
+
+private:
+    // Only renamed through ecs::World::ChangeEntityName, so that
+    // the world's entity name index stays in sync with the name.
+    friend class ecs::World;
+    
     StringId mName = StringId();
 };
 
@@ -27,6 +27,14 @@ public:
     glm::vec3 mRotation = glm::vec3(0.0f, 0.0f, 0.0f);
     glm::vec3 mScale    = glm::vec3(1.0f, 1.0f, 1.0f);
     
+    // World and rotation matrices, recalculated once per frame by the TransformUpdaterSystem
+    // whenever the position, rotation or scale above have changed (or the dirty flag is raised)
+    glm::mat4 mWorldMatrix              = glm::mat4(1.0f);
+    glm::mat4 mRotationMatrix           = glm::mat4(1.0f);
+    glm::vec3 mWorldMatrixPosition      = glm::vec3(0.0f, 0.0f, 0.0f);
+    glm::vec3 mWorldMatrixRotation      = glm::vec3(0.0f, 0.0f, 0.0f);
+    glm::vec3 mWorldMatrixScale         = glm::vec3(1.0f, 1.0f, 1.0f);
+    bool mWorldMatrixDirty              = true;
 };
 
 ///-----------------------------------------------------------------------------------------------
@@ -0,0 +1,60 @@
+///------------------------------------------------------------------------------------------------
+///  TransformUpdaterSystem.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "TransformUpdaterSystem.h"
+#include "../components/TransformComponent.h"
+#include "../utils/MathUtils.h"
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+TransformUpdaterSystem::TransformUpdaterSystem()
+    : BaseSystem()
+{
+    DeclareWriteAccess<TransformComponent>();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void TransformUpdaterSystem::VUpdate(const float, const std::vector<ecs::EntityId>& entitiesToProcess) const
+{
+    const auto& world = ecs::World::GetInstance();
+    for (const auto& entityId: entitiesToProcess)
+    {
+        auto& transformComponent = world.GetComponent<TransformComponent>(entityId);
+        
+        // Transforms are written to directly all over the place, so changes are detected against the values the matrices were calculated from
+        if
+        (
+            !transformComponent.mWorldMatrixDirty &&
+            transformComponent.mWorldMatrixPosition == transformComponent.mPosition &&
+            transformComponent.mWorldMatrixRotation == transformComponent.mRotation &&
+            transformComponent.mWorldMatrixScale == transformComponent.mScale
+        )
+        {
+            continue;
+        }
+        
+        transformComponent.mRotationMatrix = glm::mat4_cast(math::EulerAnglesToQuat(transformComponent.mRotation));
+        transformComponent.mWorldMatrix    = glm::scale(glm::translate(glm::mat4(1.0f), transformComponent.mPosition) * transformComponent.mRotationMatrix, transformComponent.mScale);
+        
+        transformComponent.mWorldMatrixPosition = transformComponent.mPosition;
+        transformComponent.mWorldMatrixRotation = transformComponent.mRotation;
+        transformComponent.mWorldMatrixScale    = transformComponent.mScale;
+        transformComponent.mWorldMatrixDirty    = false;
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
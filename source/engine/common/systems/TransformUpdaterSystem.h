@@ -0,0 +1,41 @@
+///------------------------------------------------------------------------------------------------
+///  TransformUpdaterSystem.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef TransformUpdaterSystem_h
+#define TransformUpdaterSystem_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../ECS.h"
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+class TransformComponent;
+
+///-----------------------------------------------------------------------------------------------
+/// Recalculates the cached world matrices of all transforms that changed since the last frame.
+/// Needs to be updated after all systems moving entities around, and before rendering.
+class TransformUpdaterSystem final: public ecs::BaseSystem<TransformComponent>
+{
+public:
+    TransformUpdaterSystem();
+    
+    void VUpdate(const float dt, const std::vector<ecs::EntityId>&) const override;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* TransformUpdaterSystem_h */
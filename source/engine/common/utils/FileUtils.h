@@ -16,6 +16,7 @@
 
 #ifndef _WIN32
 #include <dirent.h>   // DIR, dirent, opendir, readdir, closedir
+#include <sys/stat.h> // mkdir
 #else
 #include <filesystem> // directory_iterator
 #endif
@@ -122,6 +123,22 @@ inline std::vector<std::string> GetAllFilenamesInDirectory(const std::string& di
     return fileNames;
 }
 
+///-----------------------------------------------------------------------------------------------
+/// Creates the given directory, if it does not already exist. Its parent directory needs to exist.
+/// @param[in] directory the directory to create.
+/// @returns whether the directory exists after this call.
+inline bool MakeDirectory(const std::string& directory)
+{
+#ifndef _WIN32
+    struct stat directoryStat;
+    return mkdir(directory.c_str(), 0755) == 0 || (stat(directory.c_str(), &directoryStat) == 0 && S_ISDIR(directoryStat.st_mode));
+#else
+    std::error_code errorCode;
+    std::filesystem::create_directory(directory, errorCode);
+    return std::filesystem::is_directory(directory, errorCode);
+#endif
+}
+
 ///-----------------------------------------------------------------------------------------------
 
 #endif /* FileUtils_h */
@@ -6,11 +6,15 @@
 ///------------------------------------------------------------------------------------------------
 
 #include "DefaultEngineConsoleCommands.h"
+#include "Profiler.h"
 #include "components/DebugViewStateSingletonComponent.h"
 #include "utils/ConsoleCommandUtils.h"
 #include "../common/components/TransformComponent.h"
 #include "../rendering/components/RenderingContextSingletonComponent.h"
+#include "../rendering/components/RenderStatsSingletonComponent.h"
+#include "../rendering/utils/RenderStatsUtils.h"
 
+#include <charconv>
 #include <unordered_set>
 
 ///------------------------------------------------------------------------------------------------
@@ -25,6 +29,12 @@ namespace debug
 
 ///------------------------------------------------------------------------------------------------
 
+#if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)
+static bool TryParseFrameCount(const std::string& frameCountString, int& outFrameCount);
+#endif
+
+///------------------------------------------------------------------------------------------------
+
 void RegisterDefaultEngineConsoleCommands()
 {
 #if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)    
@@ -80,6 +90,25 @@ void RegisterDefaultEngineConsoleCommands()
         return debug::ConsoleCommandResult(true);
     });
 
+    debug::RegisterConsoleCommand(StringId("profile"), [](const std::vector<std::string>& commandTextComponents)
+    {
+        static const std::string DEFAULT_TRACE_FILE_NAME = "profile_trace.json";
+        
+        const std::string USAGE_STRING = "Usage: profile frame_count [trace_file_name]";
+
+        auto frameCount = 0;
+        if (commandTextComponents.size() < 2 || commandTextComponents.size() > 3 || !TryParseFrameCount(commandTextComponents[1], frameCount))
+        {
+            return debug::ConsoleCommandResult(false, USAGE_STRING);
+        }
+
+        const auto traceFileName = commandTextComponents.size() == 3 ? commandTextComponents[2] : DEFAULT_TRACE_FILE_NAME;
+        
+        Profiler::GetInstance().CaptureFrames(frameCount, traceFileName);
+
+        return debug::ConsoleCommandResult(true, "Capturing " + std::to_string(frameCount) + " frames to " + traceFileName);
+    });
+
     debug::RegisterConsoleCommand(StringId("lights_debug"), [](const std::vector<std::string>& commandTextComponents)
     {
         static const std::unordered_set<std::string> sAllowedOptions = { "on", "off" };
@@ -137,6 +166,76 @@ void RegisterDefaultEngineConsoleCommands()
         return debug::ConsoleCommandResult(true);
     });
     
+    debug::RegisterConsoleCommand(StringId("occlusion_culling"), [](const std::vector<std::string>& commandTextComponents)
+    {
+        static const std::unordered_set<std::string> sAllowedOptions = { "on", "off" };
+
+        const std::string USAGE_STRING = "Usage: occlusion_culling on|off";
+
+        if (commandTextComponents.size() != 2 || sAllowedOptions.count(StringToLower(commandTextComponents[1])) == 0)
+        {
+            return debug::ConsoleCommandResult(false, USAGE_STRING);
+        }
+
+        const auto& world = ecs::World::GetInstance();
+        auto& renderingContextComponent = world.GetSingletonComponent<rendering::RenderingContextSingletonComponent>();
+
+        renderingContextComponent.mOcclusionCullingEnabled = StringToLower(commandTextComponents[1]) == "on";
+
+        return debug::ConsoleCommandResult(true);
+    });
+    
+    debug::RegisterConsoleCommand(StringId("gl_state_stats"), [](const std::vector<std::string>& commandTextComponents)
+    {
+        const std::string USAGE_STRING = "Usage: gl_state_stats";
+
+        if (commandTextComponents.size() != 1)
+        {
+            return debug::ConsoleCommandResult(false, USAGE_STRING);
+        }
+
+        const auto& world = ecs::World::GetInstance();
+        const auto& renderingContextComponent = world.GetSingletonComponent<rendering::RenderingContextSingletonComponent>();
+        const auto& glStateCacheStats = renderingContextComponent.mGLStateCache.GetLastFrameStats();
+
+        return debug::ConsoleCommandResult(true, "Last frame GL state calls issued: " + std::to_string(glStateCacheStats.mIssuedCallCount) + ", elided: " + std::to_string(glStateCacheStats.mElidedCallCount));
+    });
+    
+    debug::RegisterConsoleCommand(StringId("render_stats"), [](const std::vector<std::string>& commandTextComponents)
+    {
+        static const std::string DEFAULT_CSV_FILE_NAME = "render_stats.csv";
+        
+        const std::string USAGE_STRING = "Usage: render_stats [csv_frame_count [csv_file_name]]";
+
+        auto frameCount = 0;
+        if (commandTextComponents.size() > 3 || (commandTextComponents.size() > 1 && !TryParseFrameCount(commandTextComponents[1], frameCount)))
+        {
+            return debug::ConsoleCommandResult(false, USAGE_STRING);
+        }
+
+        const auto& world = ecs::World::GetInstance();
+        auto& renderStatsComponent = world.GetSingletonComponent<rendering::RenderStatsSingletonComponent>();
+        
+        // Log the given number of frames to a CSV file
+        if (commandTextComponents.size() > 1)
+        {
+            const auto csvFileName = commandTextComponents.size() == 3 ? commandTextComponents[2] : DEFAULT_CSV_FILE_NAME;
+            
+            rendering::CaptureRenderStatsToCsv(renderStatsComponent, frameCount, csvFileName);
+            
+            return debug::ConsoleCommandResult(true, "Logging render stats of " + std::to_string(frameCount) + " frames to " + csvFileName);
+        }
+        
+        // Otherwise dump the last frame's stats
+        std::string output = "Last frame render stats:\n";
+        for (auto i = 0U; i < renderStatsComponent.mLastFrameStats.size(); ++i)
+        {
+            output += rendering::GetRenderPassName(static_cast<rendering::RenderPass>(i)) + ": " + rendering::GetRenderPassStatsSummary(renderStatsComponent.mLastFrameStats[i]) + '\n';
+        }
+
+        return debug::ConsoleCommandResult(true, output);
+    });
+    
     debug::RegisterConsoleCommand(StringId("move_entity_by"), [](const std::vector<std::string>& commandTextComponents)
     {
         const std::string USAGE_STRING = "Usage: move_entity_by \"entity_name\" dx dy dz";
@@ -536,6 +635,18 @@ void RegisterDefaultEngineConsoleCommands()
 
 ///------------------------------------------------------------------------------------------------
 
+#if !defined(NDEBUG) || defined(CONSOLE_ENABLED_ON_RELEASE)
+bool TryParseFrameCount(const std::string& frameCountString, int& outFrameCount)
+{
+    // Unlike std::stoi this does not throw on counts out of the int range, and rejects trailing characters
+    const auto* frameCountStringEnd = frameCountString.data() + frameCountString.size();
+    const auto parseResult = std::from_chars(frameCountString.data(), frameCountStringEnd, outFrameCount);
+    return parseResult.ec == std::errc() && parseResult.ptr == frameCountStringEnd && outFrameCount > 0;
+}
+#endif
+
+///------------------------------------------------------------------------------------------------
+
 }
 }
 
@@ -0,0 +1,180 @@
+///------------------------------------------------------------------------------------------------
+///  Profiler.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "Profiler.h"
+#include "../common/utils/Logging.h"
+
+#include <chrono>
+#include <fstream>
+#include <json.hpp>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace debug
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const char* FRAME_ZONE_NAME = "Frame";
+
+    const double NANOS_PER_MICRO = 1000.0;
+}
+
+///------------------------------------------------------------------------------------------------
+
+thread_local Profiler::ThreadZoneBuffer* Profiler::sThreadZoneBuffer = nullptr;
+
+///------------------------------------------------------------------------------------------------
+
+Profiler& Profiler::GetInstance()
+{
+    static Profiler instance;
+    return instance;
+}
+
+///------------------------------------------------------------------------------------------------
+
+long long Profiler::GetTimestampNanos()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::CaptureFrames(const int frameCount, const std::string& traceFilePath)
+{
+    mRequestedFrameCount = frameCount;
+    mCapturedFrameCount = 0;
+    mTraceFilePath = traceFilePath;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::BeginFrame()
+{
+    mFrameStartNanos = GetTimestampNanos();
+
+    if (mRequestedFrameCount > 0 && !IsCapturing())
+    {
+        std::lock_guard<std::mutex> threadZoneBuffersLock(mThreadZoneBuffersMutex);
+        for (auto& threadZoneBuffer: mThreadZoneBuffers)
+        {
+            threadZoneBuffer->mZoneEvents.clear();
+        }
+
+        mCaptureStartNanos = mFrameStartNanos;
+        mIsCapturing = true;
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::EndFrame()
+{
+    if (!IsCapturing())
+    {
+        return;
+    }
+
+    RecordZone(FRAME_ZONE_NAME, nullptr, mFrameStartNanos, GetTimestampNanos());
+
+    if (++mCapturedFrameCount >= mRequestedFrameCount)
+    {
+        mIsCapturing = false;
+        mRequestedFrameCount = 0;
+        WriteTraceFile();
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::RecordZone(const char* name, const std::string* detail, const long long startNanos, const long long endNanos)
+{
+    GetOrCreateThreadZoneBuffer().mZoneEvents.push_back(ZoneEvent{name, detail ? *detail : std::string(), startNanos, endNanos});
+}
+
+///------------------------------------------------------------------------------------------------
+
+Profiler::ThreadZoneBuffer& Profiler::GetOrCreateThreadZoneBuffer()
+{
+    // Each thread only ever appends to its own buffer, so recording needs no
+    // synchronization past the first zone of the thread
+    if (sThreadZoneBuffer == nullptr)
+    {
+        std::lock_guard<std::mutex> threadZoneBuffersLock(mThreadZoneBuffersMutex);
+        mThreadZoneBuffers.push_back(std::make_unique<ThreadZoneBuffer>());
+        mThreadZoneBuffers.back()->mThreadIndex = static_cast<int>(mThreadZoneBuffers.size());
+        sThreadZoneBuffer = mThreadZoneBuffers.back().get();
+    }
+
+    return *sThreadZoneBuffer;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void Profiler::WriteTraceFile() const
+{
+    nlohmann::json traceEvents = nlohmann::json::array();
+
+    for (const auto& threadZoneBuffer: mThreadZoneBuffers)
+    {
+        nlohmann::json threadNameEvent;
+        threadNameEvent["name"] = "thread_name";
+        threadNameEvent["ph"] = "M";
+        threadNameEvent["pid"] = 1;
+        threadNameEvent["tid"] = threadZoneBuffer->mThreadIndex;
+        threadNameEvent["args"]["name"] = "Thread " + std::to_string(threadZoneBuffer->mThreadIndex);
+        traceEvents.push_back(std::move(threadNameEvent));
+
+        for (const auto& zoneEvent: threadZoneBuffer->mZoneEvents)
+        {
+            nlohmann::json traceEvent;
+            traceEvent["name"] = zoneEvent.mName;
+            traceEvent["ph"] = "X";
+            traceEvent["pid"] = 1;
+            traceEvent["tid"] = threadZoneBuffer->mThreadIndex;
+            traceEvent["ts"] = (zoneEvent.mStartNanos - mCaptureStartNanos)/NANOS_PER_MICRO;
+            traceEvent["dur"] = (zoneEvent.mEndNanos - zoneEvent.mStartNanos)/NANOS_PER_MICRO;
+
+            if (!zoneEvent.mDetail.empty())
+            {
+                traceEvent["args"]["detail"] = zoneEvent.mDetail;
+            }
+
+            traceEvents.push_back(std::move(traceEvent));
+        }
+    }
+
+    nlohmann::json traceFileRoot;
+    traceFileRoot["traceEvents"] = std::move(traceEvents);
+    traceFileRoot["displayTimeUnit"] = "ms";
+
+    std::ofstream traceFile(mTraceFilePath);
+    if (!traceFile)
+    {
+        Log(LogType::ERROR, "Could not write profiler trace to %s", mTraceFilePath.c_str());
+        return;
+    }
+
+    traceFile << traceFileRoot.dump();
+    Log(LogType::INFO, "Profiler trace of %d frames written to %s", mCapturedFrameCount, mTraceFilePath.c_str());
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,146 @@
+///------------------------------------------------------------------------------------------------
+///  Profiler.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef Profiler_h
+#define Profiler_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace debug
+{
+
+///------------------------------------------------------------------------------------------------
+/// A CPU profiler capturing the zones recorded over a range of frames and exporting them as
+/// a Chrome trace_event JSON file (viewable in chrome://tracing or Perfetto). Zones nest
+/// according to their scopes on each thread.
+class Profiler final
+{
+public:
+    /// The default method of getting a hold of this singleton.
+    ///
+    /// The single instance of this class will be lazily initialized
+    /// the first time it is needed.
+    /// @returns a reference to the single instance of this class.
+    static Profiler& GetInstance();
+
+    ~Profiler() = default;
+    Profiler(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    const Profiler& operator = (const Profiler&) = delete;
+    Profiler& operator = (Profiler&&) = delete;
+
+    /// @returns the current time of the profiler's monotonic clock in nanoseconds.
+    static long long GetTimestampNanos();
+
+    /// Captures the zones recorded over the next frames and writes them to the given trace file once done.
+    /// @param[in] frameCount the number of frames to capture.
+    /// @param[in] traceFilePath the path of the Chrome trace_event JSON file to write.
+    void CaptureFrames(const int frameCount, const std::string& traceFilePath);
+
+    /// @returns whether zones are currently being captured.
+    inline bool IsCapturing() const { return mIsCapturing.load(std::memory_order_relaxed); }
+
+    /// Marks the start of a frame. To be called by the engine.
+    void BeginFrame();
+
+    /// Marks the end of a frame, writing the trace file if the requested frames have been captured. To be called by the engine.
+    void EndFrame();
+
+    /// Records a finished zone in the calling thread's buffer.
+    /// @param[in] name the name of the zone. Needs to outlive the capture.
+    /// @param[in] detail (optional) additional information about this particular zone instance.
+    /// @param[in] startNanos the start timestamp of the zone.
+    /// @param[in] endNanos the end timestamp of the zone.
+    void RecordZone(const char* name, const std::string* detail, const long long startNanos, const long long endNanos);
+
+private:
+    struct ZoneEvent
+    {
+        const char* mName;
+        std::string mDetail;
+        long long mStartNanos;
+        long long mEndNanos;
+    };
+
+    struct ThreadZoneBuffer
+    {
+        std::vector<ZoneEvent> mZoneEvents;
+        int mThreadIndex;
+    };
+
+private:
+    Profiler() = default;
+
+    ThreadZoneBuffer& GetOrCreateThreadZoneBuffer();
+    void WriteTraceFile() const;
+
+private:
+    static thread_local ThreadZoneBuffer* sThreadZoneBuffer;
+    
+    std::vector<std::unique_ptr<ThreadZoneBuffer>> mThreadZoneBuffers;
+    std::mutex mThreadZoneBuffersMutex;
+    std::string mTraceFilePath;
+    std::atomic<bool> mIsCapturing = false;
+    long long mCaptureStartNanos = 0;
+    long long mFrameStartNanos = 0;
+    int mRequestedFrameCount = 0;
+    int mCapturedFrameCount = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// Records the lifetime of its scope as a profiler zone, if a capture is in progress.
+class ProfilerZone final
+{
+public:
+    /// @param[in] name the name of the zone. Needs to outlive the capture, e.g. a string literal.
+    /// @param[in] detail (optional) additional information about this zone instance, copied only while capturing.
+    explicit ProfilerZone(const char* name, const std::string* detail = nullptr)
+        : mName(name)
+        , mDetail(detail)
+        , mStartNanos(Profiler::GetInstance().IsCapturing() ? Profiler::GetTimestampNanos() : -1)
+    {
+    }
+
+    ~ProfilerZone()
+    {
+        if (mStartNanos >= 0)
+        {
+            Profiler::GetInstance().RecordZone(mName, mDetail, mStartNanos, Profiler::GetTimestampNanos());
+        }
+    }
+
+    ProfilerZone(const ProfilerZone&) = delete;
+    const ProfilerZone& operator = (const ProfilerZone&) = delete;
+
+private:
+    const char* mName;
+    const std::string* mDetail;
+    const long long mStartNanos;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* Profiler_h */
@@ -32,6 +32,7 @@ class DebugViewStateSingletonComponent final: public ecs::IComponent
 public:
     std::vector<std::pair<ecs::EntityId, ecs::EntityId>> mSystemNamesAndUpdateTimeStrings;    
     std::vector<ecs::EntityId> mDebugLightEntities;
+    std::vector<ecs::EntityId> mRenderStatsStrings;
     std::pair<ecs::EntityId, ecs::EntityId> mFpsStrings;
     std::pair<ecs::EntityId, ecs::EntityId> mEntityCountStrings;
 
@@ -36,7 +36,8 @@ namespace
 
     static const StringId CONSOLE_TEXT_FONT_NAME          = StringId("console_font");
     static const StringId CONSOLE_BACKGROUND_ENTITY_NAME  = StringId("console_background");
-    static const StringId CONSOLE_OPAQUENESS_UNIFORM_NAME = StringId("opaqueness");
+    
+    static const rendering::UniformSlot CONSOLE_OPAQUENESS_UNIFORM_SLOT = rendering::GetUniformSlot(StringId("opaqueness"));
 
     static const float CONSOLE_TEXT_SIZE       = 0.1f;
     static const float CONSOLE_DARKENING_SPEED = 0.1f;
@@ -176,7 +177,7 @@ void ConsoleManagementSystem::HandleConsoleBackgroundAnimation() const
     if (consoleBackgroundEntity != ecs::NULL_ENTITY_ID)
     {
         auto& consoleBackgroundRenderableComponent = ecs::World::GetInstance().GetComponent<rendering::RenderableComponent>(consoleBackgroundEntity);
-        consoleBackgroundRenderableComponent.mShaderUniforms.mShaderFloatUniforms[CONSOLE_OPAQUENESS_UNIFORM_NAME] = consoleStateComponent.mBackgroundOpaqueness;
+        consoleBackgroundRenderableComponent.mShaderUniforms.SetFloat(CONSOLE_OPAQUENESS_UNIFORM_SLOT, consoleStateComponent.mBackgroundOpaqueness);
     }
 }
 
@@ -11,8 +11,10 @@
 #include "../../common/utils/ColorUtils.h"
 #include "../../rendering/components/LightStoreSingletonComponent.h"
 #include "../../rendering/components/RenderableComponent.h"
+#include "../../rendering/components/RenderStatsSingletonComponent.h"
 #include "../../rendering/utils/FontUtils.h"
 #include "../../rendering/utils/MeshUtils.h"
+#include "../../rendering/utils/RenderStatsUtils.h"
 
 ///-----------------------------------------------------------------------------------------------
 
@@ -34,6 +36,7 @@ namespace
     static const glm::vec3 ENTITY_COUNT_NUMBER_POSITION         = glm::vec3(0.75f, 0.7f, 0.0f);
     static const glm::vec3 SYSTEM_NAMES_STARTING_POSITION       = glm::vec3(-0.3f, 0.6f, 0.0f);
     static const glm::vec3 SYSTEM_UPDATE_TIME_STARTING_POSITION = glm::vec3(0.6f, 0.6f, 0.0f);
+    static const glm::vec3 RENDER_STATS_STARTING_POSITION       = glm::vec3(-0.95f, 0.6f, 0.0f);
     static const glm::vec3 DEBUG_LIGHT_SCALE                    = glm::vec3(0.1f, 0.1f, 0.1f);
 
     static const StringId TEXT_FONT_NAME         = StringId("console_font");
@@ -78,6 +81,7 @@ void DebugViewManagementSystem::HandleFrameStatsDisplay() const
             RenderFpsString();
             RenderEntityCountString();
             RenderSystemUpdateStrings();
+            RenderRenderStatsStrings();
         }                   
     }
     else
@@ -146,6 +150,12 @@ void DebugViewManagementSystem::ClearFrameStatsStrings() const
 
         debugViewStateComponent.mSystemNamesAndUpdateTimeStrings.clear();
     }
+    
+    if (debugViewStateComponent.mRenderStatsStrings.size() > 0)
+    {
+        world.DestroyEntities(debugViewStateComponent.mRenderStatsStrings);
+        debugViewStateComponent.mRenderStatsStrings.clear();
+    }
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -288,6 +298,41 @@ void DebugViewManagementSystem::RenderSystemUpdateStrings() const
 
 ///-----------------------------------------------------------------------------------------------
 
+void DebugViewManagementSystem::RenderRenderStatsStrings() const
+{
+    const auto& world = ecs::World::GetInstance();
+    const auto& renderStatsComponent = world.GetSingletonComponent<rendering::RenderStatsSingletonComponent>();
+    auto& debugViewStateComponent = world.GetSingletonComponent<debug::DebugViewStateSingletonComponent>();
+    
+    // Two lines per render pass, to fit next to the system update times
+    std::vector<std::string> renderStatsLines;
+    for (auto i = 0U; i < renderStatsComponent.mLastFrameStats.size(); ++i)
+    {
+        const auto& passStats = renderStatsComponent.mLastFrameStats[i];
+        renderStatsLines.push_back(rendering::GetRenderPassName(static_cast<rendering::RenderPass>(i)) + ": " + std::to_string(passStats.mDrawCallCount) + " draws " + std::to_string(passStats.mPrimitiveCount) + " prims");
+        renderStatsLines.push_back("  " + std::to_string(passStats.mProgramSwitchCount) + " progs " + std::to_string(passStats.mTextureBindCount) + " texs " + std::to_string(passStats.mUploadedBufferBytes / 1024) + " KB " + std::to_string(passStats.mCulledEntityCount) + " culled");
+    }
+    
+    debugViewStateComponent.mRenderStatsStrings.resize(renderStatsLines.size(), ecs::NULL_ENTITY_ID);
+    for (auto i = 0U; i < renderStatsLines.size(); ++i)
+    {
+        auto renderStatsLinePosition = RENDER_STATS_STARTING_POSITION;
+        renderStatsLinePosition.y -= i * TEXT_SIZE;
+        
+        debugViewStateComponent.mRenderStatsStrings[i] = rendering::RenderTextIfDifferentToPreviousString
+        (
+            renderStatsLines[i],
+            debugViewStateComponent.mRenderStatsStrings[i],
+            TEXT_FONT_NAME,
+            TEXT_SIZE,
+            renderStatsLinePosition,
+            colors::BLACK
+        );
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
 void DebugViewManagementSystem::CreateDebugLights() const
 {
     auto& world = ecs::World::GetInstance();
@@ -38,6 +38,7 @@ private:
     void RenderFpsString() const;
     void RenderEntityCountString() const;
     void RenderSystemUpdateStrings() const;
+    void RenderRenderStatsStrings() const;
     void CreateDebugLights() const;
     void UpdateDebugLightsPosition() const;
 };
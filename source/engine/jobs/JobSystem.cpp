@@ -0,0 +1,224 @@
+///------------------------------------------------------------------------------------------------
+///  JobSystem.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace jobs
+{
+
+///------------------------------------------------------------------------------------------------
+
+namespace
+{
+    const std::size_t NON_WORKER_THREAD_INDEX = std::numeric_limits<std::size_t>::max();
+
+    thread_local std::size_t sCurrentWorkerIndex = NON_WORKER_THREAD_INDEX;
+}
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem& JobSystem::GetInstance()
+{
+    static JobSystem instance;
+    return instance;
+}
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem::JobSystem()
+{
+    // The thread waiting on a batch of jobs helps execute them, so one
+    // hardware thread is left for it
+    const auto hardwareThreadCount = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    const auto workerCount = std::max(static_cast<std::size_t>(1), hardwareThreadCount > 0 ? hardwareThreadCount - 1 : 0);
+
+    for (auto i = 0U; i < workerCount; ++i)
+    {
+        mWorkerQueues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    for (auto i = 0U; i < workerCount; ++i)
+    {
+        mWorkers.emplace_back([this, i](){ WorkerMain(i); });
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::size_t JobSystem::GetWorkerCount() const
+{
+    return mWorkers.size();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::Run(JobFunction job, JobCounter& counter)
+{
+    assert(!mWorkerQueues.empty() && "No worker queues to submit the job to");
+
+    counter.mPendingJobCount.fetch_add(1, std::memory_order_relaxed);
+
+    // Workers push to their own queue, everyone else spreads the jobs across all of them
+    const auto queueIndex = sCurrentWorkerIndex != NON_WORKER_THREAD_INDEX ? sCurrentWorkerIndex : mNextSubmissionQueueIndex++ % mWorkerQueues.size();
+    auto& workerQueue = *mWorkerQueues[queueIndex];
+    {
+        std::lock_guard<std::mutex> queueLock(workerQueue.mMutex);
+        workerQueue.mJobs.push_back(Job{std::move(job), &counter});
+    }
+
+    {
+        std::lock_guard<std::mutex> sleepLock(mSleepMutex);
+        mQueuedJobCount++;
+    }
+    mJobQueuedCondition.notify_one();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+    const auto startQueueIndex = sCurrentWorkerIndex != NON_WORKER_THREAD_INDEX ? sCurrentWorkerIndex : 0;
+    while (!counter.IsComplete())
+    {
+        Job job;
+        if (TryStealJob(startQueueIndex, job))
+        {
+            ExecuteJob(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> sleepLock(mSleepMutex);
+        mJobCompletedCondition.wait(sleepLock, [&](){ return counter.IsComplete() || mQueuedJobCount > 0; });
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::Shutdown()
+{
+    if (mWorkers.empty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> sleepLock(mSleepMutex);
+        mShuttingDown = true;
+    }
+    mJobQueuedCondition.notify_all();
+
+    for (auto& worker: mWorkers)
+    {
+        worker.join();
+    }
+    mWorkers.clear();
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::WorkerMain(const std::size_t workerIndex)
+{
+    sCurrentWorkerIndex = workerIndex;
+
+    while (true)
+    {
+        Job job;
+        if (TryPopJob(workerIndex, job) || TryStealJob(workerIndex + 1, job))
+        {
+            ExecuteJob(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> sleepLock(mSleepMutex);
+        mJobQueuedCondition.wait(sleepLock, [&](){ return mShuttingDown || mQueuedJobCount > 0; });
+
+        if (mShuttingDown && mQueuedJobCount == 0)
+        {
+            return;
+        }
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool JobSystem::TryPopJob(const std::size_t queueIndex, Job& job)
+{
+    auto& workerQueue = *mWorkerQueues[queueIndex];
+    std::lock_guard<std::mutex> queueLock(workerQueue.mMutex);
+    if (workerQueue.mJobs.empty())
+    {
+        return false;
+    }
+
+    // Owners take their most recent job, thieves the oldest one
+    job = std::move(workerQueue.mJobs.back());
+    workerQueue.mJobs.pop_back();
+    mQueuedJobCount--;
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
+bool JobSystem::TryStealJob(const std::size_t startQueueIndex, Job& job)
+{
+    const auto queueCount = mWorkerQueues.size();
+    for (auto i = 0U; i < queueCount; ++i)
+    {
+        auto& workerQueue = *mWorkerQueues[(startQueueIndex + i) % queueCount];
+        std::lock_guard<std::mutex> queueLock(workerQueue.mMutex);
+        if (!workerQueue.mJobs.empty())
+        {
+            job = std::move(workerQueue.mJobs.front());
+            workerQueue.mJobs.pop_front();
+            mQueuedJobCount--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void JobSystem::ExecuteJob(Job& job)
+{
+    job.mFunction();
+
+    if (job.mCounter->mPendingJobCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // Notifying under the lock ensures that a waiter is either still evaluating
+        // its wait predicate or already asleep, so the wake up can't be missed
+        std::lock_guard<std::mutex> sleepLock(mSleepMutex);
+        mJobCompletedCondition.notify_all();
+    }
+}
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
@@ -0,0 +1,137 @@
+///------------------------------------------------------------------------------------------------
+///  JobSystem.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///------------------------------------------------------------------------------------------------
+
+#ifndef JobSystem_h
+#define JobSystem_h
+
+///------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///------------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///------------------------------------------------------------------------------------------------
+
+class GenesisEngine;
+
+///------------------------------------------------------------------------------------------------
+
+namespace jobs
+{
+
+///------------------------------------------------------------------------------------------------
+
+using JobFunction = std::function<void()>;
+
+///------------------------------------------------------------------------------------------------
+/// Tracks the number of unfinished jobs that were run against it. Waiting on a counter
+/// acts as a fence for all of these jobs.
+class JobCounter final
+{
+    friend class JobSystem;
+
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    const JobCounter& operator = (const JobCounter&) = delete;
+
+    /// @returns whether all jobs run against this counter have finished.
+    inline bool IsComplete() const { return mPendingJobCount.load(std::memory_order_acquire) == 0; }
+
+private:
+    std::atomic<int> mPendingJobCount = 0;
+};
+
+///------------------------------------------------------------------------------------------------
+/// A fixed pool of worker threads executing jobs from per-worker queues. Idle workers steal
+/// jobs from the queues of their peers, and sleep when there is no work left at all.
+class JobSystem final
+{
+    friend class genesis::GenesisEngine;
+
+public:
+    /// The default method of getting a hold of this singleton.
+    ///
+    /// The single instance of this class will be lazily initialized
+    /// the first time it is needed.
+    /// @returns a reference to the single instance of this class.
+    static JobSystem& GetInstance();
+
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) = delete;
+    const JobSystem& operator = (const JobSystem&) = delete;
+    JobSystem& operator = (JobSystem&&) = delete;
+
+    /// @returns the number of worker threads in the pool (not including the threads waiting on jobs).
+    std::size_t GetWorkerCount() const;
+
+    /// Queues the given job for execution on the worker pool.
+    /// @param[in] job the function to execute.
+    /// @param[in] counter the counter to track the job's completion with. Needs to outlive the job.
+    void Run(JobFunction job, JobCounter& counter);
+
+    /// Blocks until all jobs run against the given counter have finished. The calling
+    /// thread executes queued jobs itself while waiting.
+    /// @param[in] counter the counter to wait on.
+    void Wait(const JobCounter& counter);
+
+private:
+    struct Job
+    {
+        JobFunction mFunction;
+        JobCounter* mCounter = nullptr;
+    };
+
+    struct WorkerQueue
+    {
+        std::deque<Job> mJobs;
+        std::mutex mMutex;
+    };
+
+private:
+    JobSystem();
+
+    // Joins all worker threads after they have drained the remaining jobs.
+    // Called internally by the engine on exit.
+    void Shutdown();
+
+    void WorkerMain(const std::size_t workerIndex);
+    bool TryPopJob(const std::size_t queueIndex, Job& job);
+    bool TryStealJob(const std::size_t thiefQueueIndex, Job& job);
+    void ExecuteJob(Job& job);
+
+private:
+    std::vector<std::thread> mWorkers;
+    std::vector<std::unique_ptr<WorkerQueue>> mWorkerQueues;
+    std::mutex mSleepMutex;
+    std::condition_variable mJobQueuedCondition;
+    std::condition_variable mJobCompletedCondition;
+    std::atomic<int> mQueuedJobCount = 0;
+    std::atomic<std::size_t> mNextSubmissionQueueIndex = 0;
+    bool mShuttingDown = false;
+};
+
+///------------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///------------------------------------------------------------------------------------------------
+
+#endif /* JobSystem_h */
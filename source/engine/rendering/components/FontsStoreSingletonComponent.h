@@ -11,8 +11,10 @@
 ///-----------------------------------------------------------------------------------------------
 
 #include "../../ECS.h"
+#include "../../common/utils/MathUtils.h"
 #include "../../resources/ResourceLoadingService.h"
 
+#include <array>
 #include <tsl/robin_map.h>
 
 ///-----------------------------------------------------------------------------------------------
@@ -31,6 +33,9 @@ class FontsStoreSingletonComponent final: public ecs::IComponent
 {
 public:
     tsl::robin_map<StringId, tsl::robin_map<char, resources::ResourceId>, StringIdHasher> mLoadedFonts;
+    
+    // Atlas texture coordinates of each glyph mesh's corners, in the order of the mesh's vertices
+    tsl::robin_map<resources::ResourceId, std::array<glm::vec2, 4>> mGlyphTexCoords;
 };
 
 ///-----------------------------------------------------------------------------------------------
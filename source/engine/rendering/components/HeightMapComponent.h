@@ -31,6 +31,25 @@ namespace rendering
 using GLuint = unsigned int;
 using ResourceId = size_t;
 
+///-----------------------------------------------------------------------------------------------
+/// The index range of a height map chunk at a single level of detail, and the largest height
+/// difference (in model space) between the chunk at this level and at full resolution.
+struct HeightMapChunkLod final
+{
+    GLuint mFirstIndex    = 0;
+    GLuint mIndexCount    = 0;
+    float mGeometricError = 0.0f;
+};
+
+///-----------------------------------------------------------------------------------------------
+/// A block of height map cells drawn on its own, at one of its levels of detail (finest first).
+struct HeightMapChunk final
+{
+    glm::vec3 mCenter = glm::vec3(0.0f); // model space bounding sphere
+    float mRadius     = 0.0f;
+    std::vector<HeightMapChunkLod> mLods;
+};
+
 ///-----------------------------------------------------------------------------------------------
 
 class HeightMapComponent final: public ecs::IComponent
@@ -41,6 +60,13 @@ public:
     std::vector<ResourceId> mHeightMapTextureResourceIds;
     std::vector<std::vector<float>> mHeightMapTileHeights;
     float mHeightMapScale = 0.0f;
+    
+    // Chunks that the height map's mesh is split into, each culled and drawn at its own level of detail
+    std::vector<HeightMapChunk> mChunks;
+    
+    // Coarse, model space stand in of the height map's mesh that never rises above it, used as an occluder
+    std::vector<glm::vec3> mOccluderVertices;
+    std::vector<unsigned int> mOccluderIndices;
 };
 
 ///-----------------------------------------------------------------------------------------------
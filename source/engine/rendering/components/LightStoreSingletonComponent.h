@@ -30,7 +30,6 @@ class LightStoreSingletonComponent final: public ecs::IComponent
 public:
     std::vector<glm::vec3> mLightPositions;
     std::vector<float> mLightPowers;
-    glm::mat4 mMainShadowCastingLightMatrix;
 };
 
 ///-----------------------------------------------------------------------------------------------
@@ -27,10 +27,6 @@ namespace rendering
 
 ///-----------------------------------------------------------------------------------------------
 
-using GLuint = unsigned int;
-
-///-----------------------------------------------------------------------------------------------
-
 enum class ParticleEmitterType
 {
     SMOKE,
@@ -40,6 +36,16 @@ enum class ParticleEmitterType
 
 ///-----------------------------------------------------------------------------------------------
 
+/// The per instance attributes of a single particle, as streamed to the shared particle instance buffer.
+struct ParticleInstanceData final
+{
+    glm::vec3 mPosition;
+    float mLifetime;
+    float mSize;
+};
+
+///-----------------------------------------------------------------------------------------------
+
 class ParticleEmitterComponent final: public ecs::IComponent
 {
 public:
@@ -57,12 +63,6 @@ public:
     glm::vec2 mParticleSizeRange;
     
     size_t mParticleTextureResourceId;
-    GLuint mParticleVertexArrayObject;
-    GLuint mParticleVertexBuffer;
-    GLuint mParticleUVBuffer;
-    GLuint mParticlePositionsBuffer;
-    GLuint mParticleLifetimesBuffer;
-    GLuint mParticleSizesBuffer;
     
     StringId mShaderNameId;
     
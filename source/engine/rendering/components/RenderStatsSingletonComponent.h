@@ -0,0 +1,85 @@
+///------------------------------------------------------------------------------------------------
+///  RenderStatsSingletonComponent.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef RenderStatsSingletonComponent_h
+#define RenderStatsSingletonComponent_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../ECS.h"
+#include "../opengl/GLStateCache.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+enum class RenderPass
+{
+    DEPTH = 0,
+    FINAL,
+    PARTICLES,
+    TEXT,
+    COUNT
+};
+
+///-----------------------------------------------------------------------------------------------
+/// Rendering work done by a single pass over a frame.
+struct RenderPassStats final
+{
+    std::size_t mDrawCallCount       = 0;
+    std::size_t mPrimitiveCount      = 0;
+    std::size_t mProgramSwitchCount  = 0;
+    std::size_t mTextureBindCount    = 0;
+    std::size_t mUploadedBufferBytes = 0;
+    std::size_t mVisibleEntityCount  = 0;
+    std::size_t mCulledEntityCount   = 0;
+    std::size_t mOccludedEntityCount = 0;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+using RenderFrameStats = std::array<RenderPassStats, static_cast<std::size_t>(RenderPass::COUNT)>;
+
+///-----------------------------------------------------------------------------------------------
+
+class RenderStatsSingletonComponent final : public ecs::IComponent
+{
+public:
+    RenderFrameStats mCurrentFrameStats;
+    RenderFrameStats mLastFrameStats;
+
+    // The pass that GL state changes are currently attributed to, and the state cache counts when it became active
+    RenderPass mActivePass = RenderPass::FINAL;
+    GLStateCacheStats mActivePassStartGLStateCacheStats;
+
+    // Frames logged so far for an in progress CSV capture
+    std::vector<RenderFrameStats> mCsvCapturedFrames;
+    std::string mCsvFilePath;
+    int mCsvRequestedFrameCount = 0;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* RenderStatsSingletonComponent_h */
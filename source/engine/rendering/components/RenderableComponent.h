@@ -13,6 +13,7 @@
 #include "../../ECS.h"
 #include "../../common/utils/MathUtils.h"
 #include "../../common/utils/StringUtils.h"
+#include "../utils/ShaderUniformUtils.h"
 
 #include <tsl/robin_map.h>
 #include <vector>
@@ -33,21 +34,6 @@ using ResourceId = size_t;
 
 ///-----------------------------------------------------------------------------------------------
 
-struct ShaderUniforms final
-{
-    tsl::robin_map<StringId, std::vector<glm::mat4>, StringIdHasher> mShaderMatrixArrayUniforms;
-    tsl::robin_map<StringId, std::vector<glm::vec4>, StringIdHasher> mShaderFloatVec4ArrayUniforms;
-    tsl::robin_map<StringId, std::vector<glm::vec3>, StringIdHasher> mShaderFloatVec3ArrayUniforms;
-    tsl::robin_map<StringId, glm::mat4, StringIdHasher> mShaderMatrixUniforms;
-    tsl::robin_map<StringId, glm::vec4, StringIdHasher> mShaderFloatVec4Uniforms;
-    tsl::robin_map<StringId, glm::vec3, StringIdHasher> mShaderFloatVec3Uniforms;
-    tsl::robin_map<StringId, float, StringIdHasher> mShaderFloatUniforms;
-    tsl::robin_map<StringId, int, StringIdHasher> mShaderIntUniforms;
-    tsl::robin_map<StringId, bool, StringIdHasher> mShaderBoolUniforms;
-};
-
-///-----------------------------------------------------------------------------------------------
-
 struct MaterialProperties final
 {
     glm::vec4 mAmbient;
@@ -89,6 +75,7 @@ public:
     bool mIsCastingShadows              = false;
     bool mIsLoopingAnimation            = false;
     bool mShouldAnimateSkeleton         = true;
+    bool mIsOccluder                    = false;
 };
 
 ///-----------------------------------------------------------------------------------------------
@@ -10,6 +10,8 @@
 
 ///-----------------------------------------------------------------------------------------------
 
+#include "ParticleEmitterComponent.h"
+#include "TextStringComponent.h"
 #include "../../ECS.h"
 #include "../../common/utils/MathUtils.h"
 #include "../../common/utils/StringUtils.h"
@@ -17,6 +19,15 @@
 #include "../../resources/ResourceLoadingService.h"
 #include "../../resources/ShaderResource.h"
 #include "../../resources/TextureResource.h"
+#include "../opengl/GLStateCache.h"
+#include "../opengl/IRenderDevice.h"
+#include "../utils/FrustumCullingUtils.h"
+#include "../utils/OcclusionCullingUtils.h"
+#include "../utils/RenderQueueUtils.h"
+#include "../utils/ShadowCascadeUtils.h"
+
+#include <memory>
+#include <vector>
 
 ///-----------------------------------------------------------------------------------------------
 
@@ -41,12 +52,52 @@ public:
     // Core state
     SDL_GLContext mGLContext          = nullptr;
     GLuint mDefaultVertexArrayObject  = 0;
-    GLuint mDepthMapFrameBufferObject = 0;
-    GLuint mShadowMapTexture          = 0;
+    GLuint mInstanceBufferObject      = 0;
+    GLuint mFrameUniformBufferObject  = 0;
+    GLuint mTextVertexArrayObject     = 0;
+    GLuint mTextVertexBufferObject    = 0;
+    GLuint mParticleVertexArrayObject = 0;
+    GLuint mParticleQuadBufferObject  = 0;
+    GLuint mParticleInstanceBufferObject = 0;
     glm::vec4 mClearColor             = glm::vec4(0.0f, 1.0f, 0.0f, 1.0f);
     float mDtAccumulator              = 0.0f;
     bool mShadowsEnabled              = true;
     bool mParticlesEnabled            = true;
+    bool mOcclusionCullingEnabled     = true;
+    
+    // Shadow cascades, ordered from the closest to the camera to the furthest away
+    std::vector<ShadowCascade> mShadowCascades = { { 2048, 0.0f }, { 1024, 2.0f }, { 512, 4.0f } };
+    float mShadowDistance                      = 1.5f;
+    
+    // Device all rendering commands are issued to (OpenGL, or a recording one when running headless),
+    // with the shadowed state used to skip redundant state changes in front of it
+    std::unique_ptr<IRenderDevice> mRenderDevice;
+    GLStateCache mGLStateCache;
+    
+    // Per frame render queue storage, kept around to avoid reallocations
+    std::vector<RenderQueueItem> mRenderQueue;
+    std::vector<RenderQueueItem> mRenderQueueScratch;
+    
+    // Per frame culling spheres of the render queue entities (in render queue order), and the visibility results of the latest frustum test against them
+    CullingSpheres mCullingSpheres;
+    std::vector<std::uint8_t> mCullingResults;
+    
+    // Per frame software depth buffer that the terrain and the largest models in view are rasterised into, and the occlusion test results of the culling spheres against it
+    OcclusionDepthBuffer mOcclusionDepthBuffer;
+    std::vector<std::uint8_t> mOcclusionResults;
+    
+    // Per height map culling spheres of its chunks, and the visibility results of the latest frustum test against them
+    CullingSpheres mHeightMapChunkCullingSpheres;
+    std::vector<std::uint8_t> mHeightMapChunkCullingResults;
+    
+    // Glyph quads of consecutive strings sharing a shader and font atlas, drawn together with a single draw call
+    std::vector<TextVertexData> mTextBatchVertices;
+    StringId mTextBatchShaderNameId;
+    resources::ResourceId mTextBatchTextureResourceId = 0;
+    
+    // Per frame particle instances of all emitters, grouped by emitter type, streamed to the shared particle instance buffer at once
+    std::vector<ParticleInstanceData> mParticleInstances;
+    std::vector<const ParticleEmitterComponent*> mParticleEmitterDrawQueue;
 };
 
 ///-----------------------------------------------------------------------------------------------
@@ -11,7 +11,9 @@
 ///-----------------------------------------------------------------------------------------------
 
 #include "../../ECS.h"
+#include "../../common/utils/MathUtils.h"
 
+#include <string>
 #include <vector>
 
 ///-----------------------------------------------------------------------------------------------
@@ -26,12 +28,30 @@ namespace rendering
 
 ///-----------------------------------------------------------------------------------------------
 
+/// A single vertex of a glyph quad, already transformed by its string's world matrix.
+struct TextVertexData final
+{
+    glm::vec3 mPosition;
+    glm::vec2 mTexCoords;
+    glm::vec4 mColor;
+};
+
+///-----------------------------------------------------------------------------------------------
+
 class TextStringComponent final: public ecs::IComponent
 {
 public:
     std::string mText;
     float mCharacterSize;
     float mPaddingProportionalToSize;
+    
+    // Glyph quads of the string, regenerated by the RenderingSystem only when the text, the
+    // world matrix or the color they were generated from change (or the dirty flag is raised)
+    std::vector<TextVertexData> mVertices;
+    std::string mVerticesText;
+    glm::mat4 mVerticesWorldMatrix = glm::mat4(1.0f);
+    glm::vec4 mVerticesColor       = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+    bool mVerticesDirty            = true;
 };
 
 ///-----------------------------------------------------------------------------------------------
@@ -22,9 +22,13 @@ extern GLFuncTable glFuncTable;
 #define GL_CHECK(call) do { glFuncTable.call; assert(glFuncTable.glGetError() == GL_NO_ERROR); } while (0)
 #define GL_CHECK_AGAINST_ARG(call, arg) do { assert(glFuncTable.call == arg); } while (0)
 #define GL_NO_CHECK(call) (glFuncTable.call)
-#define GL_PRIMITIVE_RESTART 0x8F9D
 #define GL_CLAMP_TO_BORDER 0x812D
 #define GL_TEXTURE_BORDER_COLOR 0x1004
+#define GL_UNIFORM_BUFFER 0x8A11
+#define GL_INVALID_INDEX 0xFFFFFFFFu
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
 
 #else // TURF_TARGET_WIN32
 
@@ -43,3 +47,26 @@ extern GLFuncTable glFuncTable;
 #define GL_NO_CHECK(call) (call)
 
 #endif // TURF_TARGET_WIN32
+
+//---------------------------------------------------------------------------
+//  Headless builds (e.g. the simulation benchmark) have no GL context. GL
+//  calls are still type checked but never evaluated, and calls returning
+//  a value yield a value initialized result.
+//---------------------------------------------------------------------------
+#if defined(GENESIS_HEADLESS)
+
+#undef GL_CHECK
+#undef GL_CHECK_AGAINST_ARG
+#undef GL_NO_CHECK
+
+#ifdef _WIN32
+#define GL_CHECK(call) ((void)sizeof((glFuncTable.call, 0)))
+#define GL_CHECK_AGAINST_ARG(call, arg) ((void)sizeof((glFuncTable.call, arg, 0)))
+#define GL_NO_CHECK(call) (decltype(glFuncTable.call)())
+#else
+#define GL_CHECK(call) ((void)sizeof((call, 0)))
+#define GL_CHECK_AGAINST_ARG(call, arg) ((void)sizeof((call, arg, 0)))
+#define GL_NO_CHECK(call) (decltype(call)())
+#endif
+
+#endif // GENESIS_HEADLESS
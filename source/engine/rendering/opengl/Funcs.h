@@ -14,6 +14,7 @@ GL_FUNC(void, glDisable, (GLenum))
 GL_FUNC(void, glDisableVertexAttribArray, (GLuint))
 GL_FUNC(void, glDrawElements, (GLenum, GLsizei, GLenum, const GLvoid*))
 GL_FUNC(void, glDrawElementsBaseVertex, (GLenum, GLsizei, GLenum, const GLvoid*, GLint))
+GL_FUNC(void, glDrawElementsInstancedBaseVertex, (GLenum, GLsizei, GLenum, const GLvoid*, GLsizei, GLint))
 GL_FUNC(void, glEnable, (GLenum))
 GL_FUNC(void, glEnableVertexAttribArray, (GLuint))
 GL_FUNC(void, glVertexAttribIPointer, (GLuint, GLint, GLenum, GLsizei, const GLvoid*))
@@ -27,9 +28,12 @@ GL_FUNC(GLint, glGetUniformLocation, (GLuint, const char *))
 GL_FUNC(void, glLinkProgram, (GLuint))
 GL_FUNC(void, glShaderSource, (GLuint, GLsizei, const GLchar* const*, const GLint *))
 GL_FUNC(void, glUniform1i, (GLint, GLint))
+GL_FUNC(void, glUniform1iv, (GLint, GLsizei, const GLint *))
+GL_FUNC(void, glUniform1fv, (GLint, GLsizei, const GLfloat *))
 GL_FUNC(void, glUniform3fv, (GLint, GLsizei, const GLfloat *))
 GL_FUNC(void, glUniform3f, (GLint, GLfloat, GLfloat, GLfloat))
 GL_FUNC(void, glUniform4f, (GLint, GLfloat, GLfloat, GLfloat, GLfloat))
+GL_FUNC(void, glUniform4fv, (GLint, GLsizei, const GLfloat *))
 GL_FUNC(void, glUniformMatrix4fv, (GLint, GLsizei, GLboolean, const GLfloat *))
 GL_FUNC(void, glUseProgram, (GLuint))
 GL_FUNC(void, glValidateProgram, (GLuint))
@@ -42,6 +46,9 @@ GL_FUNC(void, glDeleteBuffers, (GLsizei, GLuint *))
 GL_FUNC(void, glBindBuffer, (GLenum, GLuint))
 GL_FUNC(void, glBufferData, (GLenum, GLsizeiptr, const GLvoid *, GLenum))
 GL_FUNC(void, glBufferSubData, (GLenum, GLintptr, GLsizeiptr, const GLvoid*))
+GL_FUNC(void, glBindBufferBase, (GLenum, GLuint, GLuint))
+GL_FUNC(GLuint, glGetUniformBlockIndex, (GLuint, const GLchar*))
+GL_FUNC(void, glUniformBlockBinding, (GLuint, GLuint, GLuint))
 GL_FUNC(void, glVertexAttribDivisor, (GLuint, GLuint))
 GL_FUNC(void, glDeleteVertexArrays, (GLsizei, const GLuint*))
 GL_FUNC(void, glBindTexture, (GLenum, GLuint))
@@ -58,7 +65,6 @@ GL_FUNC(void, glTexParameteri, (GLenum, GLenum, GLint))
 GL_FUNC(void, glBlendFunc, (GLenum, GLenum))
 GL_FUNC(void, glGenFramebuffers, (GLsizei, GLuint*))
 GL_FUNC(void, glBindFramebuffer, (GLenum, GLuint))
-GL_FUNC(void, glPrimitiveRestartIndex, (GLuint))
 GL_FUNC(void, glFramebufferTexture, (GLenum, GLenum, GLuint, GLint))
 GL_FUNC(GLenum, glCheckFramebufferStatus, (GLenum))
 GL_FUNC(void, glDrawBuffers, (GLsizei, const GLenum* bufs))
@@ -70,4 +76,8 @@ GL_FUNC(void, glBlendFuncSeparate, (GLenum, GLenum, GLenum, GLenum))
 GL_FUNC(void, glTexEnvi, (GLenum target, GLenum pname, GLint  param))
 GL_FUNC(void, glTexParameterfv, (GLenum target, GLenum pname, const GLfloat* param))
 GL_FUNC(void, glFramebufferTexture2D, (GLenum, GLenum, GLenum, GLuint, GLint))
-GL_FUNC(void, glDrawBuffer, (GLenum))
\ No newline at end of file
+GL_FUNC(void, glDrawBuffer, (GLenum))
+GL_FUNC(void, glGetIntegerv, (GLenum, GLint*))
+GL_FUNC(void, glProgramParameteri, (GLuint, GLenum, GLint))
+GL_FUNC(void, glGetProgramBinary, (GLuint, GLsizei, GLsizei*, GLenum*, void*))
+GL_FUNC(void, glProgramBinary, (GLuint, GLenum, const void*, GLsizei))
\ No newline at end of file
@@ -0,0 +1,329 @@
+///------------------------------------------------------------------------------------------------
+///  GLRenderDevice.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "GLRenderDevice.h"
+#include "Context.h"
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+GLuint GLRenderDevice::VCreateBuffer()
+{
+    GLuint buffer = 0;
+    GL_CHECK(glGenBuffers(1, &buffer));
+    return buffer;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+GLuint GLRenderDevice::VCreateVertexArray()
+{
+    GLuint vertexArray = 0;
+    GL_CHECK(glGenVertexArrays(1, &vertexArray));
+    return vertexArray;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+GLuint GLRenderDevice::VCreateTexture()
+{
+    GLuint texture = 0;
+    GL_CHECK(glGenTextures(1, &texture));
+    return texture;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+GLuint GLRenderDevice::VCreateFramebuffer()
+{
+    GLuint framebuffer = 0;
+    GL_CHECK(glGenFramebuffers(1, &framebuffer));
+    return framebuffer;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VBindBuffer(const GLenum target, const GLuint buffer)
+{
+    GL_CHECK(glBindBuffer(target, buffer));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VBindBufferBase(const GLenum target, const GLuint bindingPoint, const GLuint buffer)
+{
+    GL_CHECK(glBindBufferBase(target, bindingPoint, buffer));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VBufferData(const GLenum target, const std::size_t byteSize, const void* data, const GLenum usage)
+{
+    GL_CHECK(glBufferData(target, static_cast<GLsizeiptr>(byteSize), data, usage));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VBufferSubData(const GLenum target, const std::size_t byteOffset, const std::size_t byteSize, const void* data)
+{
+    GL_CHECK(glBufferSubData(target, static_cast<GLintptr>(byteOffset), static_cast<GLsizeiptr>(byteSize), data));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VBindVertexArray(const GLuint vertexArray)
+{
+    GL_CHECK(glBindVertexArray(vertexArray));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetVertexAttributeEnabled(const GLuint attributeLocation, const bool enabled)
+{
+    if (enabled)
+    {
+        GL_CHECK(glEnableVertexAttribArray(attributeLocation));
+    }
+    else
+    {
+        GL_CHECK(glDisableVertexAttribArray(attributeLocation));
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetVertexAttributePointer(const GLuint attributeLocation, const GLint componentCount, const GLsizei stride, const std::size_t byteOffset)
+{
+    GL_CHECK(glVertexAttribPointer(attributeLocation, componentCount, GL_FLOAT, GL_FALSE, stride, (void*)byteOffset));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetVertexAttributeDivisor(const GLuint attributeLocation, const GLuint divisor)
+{
+    GL_CHECK(glVertexAttribDivisor(attributeLocation, divisor));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetActiveTextureUnit(const GLuint textureUnit)
+{
+    GL_CHECK(glActiveTexture(GL_TEXTURE0 + textureUnit));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VBindTexture(const GLuint texture)
+{
+    GL_CHECK(glBindTexture(GL_TEXTURE_2D, texture));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VTextureImage2D(const GLint internalFormat, const GLsizei width, const GLsizei height, const GLenum format, const GLenum type, const void* data)
+{
+    GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, type, data));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetTextureParameter(const GLenum parameter, const GLint value)
+{
+    GL_CHECK(glTexParameteri(GL_TEXTURE_2D, parameter, value));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetTextureParameterValues(const GLenum parameter, const float* values)
+{
+    GL_CHECK(glTexParameterfv(GL_TEXTURE_2D, parameter, values));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VBindFramebuffer(const GLuint framebuffer)
+{
+    GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VAttachFramebufferDepthTexture(const GLuint texture)
+{
+    GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texture, 0));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetDrawBuffer(const GLenum buffer)
+{
+    GL_CHECK(glDrawBuffer(buffer));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+bool GLRenderDevice::VIsFramebufferComplete()
+{
+    return GL_NO_CHECK(glCheckFramebufferStatus(GL_FRAMEBUFFER)) == GL_FRAMEBUFFER_COMPLETE;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VUseProgram(const GLuint program)
+{
+    GL_CHECK(glUseProgram(program));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetUniformMatrix4(const GLint location, const GLsizei count, const float* values)
+{
+    GL_CHECK(glUniformMatrix4fv(location, count, GL_FALSE, values));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetUniformVec4(const GLint location, const GLsizei count, const float* values)
+{
+    GL_CHECK(glUniform4fv(location, count, values));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetUniformVec3(const GLint location, const GLsizei count, const float* values)
+{
+    GL_CHECK(glUniform3fv(location, count, values));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetUniformFloat(const GLint location, const GLsizei count, const float* values)
+{
+    GL_CHECK(glUniform1fv(location, count, values));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetUniformInt(const GLint location, const GLsizei count, const GLint* values)
+{
+    GL_CHECK(glUniform1iv(location, count, values));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetCapabilityEnabled(const GLenum capability, const bool enabled)
+{
+    if (enabled)
+    {
+        GL_CHECK(glEnable(capability));
+    }
+    else
+    {
+        GL_CHECK(glDisable(capability));
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetBlendFunc(const GLenum sourceFactor, const GLenum destinationFactor)
+{
+    GL_CHECK(glBlendFunc(sourceFactor, destinationFactor));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetDepthFunc(const GLenum depthFunc)
+{
+    GL_CHECK(glDepthFunc(depthFunc));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetDepthMask(const bool enabled)
+{
+    GL_CHECK(glDepthMask(enabled ? GL_TRUE : GL_FALSE));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetCullFace(const GLenum face)
+{
+    GL_CHECK(glCullFace(face));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetViewport(const GLint x, const GLint y, const GLsizei width, const GLsizei height)
+{
+    GL_CHECK(glViewport(x, y, width, height));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VSetClearColor(const glm::vec4& clearColor)
+{
+    GL_CHECK(glClearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VClear(const GLbitfield mask)
+{
+    GL_CHECK(glClear(mask));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VDrawArrays(const GLenum mode, const GLint first, const GLsizei count)
+{
+    GL_CHECK(glDrawArrays(mode, first, count));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VDrawArraysInstanced(const GLenum mode, const GLint first, const GLsizei count, const GLsizei instanceCount)
+{
+    GL_CHECK(glDrawArraysInstanced(mode, first, count, instanceCount));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VDrawElements(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset)
+{
+    GL_CHECK(glDrawElements(mode, count, type, (void*)byteOffset));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VDrawElementsBaseVertex(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset, const GLint baseVertex)
+{
+    GL_CHECK(glDrawElementsBaseVertex(mode, count, type, (void*)byteOffset, baseVertex));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLRenderDevice::VDrawElementsInstancedBaseVertex(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset, const GLsizei instanceCount, const GLint baseVertex)
+{
+    GL_CHECK(glDrawElementsInstancedBaseVertex(mode, count, type, (void*)byteOffset, instanceCount, baseVertex));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
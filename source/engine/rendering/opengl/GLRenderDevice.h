@@ -0,0 +1,97 @@
+///------------------------------------------------------------------------------------------------
+///  GLRenderDevice.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef GLRenderDevice_h
+#define GLRenderDevice_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "IRenderDevice.h"
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+/// Issues all commands straight to the current OpenGL context.
+class GLRenderDevice final: public IRenderDevice
+{
+public:
+    GLRenderDevice() = default;
+    
+    // Object creation
+    GLuint VCreateBuffer() override;
+    GLuint VCreateVertexArray() override;
+    GLuint VCreateTexture() override;
+    GLuint VCreateFramebuffer() override;
+
+    // Buffers
+    void VBindBuffer(const GLenum target, const GLuint buffer) override;
+    void VBindBufferBase(const GLenum target, const GLuint bindingPoint, const GLuint buffer) override;
+    void VBufferData(const GLenum target, const std::size_t byteSize, const void* data, const GLenum usage) override;
+    void VBufferSubData(const GLenum target, const std::size_t byteOffset, const std::size_t byteSize, const void* data) override;
+
+    // Vertex arrays
+    void VBindVertexArray(const GLuint vertexArray) override;
+    void VSetVertexAttributeEnabled(const GLuint attributeLocation, const bool enabled) override;
+    void VSetVertexAttributePointer(const GLuint attributeLocation, const GLint componentCount, const GLsizei stride, const std::size_t byteOffset) override;
+    void VSetVertexAttributeDivisor(const GLuint attributeLocation, const GLuint divisor) override;
+
+    // 2D textures
+    void VSetActiveTextureUnit(const GLuint textureUnit) override;
+    void VBindTexture(const GLuint texture) override;
+    void VTextureImage2D(const GLint internalFormat, const GLsizei width, const GLsizei height, const GLenum format, const GLenum type, const void* data) override;
+    void VSetTextureParameter(const GLenum parameter, const GLint value) override;
+    void VSetTextureParameterValues(const GLenum parameter, const float* values) override;
+
+    // Framebuffers
+    void VBindFramebuffer(const GLuint framebuffer) override;
+    void VAttachFramebufferDepthTexture(const GLuint texture) override;
+    void VSetDrawBuffer(const GLenum buffer) override;
+    bool VIsFramebufferComplete() override;
+
+    // Programs and uniforms
+    void VUseProgram(const GLuint program) override;
+    void VSetUniformMatrix4(const GLint location, const GLsizei count, const float* values) override;
+    void VSetUniformVec4(const GLint location, const GLsizei count, const float* values) override;
+    void VSetUniformVec3(const GLint location, const GLsizei count, const float* values) override;
+    void VSetUniformFloat(const GLint location, const GLsizei count, const float* values) override;
+    void VSetUniformInt(const GLint location, const GLsizei count, const GLint* values) override;
+
+    // Fixed function state
+    void VSetCapabilityEnabled(const GLenum capability, const bool enabled) override;
+    void VSetBlendFunc(const GLenum sourceFactor, const GLenum destinationFactor) override;
+    void VSetDepthFunc(const GLenum depthFunc) override;
+    void VSetDepthMask(const bool enabled) override;
+    void VSetCullFace(const GLenum face) override;
+    void VSetViewport(const GLint x, const GLint y, const GLsizei width, const GLsizei height) override;
+    void VSetClearColor(const glm::vec4& clearColor) override;
+    void VClear(const GLbitfield mask) override;
+
+    // Draws
+    void VDrawArrays(const GLenum mode, const GLint first, const GLsizei count) override;
+    void VDrawArraysInstanced(const GLenum mode, const GLint first, const GLsizei count, const GLsizei instanceCount) override;
+    void VDrawElements(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset) override;
+    void VDrawElementsBaseVertex(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset, const GLint baseVertex) override;
+    void VDrawElementsInstancedBaseVertex(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset, const GLsizei instanceCount, const GLint baseVertex) override;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* GLRenderDevice_h */
@@ -0,0 +1,230 @@
+///------------------------------------------------------------------------------------------------
+///  GLStateCache.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "GLStateCache.h"
+#include "Context.h"
+
+#include <cassert>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::SetRenderDevice(IRenderDevice& renderDevice)
+{
+    mRenderDevice = &renderDevice;
+    Invalidate();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::Invalidate()
+{
+    mProgramId.reset();
+    mVertexArrayObject.reset();
+    mActiveTextureUnit.reset();
+    mBoundTextureIds.fill(std::nullopt);
+    mBlendSourceFactor.reset();
+    mBlendDestinationFactor.reset();
+    mCullFace.reset();
+    mBlendEnabled.reset();
+    mDepthTestEnabled.reset();
+    mDepthMaskEnabled.reset();
+    mCullFaceEnabled.reset();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::BeginFrame()
+{
+    // State might have been changed outside the cache in between frames (e.g. by resource loaders)
+    Invalidate();
+    mCurrentFrameStats = GLStateCacheStats();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::EndFrame()
+{
+    mLastFrameStats = mCurrentFrameStats;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+const GLStateCacheStats& GLStateCache::GetLastFrameStats() const
+{
+    return mLastFrameStats;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+const GLStateCacheStats& GLStateCache::GetCurrentFrameStats() const
+{
+    return mCurrentFrameStats;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::UseProgram(const GLuint programId)
+{
+    if (mProgramId == programId)
+    {
+        mCurrentFrameStats.mElidedCallCount++;
+        return;
+    }
+    
+    GetRenderDevice().VUseProgram(programId);
+    mProgramId = programId;
+    mCurrentFrameStats.mIssuedCallCount++;
+    mCurrentFrameStats.mProgramSwitchCount++;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::BindVertexArray(const GLuint vertexArrayObject)
+{
+    if (mVertexArrayObject == vertexArrayObject)
+    {
+        mCurrentFrameStats.mElidedCallCount++;
+        return;
+    }
+    
+    GetRenderDevice().VBindVertexArray(vertexArrayObject);
+    mVertexArrayObject = vertexArrayObject;
+    mCurrentFrameStats.mIssuedCallCount++;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::BindTexture(const GLuint textureUnit, const GLuint textureId)
+{
+    assert(textureUnit < MAX_TEXTURE_UNITS && "Texture unit exceeds the units shadowed by the state cache");
+    
+    if (mBoundTextureIds[textureUnit] == textureId)
+    {
+        mCurrentFrameStats.mElidedCallCount++;
+        return;
+    }
+    
+    if (mActiveTextureUnit != textureUnit)
+    {
+        GetRenderDevice().VSetActiveTextureUnit(textureUnit);
+        mActiveTextureUnit = textureUnit;
+        mCurrentFrameStats.mIssuedCallCount++;
+    }
+    
+    GetRenderDevice().VBindTexture(textureId);
+    mBoundTextureIds[textureUnit] = textureId;
+    mCurrentFrameStats.mIssuedCallCount++;
+    mCurrentFrameStats.mTextureBindCount++;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::SetBlendEnabled(const bool enabled)
+{
+    SetCapabilityEnabled(mBlendEnabled, GL_BLEND, enabled);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::SetBlendFunc(const GLenum sourceFactor, const GLenum destinationFactor)
+{
+    if (mBlendSourceFactor == sourceFactor && mBlendDestinationFactor == destinationFactor)
+    {
+        mCurrentFrameStats.mElidedCallCount++;
+        return;
+    }
+    
+    GetRenderDevice().VSetBlendFunc(sourceFactor, destinationFactor);
+    mBlendSourceFactor = sourceFactor;
+    mBlendDestinationFactor = destinationFactor;
+    mCurrentFrameStats.mIssuedCallCount++;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::SetDepthTestEnabled(const bool enabled)
+{
+    SetCapabilityEnabled(mDepthTestEnabled, GL_DEPTH_TEST, enabled);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::SetDepthMask(const bool enabled)
+{
+    if (mDepthMaskEnabled == enabled)
+    {
+        mCurrentFrameStats.mElidedCallCount++;
+        return;
+    }
+    
+    GetRenderDevice().VSetDepthMask(enabled);
+    mDepthMaskEnabled = enabled;
+    mCurrentFrameStats.mIssuedCallCount++;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::SetCullFaceEnabled(const bool enabled)
+{
+    SetCapabilityEnabled(mCullFaceEnabled, GL_CULL_FACE, enabled);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::SetCullFace(const GLenum face)
+{
+    if (mCullFace == face)
+    {
+        mCurrentFrameStats.mElidedCallCount++;
+        return;
+    }
+    
+    GetRenderDevice().VSetCullFace(face);
+    mCullFace = face;
+    mCurrentFrameStats.mIssuedCallCount++;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void GLStateCache::SetCapabilityEnabled(std::optional<bool>& shadowedState, const GLenum capability, const bool enabled)
+{
+    if (shadowedState == enabled)
+    {
+        mCurrentFrameStats.mElidedCallCount++;
+        return;
+    }
+    
+    GetRenderDevice().VSetCapabilityEnabled(capability, enabled);
+    shadowedState = enabled;
+    mCurrentFrameStats.mIssuedCallCount++;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+IRenderDevice& GLStateCache::GetRenderDevice()
+{
+    assert(mRenderDevice != nullptr && "The state cache needs a render device to forward state changes to");
+    return *mRenderDevice;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
@@ -0,0 +1,109 @@
+///------------------------------------------------------------------------------------------------
+///  GLStateCache.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef GLStateCache_h
+#define GLStateCache_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "IRenderDevice.h"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+/// Number of state changing GL calls that went through a GLStateCache during a frame, along
+/// with how many of the issued ones were program switches and texture binds.
+struct GLStateCacheStats final
+{
+    std::size_t mIssuedCallCount    = 0;
+    std::size_t mElidedCallCount    = 0;
+    std::size_t mProgramSwitchCount = 0;
+    std::size_t mTextureBindCount   = 0;
+};
+
+///-----------------------------------------------------------------------------------------------
+/// Shadows the GL state most frequently touched per draw (bound program, vertex array object,
+/// 2D textures per unit, blending, depth and culling state) and skips calls that would not change it.
+/// Calls that do change it are forwarded to the render device. Any state changed directly on the
+/// render device instead will be out of sync with the cache until the next call to Invalidate.
+class GLStateCache final
+{
+public:
+    static constexpr std::size_t MAX_TEXTURE_UNITS = 16;
+
+    /// Sets the device that state changes are forwarded to, and invalidates the cache.
+    void SetRenderDevice(IRenderDevice& renderDevice);
+    
+    /// Forgets all shadowed state, so that the next call for each piece of state is issued.
+    void Invalidate();
+    
+    /// Invalidates the cache and starts counting the calls of a new frame.
+    void BeginFrame();
+    
+    /// Publishes the call counts of the current frame, retrievable via GetLastFrameStats.
+    void EndFrame();
+    
+    /// @returns the issued and elided call counts of the last finished frame.
+    const GLStateCacheStats& GetLastFrameStats() const;
+    
+    /// @returns the issued and elided call counts of the current frame so far.
+    const GLStateCacheStats& GetCurrentFrameStats() const;
+    
+    void UseProgram(const GLuint programId);
+    void BindVertexArray(const GLuint vertexArrayObject);
+    void BindTexture(const GLuint textureUnit, const GLuint textureId);
+    void SetBlendEnabled(const bool enabled);
+    void SetBlendFunc(const GLenum sourceFactor, const GLenum destinationFactor);
+    void SetDepthTestEnabled(const bool enabled);
+    void SetDepthMask(const bool enabled);
+    void SetCullFaceEnabled(const bool enabled);
+    void SetCullFace(const GLenum face);
+
+private:
+    void SetCapabilityEnabled(std::optional<bool>& shadowedState, const GLenum capability, const bool enabled);
+    IRenderDevice& GetRenderDevice();
+    
+private:
+    IRenderDevice* mRenderDevice = nullptr;
+    std::optional<GLuint> mProgramId;
+    std::optional<GLuint> mVertexArrayObject;
+    std::optional<GLuint> mActiveTextureUnit;
+    std::array<std::optional<GLuint>, MAX_TEXTURE_UNITS> mBoundTextureIds;
+    std::optional<GLenum> mBlendSourceFactor;
+    std::optional<GLenum> mBlendDestinationFactor;
+    std::optional<GLenum> mCullFace;
+    std::optional<bool> mBlendEnabled;
+    std::optional<bool> mDepthTestEnabled;
+    std::optional<bool> mDepthMaskEnabled;
+    std::optional<bool> mCullFaceEnabled;
+    
+    GLStateCacheStats mCurrentFrameStats;
+    GLStateCacheStats mLastFrameStats;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* GLStateCache_h */
@@ -0,0 +1,115 @@
+///------------------------------------------------------------------------------------------------
+///  IRenderDevice.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef IRenderDevice_h
+#define IRenderDevice_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../common/utils/MathUtils.h"
+
+#include <cstddef>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+using GLbitfield = unsigned int;
+using GLenum     = unsigned int;
+using GLint      = int;
+using GLsizei    = int;
+using GLuint     = unsigned int;
+
+///-----------------------------------------------------------------------------------------------
+/// The commands the rendering system issues to the GPU: object creation, buffer and texture uploads,
+/// state changes and draws. Enums and object ids follow their GL counterparts, so that the OpenGL
+/// implementation is a direct pass through and other implementations (e.g. the recording one used
+/// for headless runs) can reason about them in the same terms.
+class IRenderDevice
+{
+public:
+    virtual ~IRenderDevice() = default;
+    IRenderDevice(const IRenderDevice&) = delete;
+    const IRenderDevice& operator = (const IRenderDevice&) = delete;
+
+    // Object creation
+    virtual GLuint VCreateBuffer() = 0;
+    virtual GLuint VCreateVertexArray() = 0;
+    virtual GLuint VCreateTexture() = 0;
+    virtual GLuint VCreateFramebuffer() = 0;
+
+    // Buffers
+    virtual void VBindBuffer(const GLenum target, const GLuint buffer) = 0;
+    virtual void VBindBufferBase(const GLenum target, const GLuint bindingPoint, const GLuint buffer) = 0;
+    virtual void VBufferData(const GLenum target, const std::size_t byteSize, const void* data, const GLenum usage) = 0;
+    virtual void VBufferSubData(const GLenum target, const std::size_t byteOffset, const std::size_t byteSize, const void* data) = 0;
+
+    // Vertex arrays (all vertex attributes are non normalized floats)
+    virtual void VBindVertexArray(const GLuint vertexArray) = 0;
+    virtual void VSetVertexAttributeEnabled(const GLuint attributeLocation, const bool enabled) = 0;
+    virtual void VSetVertexAttributePointer(const GLuint attributeLocation, const GLint componentCount, const GLsizei stride, const std::size_t byteOffset) = 0;
+    virtual void VSetVertexAttributeDivisor(const GLuint attributeLocation, const GLuint divisor) = 0;
+
+    // 2D textures
+    virtual void VSetActiveTextureUnit(const GLuint textureUnit) = 0;
+    virtual void VBindTexture(const GLuint texture) = 0;
+    virtual void VTextureImage2D(const GLint internalFormat, const GLsizei width, const GLsizei height, const GLenum format, const GLenum type, const void* data) = 0;
+    virtual void VSetTextureParameter(const GLenum parameter, const GLint value) = 0;
+    virtual void VSetTextureParameterValues(const GLenum parameter, const float* values) = 0;
+
+    // Framebuffers
+    virtual void VBindFramebuffer(const GLuint framebuffer) = 0;
+    virtual void VAttachFramebufferDepthTexture(const GLuint texture) = 0;
+    virtual void VSetDrawBuffer(const GLenum buffer) = 0;
+    virtual bool VIsFramebufferComplete() = 0;
+
+    // Programs and uniforms (counts are in elements of the uniform's type)
+    virtual void VUseProgram(const GLuint program) = 0;
+    virtual void VSetUniformMatrix4(const GLint location, const GLsizei count, const float* values) = 0;
+    virtual void VSetUniformVec4(const GLint location, const GLsizei count, const float* values) = 0;
+    virtual void VSetUniformVec3(const GLint location, const GLsizei count, const float* values) = 0;
+    virtual void VSetUniformFloat(const GLint location, const GLsizei count, const float* values) = 0;
+    virtual void VSetUniformInt(const GLint location, const GLsizei count, const GLint* values) = 0;
+
+    // Fixed function state
+    virtual void VSetCapabilityEnabled(const GLenum capability, const bool enabled) = 0;
+    virtual void VSetBlendFunc(const GLenum sourceFactor, const GLenum destinationFactor) = 0;
+    virtual void VSetDepthFunc(const GLenum depthFunc) = 0;
+    virtual void VSetDepthMask(const bool enabled) = 0;
+    virtual void VSetCullFace(const GLenum face) = 0;
+    virtual void VSetViewport(const GLint x, const GLint y, const GLsizei width, const GLsizei height) = 0;
+    virtual void VSetClearColor(const glm::vec4& clearColor) = 0;
+    virtual void VClear(const GLbitfield mask) = 0;
+
+    // Draws
+    virtual void VDrawArrays(const GLenum mode, const GLint first, const GLsizei count) = 0;
+    virtual void VDrawArraysInstanced(const GLenum mode, const GLint first, const GLsizei count, const GLsizei instanceCount) = 0;
+    virtual void VDrawElements(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset) = 0;
+    virtual void VDrawElementsBaseVertex(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset, const GLint baseVertex) = 0;
+    virtual void VDrawElementsInstancedBaseVertex(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset, const GLsizei instanceCount, const GLint baseVertex) = 0;
+
+protected:
+    IRenderDevice() = default;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* IRenderDevice_h */
@@ -0,0 +1,488 @@
+///------------------------------------------------------------------------------------------------
+///  RecordingRenderDevice.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "RecordingRenderDevice.h"
+
+#include <algorithm>
+#include <cassert>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const std::array<std::string, static_cast<std::size_t>(RenderCommandType::COUNT)> RENDER_COMMAND_NAMES =
+    {
+        "CreateBuffer",
+        "CreateVertexArray",
+        "CreateTexture",
+        "CreateFramebuffer",
+        "BindBuffer",
+        "BindBufferBase",
+        "BufferData",
+        "BufferSubData",
+        "BindVertexArray",
+        "SetVertexAttributeEnabled",
+        "SetVertexAttributePointer",
+        "SetVertexAttributeDivisor",
+        "SetActiveTextureUnit",
+        "BindTexture",
+        "TextureImage2D",
+        "SetTextureParameter",
+        "SetTextureParameterValues",
+        "BindFramebuffer",
+        "AttachFramebufferDepthTexture",
+        "SetDrawBuffer",
+        "CheckFramebufferStatus",
+        "UseProgram",
+        "SetUniformMatrix4",
+        "SetUniformVec4",
+        "SetUniformVec3",
+        "SetUniformFloat",
+        "SetUniformInt",
+        "SetCapabilityEnabled",
+        "SetBlendFunc",
+        "SetDepthFunc",
+        "SetDepthMask",
+        "SetCullFace",
+        "SetViewport",
+        "SetClearColor",
+        "Clear",
+        "DrawArrays",
+        "DrawArraysInstanced",
+        "DrawElements",
+        "DrawElementsBaseVertex",
+        "DrawElementsInstancedBaseVertex"
+    };
+    
+    static const std::array<RenderCommandType, 5> DRAW_COMMAND_TYPES =
+    {
+        RenderCommandType::DRAW_ARRAYS,
+        RenderCommandType::DRAW_ARRAYS_INSTANCED,
+        RenderCommandType::DRAW_ELEMENTS,
+        RenderCommandType::DRAW_ELEMENTS_BASE_VERTEX,
+        RenderCommandType::DRAW_ELEMENTS_INSTANCED_BASE_VERTEX
+    };
+    
+    // Enough digits to write back any float argument, and any integer argument below 10^10, exactly
+    static const int COMMAND_ARGUMENT_PRECISION = 10;
+    
+    // All textures uploaded with data by the engine are 8 bit RGBA ones
+    static const std::size_t TEXTURE_UPLOAD_BYTES_PER_TEXEL = 4;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+const std::string& GetRenderCommandName(const RenderCommandType commandType)
+{
+    return RENDER_COMMAND_NAMES[static_cast<std::size_t>(commandType)];
+}
+
+///-----------------------------------------------------------------------------------------------
+
+RecordingRenderDevice::RecordingRenderDevice(const bool recordCommandStream /* true */)
+    : mRecordCommandStream(recordCommandStream)
+    , mNextObjectId(1)
+{
+    Reset();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+const std::vector<RenderCommand>& RecordingRenderDevice::GetCommands() const
+{
+    return mCommands;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+std::size_t RecordingRenderDevice::GetCommandCount(const RenderCommandType commandType) const
+{
+    return mCommandCounts[static_cast<std::size_t>(commandType)];
+}
+
+///-----------------------------------------------------------------------------------------------
+
+std::size_t RecordingRenderDevice::GetDrawCallCount() const
+{
+    std::size_t drawCallCount = 0;
+    for (const auto commandType: DRAW_COMMAND_TYPES)
+    {
+        drawCallCount += GetCommandCount(commandType);
+    }
+    return drawCallCount;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+std::size_t RecordingRenderDevice::GetUploadedByteCount() const
+{
+    return mUploadedByteCount;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::Reset()
+{
+    mCommands.clear();
+    mCommandCounts.fill(0);
+    mUploadedByteCount = 0;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::WriteCommandStream(std::ostream& stream) const
+{
+    const auto previousPrecision = stream.precision(COMMAND_ARGUMENT_PRECISION);
+    for (const auto& command: mCommands)
+    {
+        stream << GetRenderCommandName(command.mType) << '(';
+        for (auto i = 0U; i < command.mArgumentCount; ++i)
+        {
+            stream << (i == 0 ? "" : ", ") << command.mArguments[i];
+        }
+        stream << ')';
+        
+        if (command.mByteSize > 0)
+        {
+            stream << " " << command.mByteSize << " bytes";
+        }
+        stream << '\n';
+    }
+    stream.precision(previousPrecision);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+GLuint RecordingRenderDevice::VCreateBuffer()
+{
+    return CreateObject(RenderCommandType::CREATE_BUFFER);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+GLuint RecordingRenderDevice::VCreateVertexArray()
+{
+    return CreateObject(RenderCommandType::CREATE_VERTEX_ARRAY);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+GLuint RecordingRenderDevice::VCreateTexture()
+{
+    return CreateObject(RenderCommandType::CREATE_TEXTURE);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+GLuint RecordingRenderDevice::VCreateFramebuffer()
+{
+    return CreateObject(RenderCommandType::CREATE_FRAMEBUFFER);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VBindBuffer(const GLenum target, const GLuint buffer)
+{
+    RecordCommand(RenderCommandType::BIND_BUFFER, { static_cast<double>(target), static_cast<double>(buffer) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VBindBufferBase(const GLenum target, const GLuint bindingPoint, const GLuint buffer)
+{
+    RecordCommand(RenderCommandType::BIND_BUFFER_BASE, { static_cast<double>(target), static_cast<double>(bindingPoint), static_cast<double>(buffer) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VBufferData(const GLenum target, const std::size_t byteSize, const void* data, const GLenum usage)
+{
+    // Allocations without data (and orphaning) upload nothing
+    RecordCommand(RenderCommandType::BUFFER_DATA, { static_cast<double>(target), static_cast<double>(byteSize), static_cast<double>(usage) }, data != nullptr ? byteSize : 0);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VBufferSubData(const GLenum target, const std::size_t byteOffset, const std::size_t byteSize, const void*)
+{
+    RecordCommand(RenderCommandType::BUFFER_SUB_DATA, { static_cast<double>(target), static_cast<double>(byteOffset) }, byteSize);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VBindVertexArray(const GLuint vertexArray)
+{
+    RecordCommand(RenderCommandType::BIND_VERTEX_ARRAY, { static_cast<double>(vertexArray) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetVertexAttributeEnabled(const GLuint attributeLocation, const bool enabled)
+{
+    RecordCommand(RenderCommandType::SET_VERTEX_ATTRIBUTE_ENABLED, { static_cast<double>(attributeLocation), enabled ? 1.0 : 0.0 });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetVertexAttributePointer(const GLuint attributeLocation, const GLint componentCount, const GLsizei stride, const std::size_t byteOffset)
+{
+    RecordCommand(RenderCommandType::SET_VERTEX_ATTRIBUTE_POINTER, { static_cast<double>(attributeLocation), static_cast<double>(componentCount), static_cast<double>(stride), static_cast<double>(byteOffset) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetVertexAttributeDivisor(const GLuint attributeLocation, const GLuint divisor)
+{
+    RecordCommand(RenderCommandType::SET_VERTEX_ATTRIBUTE_DIVISOR, { static_cast<double>(attributeLocation), static_cast<double>(divisor) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetActiveTextureUnit(const GLuint textureUnit)
+{
+    RecordCommand(RenderCommandType::SET_ACTIVE_TEXTURE_UNIT, { static_cast<double>(textureUnit) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VBindTexture(const GLuint texture)
+{
+    RecordCommand(RenderCommandType::BIND_TEXTURE, { static_cast<double>(texture) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VTextureImage2D(const GLint internalFormat, const GLsizei width, const GLsizei height, const GLenum format, const GLenum type, const void* data)
+{
+    const auto byteSize = data != nullptr ? static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * TEXTURE_UPLOAD_BYTES_PER_TEXEL : 0U;
+    RecordCommand(RenderCommandType::TEXTURE_IMAGE_2D, { static_cast<double>(internalFormat), static_cast<double>(width), static_cast<double>(height), static_cast<double>(format), static_cast<double>(type) }, byteSize);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetTextureParameter(const GLenum parameter, const GLint value)
+{
+    RecordCommand(RenderCommandType::SET_TEXTURE_PARAMETER, { static_cast<double>(parameter), static_cast<double>(value) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetTextureParameterValues(const GLenum parameter, const float* values)
+{
+    // All vector texture parameters the engine sets (border colors) have 4 components
+    RecordCommand(RenderCommandType::SET_TEXTURE_PARAMETER_VALUES, { static_cast<double>(parameter), values[0], values[1], values[2], values[3] });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VBindFramebuffer(const GLuint framebuffer)
+{
+    RecordCommand(RenderCommandType::BIND_FRAMEBUFFER, { static_cast<double>(framebuffer) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VAttachFramebufferDepthTexture(const GLuint texture)
+{
+    RecordCommand(RenderCommandType::ATTACH_FRAMEBUFFER_DEPTH_TEXTURE, { static_cast<double>(texture) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetDrawBuffer(const GLenum buffer)
+{
+    RecordCommand(RenderCommandType::SET_DRAW_BUFFER, { static_cast<double>(buffer) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+bool RecordingRenderDevice::VIsFramebufferComplete()
+{
+    RecordCommand(RenderCommandType::CHECK_FRAMEBUFFER_STATUS, {});
+    return true;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VUseProgram(const GLuint program)
+{
+    RecordCommand(RenderCommandType::USE_PROGRAM, { static_cast<double>(program) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetUniformMatrix4(const GLint location, const GLsizei count, const float*)
+{
+    RecordCommand(RenderCommandType::SET_UNIFORM_MATRIX4, { static_cast<double>(location), static_cast<double>(count) }, count * sizeof(glm::mat4));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetUniformVec4(const GLint location, const GLsizei count, const float*)
+{
+    RecordCommand(RenderCommandType::SET_UNIFORM_VEC4, { static_cast<double>(location), static_cast<double>(count) }, count * sizeof(glm::vec4));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetUniformVec3(const GLint location, const GLsizei count, const float*)
+{
+    RecordCommand(RenderCommandType::SET_UNIFORM_VEC3, { static_cast<double>(location), static_cast<double>(count) }, count * sizeof(glm::vec3));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetUniformFloat(const GLint location, const GLsizei count, const float*)
+{
+    RecordCommand(RenderCommandType::SET_UNIFORM_FLOAT, { static_cast<double>(location), static_cast<double>(count) }, count * sizeof(float));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetUniformInt(const GLint location, const GLsizei count, const GLint*)
+{
+    RecordCommand(RenderCommandType::SET_UNIFORM_INT, { static_cast<double>(location), static_cast<double>(count) }, count * sizeof(GLint));
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetCapabilityEnabled(const GLenum capability, const bool enabled)
+{
+    RecordCommand(RenderCommandType::SET_CAPABILITY_ENABLED, { static_cast<double>(capability), enabled ? 1.0 : 0.0 });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetBlendFunc(const GLenum sourceFactor, const GLenum destinationFactor)
+{
+    RecordCommand(RenderCommandType::SET_BLEND_FUNC, { static_cast<double>(sourceFactor), static_cast<double>(destinationFactor) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetDepthFunc(const GLenum depthFunc)
+{
+    RecordCommand(RenderCommandType::SET_DEPTH_FUNC, { static_cast<double>(depthFunc) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetDepthMask(const bool enabled)
+{
+    RecordCommand(RenderCommandType::SET_DEPTH_MASK, { enabled ? 1.0 : 0.0 });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetCullFace(const GLenum face)
+{
+    RecordCommand(RenderCommandType::SET_CULL_FACE, { static_cast<double>(face) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetViewport(const GLint x, const GLint y, const GLsizei width, const GLsizei height)
+{
+    RecordCommand(RenderCommandType::SET_VIEWPORT, { static_cast<double>(x), static_cast<double>(y), static_cast<double>(width), static_cast<double>(height) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VSetClearColor(const glm::vec4& clearColor)
+{
+    RecordCommand(RenderCommandType::SET_CLEAR_COLOR, { clearColor.r, clearColor.g, clearColor.b, clearColor.a });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VClear(const GLbitfield mask)
+{
+    RecordCommand(RenderCommandType::CLEAR, { static_cast<double>(mask) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VDrawArrays(const GLenum mode, const GLint first, const GLsizei count)
+{
+    RecordCommand(RenderCommandType::DRAW_ARRAYS, { static_cast<double>(mode), static_cast<double>(first), static_cast<double>(count) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VDrawArraysInstanced(const GLenum mode, const GLint first, const GLsizei count, const GLsizei instanceCount)
+{
+    RecordCommand(RenderCommandType::DRAW_ARRAYS_INSTANCED, { static_cast<double>(mode), static_cast<double>(first), static_cast<double>(count), static_cast<double>(instanceCount) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VDrawElements(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset)
+{
+    RecordCommand(RenderCommandType::DRAW_ELEMENTS, { static_cast<double>(mode), static_cast<double>(count), static_cast<double>(type), static_cast<double>(byteOffset) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VDrawElementsBaseVertex(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset, const GLint baseVertex)
+{
+    RecordCommand(RenderCommandType::DRAW_ELEMENTS_BASE_VERTEX, { static_cast<double>(mode), static_cast<double>(count), static_cast<double>(type), static_cast<double>(byteOffset), static_cast<double>(baseVertex) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::VDrawElementsInstancedBaseVertex(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset, const GLsizei instanceCount, const GLint baseVertex)
+{
+    RecordCommand(RenderCommandType::DRAW_ELEMENTS_INSTANCED_BASE_VERTEX, { static_cast<double>(mode), static_cast<double>(count), static_cast<double>(type), static_cast<double>(byteOffset), static_cast<double>(instanceCount), static_cast<double>(baseVertex) });
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordingRenderDevice::RecordCommand(const RenderCommandType commandType, const std::initializer_list<double> arguments, const std::size_t byteSize /* 0 */)
+{
+    assert(arguments.size() <= MAX_RENDER_COMMAND_ARGUMENTS && "Too many render command arguments");
+    
+    mCommandCounts[static_cast<std::size_t>(commandType)]++;
+    mUploadedByteCount += byteSize;
+    
+    if (mRecordCommandStream)
+    {
+        RenderCommand command;
+        command.mType = commandType;
+        command.mArguments.fill(0.0);
+        std::copy(arguments.begin(), arguments.end(), command.mArguments.begin());
+        command.mArgumentCount = arguments.size();
+        command.mByteSize = byteSize;
+        mCommands.push_back(command);
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+GLuint RecordingRenderDevice::CreateObject(const RenderCommandType commandType)
+{
+    const auto objectId = mNextObjectId++;
+    RecordCommand(commandType, { static_cast<double>(objectId) });
+    return objectId;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
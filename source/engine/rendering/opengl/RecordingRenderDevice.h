@@ -0,0 +1,205 @@
+///------------------------------------------------------------------------------------------------
+///  RecordingRenderDevice.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef RecordingRenderDevice_h
+#define RecordingRenderDevice_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "IRenderDevice.h"
+
+#include <array>
+#include <initializer_list>
+#include <ostream>
+#include <string>
+#include <vector>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+enum class RenderCommandType
+{
+    CREATE_BUFFER = 0,
+    CREATE_VERTEX_ARRAY,
+    CREATE_TEXTURE,
+    CREATE_FRAMEBUFFER,
+    BIND_BUFFER,
+    BIND_BUFFER_BASE,
+    BUFFER_DATA,
+    BUFFER_SUB_DATA,
+    BIND_VERTEX_ARRAY,
+    SET_VERTEX_ATTRIBUTE_ENABLED,
+    SET_VERTEX_ATTRIBUTE_POINTER,
+    SET_VERTEX_ATTRIBUTE_DIVISOR,
+    SET_ACTIVE_TEXTURE_UNIT,
+    BIND_TEXTURE,
+    TEXTURE_IMAGE_2D,
+    SET_TEXTURE_PARAMETER,
+    SET_TEXTURE_PARAMETER_VALUES,
+    BIND_FRAMEBUFFER,
+    ATTACH_FRAMEBUFFER_DEPTH_TEXTURE,
+    SET_DRAW_BUFFER,
+    CHECK_FRAMEBUFFER_STATUS,
+    USE_PROGRAM,
+    SET_UNIFORM_MATRIX4,
+    SET_UNIFORM_VEC4,
+    SET_UNIFORM_VEC3,
+    SET_UNIFORM_FLOAT,
+    SET_UNIFORM_INT,
+    SET_CAPABILITY_ENABLED,
+    SET_BLEND_FUNC,
+    SET_DEPTH_FUNC,
+    SET_DEPTH_MASK,
+    SET_CULL_FACE,
+    SET_VIEWPORT,
+    SET_CLEAR_COLOR,
+    CLEAR,
+    DRAW_ARRAYS,
+    DRAW_ARRAYS_INSTANCED,
+    DRAW_ELEMENTS,
+    DRAW_ELEMENTS_BASE_VERTEX,
+    DRAW_ELEMENTS_INSTANCED_BASE_VERTEX,
+    COUNT
+};
+
+///-----------------------------------------------------------------------------------------------
+
+static constexpr std::size_t MAX_RENDER_COMMAND_ARGUMENTS = 6;
+
+///-----------------------------------------------------------------------------------------------
+/// A single command issued to a RecordingRenderDevice. Data pointers are not kept, only the number
+/// of bytes they pointed to.
+struct RenderCommand final
+{
+    RenderCommandType mType;
+    std::array<double, MAX_RENDER_COMMAND_ARGUMENTS> mArguments;
+    std::size_t mArgumentCount;
+    std::size_t mByteSize;
+};
+
+///-----------------------------------------------------------------------------------------------
+/// @param[in] commandType the type of command to get the name of.
+/// @returns the display name of the given command type.
+const std::string& GetRenderCommandName(const RenderCommandType commandType);
+
+///-----------------------------------------------------------------------------------------------
+/// Captures the commands issued to it in memory instead of executing them, so that the rendering
+/// passes can run (and be measured or have their command streams compared) without a GL context.
+/// Created objects get sequential ids starting from 1, and framebuffers are always complete.
+class RecordingRenderDevice final: public IRenderDevice
+{
+public:
+    /// @param[in] recordCommandStream whether to keep every issued command around, or just
+    /// count them and their uploaded bytes (cheaper for long benchmark runs).
+    RecordingRenderDevice(const bool recordCommandStream = true);
+    
+    /// @returns the commands recorded since the last reset, in issue order.
+    const std::vector<RenderCommand>& GetCommands() const;
+    
+    /// @param[in] commandType the type of command to get the count of.
+    /// @returns the number of commands of the given type issued since the last reset.
+    std::size_t GetCommandCount(const RenderCommandType commandType) const;
+    
+    /// @returns the number of draw commands (of any kind) issued since the last reset.
+    std::size_t GetDrawCallCount() const;
+    
+    /// @returns the number of buffer, texture and uniform bytes uploaded since the last reset.
+    std::size_t GetUploadedByteCount() const;
+    
+    /// Forgets all recorded commands and counts. Object ids keep increasing across resets.
+    void Reset();
+    
+    /// Writes the recorded commands one per line (name, arguments, uploaded bytes), in a form
+    /// suitable for diffing the command streams of two runs.
+    /// @param[in] stream the stream to write the commands to.
+    void WriteCommandStream(std::ostream& stream) const;
+    
+    // Object creation
+    GLuint VCreateBuffer() override;
+    GLuint VCreateVertexArray() override;
+    GLuint VCreateTexture() override;
+    GLuint VCreateFramebuffer() override;
+
+    // Buffers
+    void VBindBuffer(const GLenum target, const GLuint buffer) override;
+    void VBindBufferBase(const GLenum target, const GLuint bindingPoint, const GLuint buffer) override;
+    void VBufferData(const GLenum target, const std::size_t byteSize, const void* data, const GLenum usage) override;
+    void VBufferSubData(const GLenum target, const std::size_t byteOffset, const std::size_t byteSize, const void* data) override;
+
+    // Vertex arrays
+    void VBindVertexArray(const GLuint vertexArray) override;
+    void VSetVertexAttributeEnabled(const GLuint attributeLocation, const bool enabled) override;
+    void VSetVertexAttributePointer(const GLuint attributeLocation, const GLint componentCount, const GLsizei stride, const std::size_t byteOffset) override;
+    void VSetVertexAttributeDivisor(const GLuint attributeLocation, const GLuint divisor) override;
+
+    // 2D textures
+    void VSetActiveTextureUnit(const GLuint textureUnit) override;
+    void VBindTexture(const GLuint texture) override;
+    void VTextureImage2D(const GLint internalFormat, const GLsizei width, const GLsizei height, const GLenum format, const GLenum type, const void* data) override;
+    void VSetTextureParameter(const GLenum parameter, const GLint value) override;
+    void VSetTextureParameterValues(const GLenum parameter, const float* values) override;
+
+    // Framebuffers
+    void VBindFramebuffer(const GLuint framebuffer) override;
+    void VAttachFramebufferDepthTexture(const GLuint texture) override;
+    void VSetDrawBuffer(const GLenum buffer) override;
+    bool VIsFramebufferComplete() override;
+
+    // Programs and uniforms
+    void VUseProgram(const GLuint program) override;
+    void VSetUniformMatrix4(const GLint location, const GLsizei count, const float* values) override;
+    void VSetUniformVec4(const GLint location, const GLsizei count, const float* values) override;
+    void VSetUniformVec3(const GLint location, const GLsizei count, const float* values) override;
+    void VSetUniformFloat(const GLint location, const GLsizei count, const float* values) override;
+    void VSetUniformInt(const GLint location, const GLsizei count, const GLint* values) override;
+
+    // Fixed function state
+    void VSetCapabilityEnabled(const GLenum capability, const bool enabled) override;
+    void VSetBlendFunc(const GLenum sourceFactor, const GLenum destinationFactor) override;
+    void VSetDepthFunc(const GLenum depthFunc) override;
+    void VSetDepthMask(const bool enabled) override;
+    void VSetCullFace(const GLenum face) override;
+    void VSetViewport(const GLint x, const GLint y, const GLsizei width, const GLsizei height) override;
+    void VSetClearColor(const glm::vec4& clearColor) override;
+    void VClear(const GLbitfield mask) override;
+
+    // Draws
+    void VDrawArrays(const GLenum mode, const GLint first, const GLsizei count) override;
+    void VDrawArraysInstanced(const GLenum mode, const GLint first, const GLsizei count, const GLsizei instanceCount) override;
+    void VDrawElements(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset) override;
+    void VDrawElementsBaseVertex(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset, const GLint baseVertex) override;
+    void VDrawElementsInstancedBaseVertex(const GLenum mode, const GLsizei count, const GLenum type, const std::size_t byteOffset, const GLsizei instanceCount, const GLint baseVertex) override;
+private:
+    void RecordCommand(const RenderCommandType commandType, const std::initializer_list<double> arguments, const std::size_t byteSize = 0);
+    GLuint CreateObject(const RenderCommandType commandType);
+    
+private:
+    const bool mRecordCommandStream;
+    std::vector<RenderCommand> mCommands;
+    std::array<std::size_t, static_cast<std::size_t>(RenderCommandType::COUNT)> mCommandCounts;
+    std::size_t mUploadedByteCount;
+    GLuint mNextObjectId;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* RecordingRenderDevice_h */
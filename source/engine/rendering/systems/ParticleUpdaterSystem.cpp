@@ -27,14 +27,16 @@ namespace rendering
 ParticleUpdaterSystem::ParticleUpdaterSystem()
     : BaseSystem()
 {
+    // Spent emitters are removed through the command buffer
+    DeclareReadAccess<TransformComponent>();
+    DeclareWriteAccess<ParticleEmitterComponent>();
 }
 
 ///-----------------------------------------------------------------------------------------------
 
-void ParticleUpdaterSystem::VUpdate(const float dt, const std::vector<ecs::EntityId>& entities) const
+void ParticleUpdaterSystem::VUpdate(const float dt, const std::vector<ecs::EntityId>& entitiesToProcess) const
 {
     auto& world = genesis::ecs::World::GetInstance();
-    const auto entitiesToProcess = entities;
     for (const auto& entityId: entitiesToProcess)
     {
         auto& particleEmitterComponent = world.GetComponent<ParticleEmitterComponent>(entityId);
@@ -86,7 +88,7 @@ void ParticleUpdaterSystem::VUpdate(const float dt, const std::vector<ecs::Entit
                 // Remove emitter if all initial particles are finished
                 if (deadParticles == particleEmitterComponent.mParticlePositions.size())
                 {
-                    world.RemoveComponent<ParticleEmitterComponent>(entityId);
+                    world.GetCommandBuffer().RemoveComponent<ParticleEmitterComponent>(entityId);
                     continue;
                 }
             } break;
@@ -7,28 +7,41 @@
 
 #include "RenderingSystem.h"
 #include "../components/CameraSingletonComponent.h"
+#include "../components/FontsStoreSingletonComponent.h"
 #include "../components/LightStoreSingletonComponent.h"
 #include "../components/HeightMapComponent.h"
 #include "../components/ParticleEmitterComponent.h"
 #include "../components/RenderableComponent.h"
 #include "../components/RenderingContextSingletonComponent.h"
+#include "../components/RenderStatsSingletonComponent.h"
 #include "../components/ShaderStoreSingletonComponent.h"
 #include "../components/TextStringComponent.h"
 #include "../components/WindowSingletonComponent.h"
 #include "../opengl/Context.h"
 #include "../utils/CameraUtils.h"
+#include "../utils/FrustumCullingUtils.h"
+#include "../utils/OcclusionCullingUtils.h"
+#include "../utils/RenderQueueUtils.h"
+#include "../utils/RenderStatsUtils.h"
+#include "../utils/ShadowCascadeUtils.h"
+#include "../utils/ShaderUniformUtils.h"
 #include "../../common/components/TransformComponent.h"
 #include "../../common/utils/FileUtils.h"
 #include "../../common/utils/Logging.h"
 #include "../../common/utils/MathUtils.h"
 #include "../../common/utils/OSMessageBox.h"
+#include "../../debug/Profiler.h"
 #include "../../resources/MeshResource.h"
 #include "../../resources/ResourceLoadingService.h"
 #include "../../resources/TextureResource.h"
 #include "../../sound/SoundService.h"
 
-#include <algorithm> // sort
+#include <algorithm> // transform
+#include <array>
+#include <cstddef>   // offsetof
 #include <cstdlib>   // exit
+#include <cstring>   // memcpy
+#include <limits>
 #include <SDL.h> 
 #include <vector>
 #include <iterator>
@@ -47,40 +60,140 @@ namespace rendering
 
 namespace
 {
-    static const StringId WORLD_MARIX_UNIFORM_NAME          = StringId("world");
-    static const StringId VIEW_MARIX_UNIFORM_NAME           = StringId("view");
-    static const StringId PROJECTION_MARIX_UNIFORM_NAME     = StringId("proj");
-    static const StringId NORMAL_MATRIX_UNIFORM_NAME        = StringId("norm");
-    static const StringId MATERIAL_AMBIENT_UNIFORM_NAME     = StringId("material_ambient");
-    static const StringId MATERIAL_DIFFUSE_UNIFORM_NAME     = StringId("material_diffuse");
-    static const StringId MATERIAL_SPECULAR_UNIFORM_NAME    = StringId("material_specular");
-    static const StringId MATERIAL_SHININESS_UNIFORM_NAME   = StringId("material_shininess");
-    static const StringId LIGHT_POSITIONS_UNIFORM_NAME      = StringId("light_positions");
-    static const StringId LIGHT_POWERS_UNIFORM_NAME         = StringId("light_powers");
-    static const StringId DT_ACCUM_UNIFORM_NAME             = StringId("dt_accumulator");
-    static const StringId EYE_POSITION_UNIFORM_NAME         = StringId("eye_pos");
-    static const StringId IS_AFFECTED_BY_LIGHT_UNIFORM_NAME = StringId("is_affected_by_light");
-    static const StringId LIGHT_SPACE_MATRIX_UNIFORM_NAME   = StringId("light_space_matrix");
-    static const StringId SHADOW_MAP_TEXTURE_UNIFORM_NAME   = StringId("shadowMap_texture");
-    static const StringId SHADOWS_ENABLED_UNIFORM_NAME      = StringId("shadows_enabled");
+    static const UniformSlot WORLD_MATRIX_UNIFORM_SLOT         = GetUniformSlot(StringId("world"));
+    static const UniformSlot NORMAL_MATRIX_UNIFORM_SLOT        = GetUniformSlot(StringId("norm"));
+    static const UniformSlot MATERIAL_AMBIENT_UNIFORM_SLOT     = GetUniformSlot(StringId("material_ambient"));
+    static const UniformSlot MATERIAL_DIFFUSE_UNIFORM_SLOT     = GetUniformSlot(StringId("material_diffuse"));
+    static const UniformSlot MATERIAL_SPECULAR_UNIFORM_SLOT    = GetUniformSlot(StringId("material_specular"));
+    static const UniformSlot MATERIAL_SHININESS_UNIFORM_SLOT   = GetUniformSlot(StringId("material_shininess"));
+    static const UniformSlot IS_AFFECTED_BY_LIGHT_UNIFORM_SLOT = GetUniformSlot(StringId("is_affected_by_light"));
+    static const UniformSlot CUSTOM_COLOR_UNIFORM_SLOT         = GetUniformSlot(StringId("custom_color"));
+    static const UniformSlot SHADOW_CASCADE_INDEX_UNIFORM_SLOT = GetUniformSlot(StringId("shadow_cascade_index"));
+    static const UniformSlot SHADOW_MAP_TEXTURE_UNIFORM_SLOTS[MAX_SHADOW_CASCADE_COUNT] =
+    {
+        GetUniformSlot(StringId("shadowMap_texture_0")),
+        GetUniformSlot(StringId("shadowMap_texture_1")),
+        GetUniformSlot(StringId("shadowMap_texture_2")),
+        GetUniformSlot(StringId("shadowMap_texture_3"))
+    };
     static const StringId SKELETAL_MODEL_DEPTH_SHADER_NAME  = StringId("skeletal_model_depth");
     static const StringId STATIC_MODEL_DEPTH_SHADER_NAME    = StringId("static_model_depth");
     
+    // Shaders whose static models can be drawn instanced, and the instanced variants to draw them with
+    static const tsl::robin_map<StringId, StringId, StringIdHasher> SHADER_NAME_TO_INSTANCED_SHADER_NAME =
+    {
+        { StringId("default_3d"),     StringId("default_3d_instanced") },
+        { StringId("highlighted_3d"), StringId("highlighted_3d_instanced") }
+    };
+    
+    // Text shaders whose strings can be batched, and the batched variants to draw them with
+    static const tsl::robin_map<StringId, StringId, StringIdHasher> SHADER_NAME_TO_BATCHED_TEXT_SHADER_NAME =
+    {
+        { StringId("default_gui"), StringId("default_gui_batched") },
+        { StringId("text_3d"),     StringId("text_3d_batched") }
+    };
+    
+    // Corners of the glyph quad mesh (gui_atlas_quad.obj) in vertex order, and the two triangles they form
+    static const std::array<glm::vec4, 4> GLYPH_QUAD_CORNERS =
+    {
+        glm::vec4(-0.5f,  0.5f, 0.0f, 1.0f),
+        glm::vec4( 0.5f,  0.5f, 0.0f, 1.0f),
+        glm::vec4( 0.5f, -0.5f, 0.0f, 1.0f),
+        glm::vec4(-0.5f, -0.5f, 0.0f, 1.0f)
+    };
+    static const std::array<std::size_t, 6> GLYPH_QUAD_CORNER_INDICES = { 0, 1, 2, 2, 3, 0 };
+    
+    // Vertex positions and uvs of the particle quads, laid out as a triangle strip each. The first
+    // quad lies on the xz plane and the second one on the xy plane.
+    static const std::array<float, 24> PARTICLE_QUAD_VERTEX_POSITIONS =
+    {
+        0.0f, 0.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f,
+        1.0f, 0.0f, 1.0f,
+        
+        0.0f, 0.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        1.0f, 1.0f, 0.0f
+    };
+    
+    static const std::array<float, 16> PARTICLE_QUAD_UVS =
+    {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f,
+        
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f
+    };
+    
+    static const tsl::robin_map<ParticleEmitterType, GLint> PARTICLE_TYPE_TO_QUAD_FIRST_VERTEX =
+    {
+        { ParticleEmitterType::SMOKE, 0 },
+        { ParticleEmitterType::BLOOD_DROP, 0 },
+        { ParticleEmitterType::SMOKE_REVEAL, 4 }
+    };
+    
     static const std::string SHADERS_INCLUDE_DIR = "include/";
-
-    static const unsigned int SHADOW_TEXTURE_WIDTH  = 4096;
-    static const unsigned int SHADOW_TEXTURE_HEIGHT = 4096;
+    
+    // Matches the per instance attribute locations of the instanced shaders
+    static const GLuint INSTANCE_WORLD_MATRIX_ATTRIBUTE_LOCATION       = 3;
+    static const GLuint INSTANCE_NORMAL_MATRIX_ATTRIBUTE_LOCATION      = 7;
+    static const GLuint INSTANCE_MATERIAL_AMBIENT_ATTRIBUTE_LOCATION   = 11;
+    static const GLuint INSTANCE_MATERIAL_DIFFUSE_ATTRIBUTE_LOCATION   = 12;
+    static const GLuint INSTANCE_MATERIAL_SPECULAR_ATTRIBUTE_LOCATION  = 13;
+    static const GLuint INSTANCE_MATERIAL_SHININESS_ATTRIBUTE_LOCATION = 14;
+    
+    // Models flagged as occluders whose culling sphere radius over camera distance reaches this are rasterised
+    // as occluders, the largest ones first. Their proxy box spans the given fraction of their mesh bounds around
+    // the bounds' centre, keeping it inside their actual geometry for boxy models and always inside their culling sphere.
+    static const float MIN_OCCLUDER_MODEL_SCREEN_SIZE     = 0.1f;
+    static const std::size_t MAX_OCCLUDER_MODELS_PER_FRAME = 32;
+    static const float OCCLUDER_PROXY_DIMENSIONS_FRACTION = 0.5f;
+    // Height map chunks are drawn at their coarsest level of detail whose geometric error projects to at most this many pixels
+    static const float MAX_HEIGHTMAP_SCREEN_SPACE_ERROR = 2.0f;
+    
+    static const double NANOS_PER_MILLI = 1000000.0;
+    
+    static const std::vector<unsigned int> OCCLUDER_PROXY_BOX_INDICES =
+    {
+        0, 1, 3, 3, 2, 0, // -z
+        4, 6, 7, 7, 5, 4, // +z
+        0, 4, 5, 5, 1, 0, // -y
+        2, 3, 7, 7, 6, 2, // +y
+        0, 2, 6, 6, 4, 0, // -x
+        1, 5, 7, 7, 3, 1  // +x
+    };
 }
 
 ///-----------------------------------------------------------------------------------------------
 
+static bool CanBeRenderedInstanced(const RenderableComponent& renderableComponent, const resources::MeshResource& mesh);
+static bool CanBeRenderedBatched(const RenderableComponent& renderableComponent);
+static void UpdateTextStringVertices(const RenderableComponent& renderableComponent, const glm::mat4& worldMatrix, TextStringComponent& textStringComponent);
+static void EnableInstanceAttribute(IRenderDevice& renderDevice, const GLuint attributeLocation, const GLint componentCount, const std::size_t byteOffset);
+static glm::mat4 GetWorldMatrix(const TransformComponent& transformComponent, const RenderableComponent& renderableComponent, const WindowSingletonComponent& windowComponent);
+static void AddEntityCullingSphere(const ecs::EntityId entityId, CullingSpheres& cullingSpheres);
+static void RasterizeOccluders(const std::vector<ecs::EntityId>& applicableEntities, const CameraSingletonComponent& cameraComponent, RenderingContextSingletonComponent& renderingContextComponent);
+
+///-----------------------------------------------------------------------------------------------
+
 RenderingSystem::RenderingSystem()
     : BaseSystem()
 {
     InitializeCamera();
     InitializeLights();
-    InitializeShadowMapTexture();
-    InitializeFrameBuffers();
+    InitializeShadowMapTextures();
+    InitializeShadowMapFrameBuffers();
+    InitializeInstanceBuffer();
+    InitializeTextBuffers();
+    InitializeParticleBuffers();
+    InitializeFrameUniformBuffer();
+    InitializeRenderStats();
     CompileAndLoadShaders();
 }
 
@@ -94,7 +207,11 @@ void RenderingSystem::VUpdate(const float dt, const std::vector<ecs::EntityId>&
     const auto& windowComponent      = world.GetSingletonComponent<WindowSingletonComponent>();
     auto& cameraComponent            = world.GetSingletonComponent<CameraSingletonComponent>();
     auto& renderingContextComponent  = world.GetSingletonComponent<RenderingContextSingletonComponent>();
+    auto& lightStoreComponent        = world.GetSingletonComponent<LightStoreSingletonComponent>();
+    auto& renderStatsComponent       = world.GetSingletonComponent<RenderStatsSingletonComponent>();
     renderingContextComponent.mDtAccumulator += dt;
+    renderingContextComponent.mGLStateCache.BeginFrame();
+    BeginRenderStatsFrame(renderStatsComponent, renderingContextComponent.mGLStateCache);
     
     // Calculate render-constant camera view matrix
     cameraComponent.mViewMatrix = glm::lookAtLH(cameraComponent.mPosition, cameraComponent.mPosition + cameraComponent.mFrontVector, cameraComponent.mUpVector);
@@ -114,16 +231,49 @@ void RenderingSystem::VUpdate(const float dt, const std::vector<ecs::EntityId>&
     cameraComponent.mFrustum = CalculateCameraFrustum(cameraComponent.mViewMatrix, cameraComponent.mProjectionMatrix);
     
     // Collect all entities that need to be processed
-    std::vector<ecs::EntityId> applicableEntities = entitiesToProcess;
+    auto& renderQueue = renderingContextComponent.mRenderQueue;
+    renderQueue.clear();
+    renderQueue.reserve(entitiesToProcess.size());
+    for (const auto& entityId: entitiesToProcess)
+    {
+        const auto& transformComponent = world.GetComponent<TransformComponent>(entityId);
+        const auto& renderableComponent = world.GetComponent<RenderableComponent>(entityId);
+        renderQueue.push_back({ CalculateRenderQueueSortKey(transformComponent, renderableComponent), entityId });
+    }
+    
+    // Opaque models are ordered by draw state, while translucent ones keep their back-to-front depth order
+    SortRenderQueue(renderQueue, renderingContextComponent.mRenderQueueScratch);
     
-    // Sort entities based on their depth order to correct transparency
-    std::sort(applicableEntities.begin(), applicableEntities.end(), [&world](const genesis::ecs::EntityId& lhs, const genesis::ecs::EntityId& rhs)
+    std::vector<ecs::EntityId> applicableEntities(renderQueue.size());
+    std::transform(renderQueue.cbegin(), renderQueue.cend(), applicableEntities.begin(), [](const RenderQueueItem& renderQueueItem)
     {
-        const auto& lhsTransformComponent = world.GetComponent<TransformComponent>(lhs);
-        const auto& rhsTransformComponent = world.GetComponent<TransformComponent>(rhs);
-        return lhsTransformComponent.mPosition.z > rhsTransformComponent.mPosition.z;
+        return renderQueueItem.mEntityId;
     });
     
+    // Gather the culling spheres of all entities once, to be tested in bulk against the camera and light frusta
+    ClearCullingSpheres(renderingContextComponent.mCullingSpheres);
+    for (const auto& entityId: applicableEntities)
+    {
+        AddEntityCullingSphere(entityId, renderingContextComponent.mCullingSpheres);
+    }
+    
+    if (renderingContextComponent.mShadowsEnabled)
+    {
+        // Fit the main shadow casting light's cascades to this frame's camera frustum
+        UpdateShadowCascades
+        (
+            cameraComponent,
+            windowComponent.mRenderableWidth,
+            windowComponent.mRenderableHeight,
+            lightStoreComponent.mLightPositions[0],
+            renderingContextComponent.mShadowDistance,
+            renderingContextComponent.mShadowCascades
+        );
+    }
+    
+    // Upload the camera and light data shared by both passes once
+    UpdateFrameUniformBuffer(cameraComponent, lightStoreComponent, renderingContextComponent);
+    
     if (renderingContextComponent.mShadowsEnabled)
     {
         DepthRenderingPass(applicableEntities);
@@ -131,97 +281,104 @@ void RenderingSystem::VUpdate(const float dt, const std::vector<ecs::EntityId>&
     
     FinalRenderingPass(applicableEntities);
     
+    // Leave no vertex array object bound for GL calls made outside of the rendering system
+    renderingContextComponent.mGLStateCache.BindVertexArray(0);
+    EndRenderStatsFrame(renderStatsComponent, renderingContextComponent.mGLStateCache);
+    renderingContextComponent.mGLStateCache.EndFrame();
+    
+#if !defined(GENESIS_HEADLESS)
     // Swap window buffers
     SDL_GL_SwapWindow(windowComponent.mWindowHandle);
+#endif
 }
 
 ///-----------------------------------------------------------------------------------------------
 
 void RenderingSystem::DepthRenderingPass(const std::vector<ecs::EntityId>& applicableEntities) const
 {
+    const debug::ProfilerZone depthRenderingPassZone("DepthRenderingPass");
+    
     auto& world = ecs::World::GetInstance();
 
     // Get common rendering singleton components
     const auto& shaderStoreComponent = world.GetSingletonComponent<ShaderStoreSingletonComponent>();
     auto& renderingContextComponent  = world.GetSingletonComponent<RenderingContextSingletonComponent>();
-    auto& lightStoreComponent  = world.GetSingletonComponent<LightStoreSingletonComponent>();
-    
-    // Bind Depth frame buffer
-    GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, renderingContextComponent.mDepthMapFrameBufferObject));
-    
-    // Bind shadow viewport
-    GL_CHECK(glViewport(0, 0, SHADOW_TEXTURE_WIDTH, SHADOW_TEXTURE_HEIGHT));
+    auto& renderStatsComponent       = world.GetSingletonComponent<RenderStatsSingletonComponent>();
+    auto& renderDevice               = *renderingContextComponent.mRenderDevice;
     
-    // Clear depth buffer
-    GL_CHECK(glClear(GL_DEPTH_BUFFER_BIT));
-            
-    // Calculate main shadow casting ligth's matrices
-    auto lightProjectionMatrix = glm::ortho(-0.5f, 0.5f, -0.5f, 0.5f, 0.1f, 7.5f);
-    auto lightViewMatrix = glm::lookAt(lightStoreComponent.mLightPositions[0], glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-    lightStoreComponent.mMainShadowCastingLightMatrix = lightProjectionMatrix * lightViewMatrix;
+    const RenderPassStatsScope depthPassStatsScope(renderStatsComponent, renderingContextComponent.mGLStateCache, RenderPass::DEPTH);
+    auto& depthPassStats = GetRenderPassStats(renderStatsComponent, RenderPass::DEPTH);
     
-    // Execute shadow depth pass for 3d models
-    for (const auto& entityId : applicableEntities)
+    for (auto cascadeIndex = 0U; cascadeIndex < renderingContextComponent.mShadowCascades.size(); ++cascadeIndex)
     {
-        const auto& renderableComponent = world.GetComponent<RenderableComponent>(entityId);
-        if (renderableComponent.mIsCastingShadows)
+        const auto& shadowCascade = renderingContextComponent.mShadowCascades[cascadeIndex];
+        
+        // Bind the cascade's depth frame buffer and viewport
+        renderDevice.VBindFramebuffer(shadowCascade.mFrameBufferObject);
+        renderDevice.VSetViewport(0, 0, shadowCascade.mResolution, shadowCascade.mResolution);
+        
+        // Clear depth buffer
+        renderDevice.VClear(GL_DEPTH_BUFFER_BIT);
+        
+        // Point both depth shaders to the cascade's light space matrix
+        for (const auto& depthShaderName: { STATIC_MODEL_DEPTH_SHADER_NAME, SKELETAL_MODEL_DEPTH_SHADER_NAME })
         {
-            const auto& transformComponent = world.GetComponent<TransformComponent>(entityId);            
-
-            if (!renderableComponent.mIsVisible)
+            const auto& depthShader = shaderStoreComponent.mShaders.at(depthShaderName);
+            renderingContextComponent.mGLStateCache.UseProgram(depthShader.GetProgramId());
+            depthShader.SetInt(renderDevice, SHADOW_CASCADE_INDEX_UNIFORM_SLOT, static_cast<int>(cascadeIndex));
+        }
+        
+        // Casters covering fewer texels than the cascade's minimum are left out of it
+        const auto minCasterWorldSize = shadowCascade.mMinCasterSizeInTexels * shadowCascade.mTexelWorldSize;
+        
+        // Cull all casters against the cascade's light frustum
+        const auto& cullingSpheres = renderingContextComponent.mCullingSpheres;
+        auto& cullingResults = renderingContextComponent.mCullingResults;
+        CullSpheresAgainstFrustum(cullingSpheres, shadowCascade.mLightFrustum, cullingResults);
+        
+        // Execute shadow depth pass for 3d models
+        for (auto i = 0U; i < applicableEntities.size(); ++i)
+        {
+            const auto entityId = applicableEntities[i];
+            const auto& renderableComponent = world.GetComponent<RenderableComponent>(entityId);
+            if (!renderableComponent.mIsCastingShadows || !renderableComponent.mIsVisible)
             {
                 continue;
             }
-
-            const auto& currentMesh = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex]);
-            GL_CHECK(glBindVertexArray(currentMesh.GetVertexArrayObject()));
             
-            // Calculate world matrix for entity
-            glm::mat4 worldMat(1.0f);
-                
-            // Correct display of hud and billboard entities
-            glm::vec3 position = transformComponent.mPosition;
-            glm::vec3 scale    = transformComponent.mScale;
-            glm::vec3 rotation = transformComponent.mRotation;
+            if (!cullingResults[i] || cullingSpheres.mRadius[i] * 2.0f < minCasterWorldSize)
+            {
+                depthPassStats.mCulledEntityCount++;
+                continue;
+            }
             
-            glm::mat4 rotMatrix = glm::mat4_cast(math::EulerAnglesToQuat(rotation));
+            depthPassStats.mVisibleEntityCount++;
             
-            worldMat = glm::translate(worldMat, position);
-            worldMat *= rotMatrix;
-            worldMat = glm::scale(worldMat, scale);
-
-            auto& currentShader = shaderStoreComponent.mShaders.at(currentMesh.HasSkeleton() ? SKELETAL_MODEL_DEPTH_SHADER_NAME : STATIC_MODEL_DEPTH_SHADER_NAME);
-            GL_CHECK(glUseProgram(currentShader.GetProgramId()));
+            const auto& transformComponent = world.GetComponent<TransformComponent>(entityId);
+            const auto& currentMesh = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex]);
             
-            currentShader.SetMatrix4fv(LIGHT_SPACE_MATRIX_UNIFORM_NAME, lightStoreComponent.mMainShadowCastingLightMatrix);
+            renderingContextComponent.mGLStateCache.BindVertexArray(currentMesh.GetVertexArrayObject());
             
-            currentShader.SetMatrix4fv(WORLD_MARIX_UNIFORM_NAME, worldMat);
+            auto& currentShader = shaderStoreComponent.mShaders.at(currentMesh.HasSkeleton() ? SKELETAL_MODEL_DEPTH_SHADER_NAME : STATIC_MODEL_DEPTH_SHADER_NAME);
+            renderingContextComponent.mGLStateCache.UseProgram(currentShader.GetProgramId());
             
-            // Set other matrix uniforms
-            for (const auto& matrixUniformEntry: renderableComponent.mShaderUniforms.mShaderMatrixUniforms)
-            {
-                currentShader.SetMatrix4fv(matrixUniformEntry.first, matrixUniformEntry.second);
-            }
+            currentShader.SetMatrix4fv(renderDevice, WORLD_MATRIX_UNIFORM_SLOT, transformComponent.mWorldMatrix);
+            
+            // Set custom uniforms
+            currentShader.SetUniforms(renderDevice, renderableComponent.mShaderUniforms);
             
-            // Set other matrix array uniforms
-            for (const auto& mat4arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderMatrixArrayUniforms)
-            {
-                currentShader.SetMatrix4Array(mat4arrayUniformEntry.first, mat4arrayUniformEntry.second);
-            }
-
             // Perform draw call
             const auto& indexCountPerMesh = currentMesh.GetIndexCountPerMesh();
             const auto& baseIndexPerMesh = currentMesh.GetBaseIndexPerMesh();
             const auto& baseVertexPerMesh = currentMesh.GetBaseVertexPerMesh();
-            for (auto i = 0U; i < indexCountPerMesh.size(); ++i)
+            for (auto meshIndex = 0U; meshIndex < indexCountPerMesh.size(); ++meshIndex)
             {
-                if (indexCountPerMesh[i] > 0)
+                if (indexCountPerMesh[meshIndex] > 0)
                 {
-                    GL_CHECK(glDrawElementsBaseVertex(GL_TRIANGLES, indexCountPerMesh.at(i), GL_UNSIGNED_SHORT, (void*)(sizeof(unsigned short) * baseIndexPerMesh.at(i)), baseVertexPerMesh.at(i)));
+                    renderDevice.VDrawElementsBaseVertex(GL_TRIANGLES, indexCountPerMesh.at(meshIndex), GL_UNSIGNED_SHORT, sizeof(unsigned short) * baseIndexPerMesh.at(meshIndex), baseVertexPerMesh.at(meshIndex));
+                    RecordDrawCall(depthPassStats, indexCountPerMesh[meshIndex] / 3);
                 }
             }
-            
-            GL_CHECK(glBindVertexArray(0));
         }
     }
 }
@@ -230,40 +387,57 @@ void RenderingSystem::DepthRenderingPass(const std::vector<ecs::EntityId>& appli
 
 void RenderingSystem::FinalRenderingPass(const std::vector<ecs::EntityId>& applicableEntities) const
 {
+    const debug::ProfilerZone finalRenderingPassZone("FinalRenderingPass");
+    
     auto& world = ecs::World::GetInstance();
     
     // Get common rendering singleton components
     const auto& windowComponent      = world.GetSingletonComponent<WindowSingletonComponent>();
     const auto& shaderStoreComponent = world.GetSingletonComponent<ShaderStoreSingletonComponent>();
-    const auto& lightStoreComponent  = world.GetSingletonComponent<LightStoreSingletonComponent>();
-    const auto& cameraComponent            = world.GetSingletonComponent<CameraSingletonComponent>();
+    const auto& cameraComponent      = world.GetSingletonComponent<CameraSingletonComponent>();
     auto& renderingContextComponent  = world.GetSingletonComponent<RenderingContextSingletonComponent>();
+    auto& renderStatsComponent       = world.GetSingletonComponent<RenderStatsSingletonComponent>();
+    auto& renderDevice               = *renderingContextComponent.mRenderDevice;
+    
+    const RenderPassStatsScope finalPassStatsScope(renderStatsComponent, renderingContextComponent.mGLStateCache, RenderPass::FINAL);
     
     // Bind default frame buffer
-    GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+    renderDevice.VBindFramebuffer(0);
     
     // Set View Port
-    GL_CHECK(glViewport(0, 0, static_cast<GLsizei>(windowComponent.mRenderableWidth), static_cast<GLsizei>(windowComponent.mRenderableHeight)));
+    renderDevice.VSetViewport(0, 0, static_cast<GLsizei>(windowComponent.mRenderableWidth), static_cast<GLsizei>(windowComponent.mRenderableHeight));
     
     // Set background color
-    GL_CHECK(glClearColor
-    (
-        renderingContextComponent.mClearColor.x,
-        renderingContextComponent.mClearColor.y,
-        renderingContextComponent.mClearColor.z,
-        renderingContextComponent.mClearColor.w
-    ));
+    renderDevice.VSetClearColor(renderingContextComponent.mClearColor);
 
-    GL_CHECK(glEnable(GL_DEPTH_TEST));
+    renderingContextComponent.mGLStateCache.SetDepthTestEnabled(true);
     
     // Clear buffers
-    GL_CHECK(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
+    renderDevice.VClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     
     tsl::robin_map<RenderableType, std::vector<ecs::EntityId>> guiEntityGroups;
     std::vector<ecs::EntityId> particleEntities;
+    InstancedModelBatches instancedModelBatches;
+    
+    // Cull all entities against the camera frustum
+    auto& cullingResults = renderingContextComponent.mCullingResults;
+    CullSpheresAgainstFrustum(renderingContextComponent.mCullingSpheres, cameraComponent.mFrustum, cullingResults);
     
-    for (const auto& entityId : applicableEntities)
+    // Cull the entities in view that are hidden behind the terrain or large models
+    auto& occlusionResults = renderingContextComponent.mOcclusionResults;
+    if (renderingContextComponent.mOcclusionCullingEnabled)
     {
+        RasterizeOccluders(applicableEntities, cameraComponent, renderingContextComponent);
+        CullSpheresAgainstOcclusionDepthBuffer(renderingContextComponent.mCullingSpheres, cullingResults, renderingContextComponent.mOcclusionDepthBuffer, occlusionResults);
+    }
+    else
+    {
+        occlusionResults.assign(cullingResults.size(), 1);
+    }
+    
+    for (auto i = 0U; i < applicableEntities.size(); ++i)
+    {
+        const auto entityId = applicableEntities[i];
         const auto& renderableComponent = world.GetComponent<RenderableComponent>(entityId);
         if (renderableComponent.mRenderableType == RenderableType::NORMAL_MODEL)
         {
@@ -272,7 +446,7 @@ void RenderingSystem::FinalRenderingPass(const std::vector<ecs::EntityId>& appli
             // Render heightmap entities
             if (world.HasComponent<HeightMapComponent>(entityId))
             {
-                RenderHeightMapInternal(transformComponent, renderableComponent, world.GetComponent<HeightMapComponent>(entityId), cameraComponent, lightStoreComponent, shaderStoreComponent, windowComponent, renderingContextComponent);
+                RenderHeightMapInternal(transformComponent, renderableComponent, world.GetComponent<HeightMapComponent>(entityId), shaderStoreComponent, windowComponent, renderingContextComponent);
                 continue;
             }
             
@@ -290,14 +464,40 @@ void RenderingSystem::FinalRenderingPass(const std::vector<ecs::EntityId>& appli
             const auto& currentMesh        = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex]);
 
             // Frustum culling
-            if (!math::IsMeshInsideFrustum
-            (
-                transformComponent.mPosition,
-                transformComponent.mScale,
-                (currentMesh.HasSkeleton() ? currentMesh.GetDimensions() * 2.0f : currentMesh.GetDimensions()),
-                cameraComponent.mFrustum
-            ))
+            if (!cullingResults[i])
+            {
+                GetRenderPassStats(renderStatsComponent, RenderPass::FINAL).mCulledEntityCount++;
+                continue;
+            }
+            
+            // Occlusion culling
+            if (!occlusionResults[i])
+            {
+                GetRenderPassStats(renderStatsComponent, RenderPass::FINAL).mOccludedEntityCount++;
+                continue;
+            }
+            
+            // Batch up models that can be drawn instanced, to be drawn together after the rest of the models
+            if (CanBeRenderedInstanced(renderableComponent, currentMesh))
             {
+                InstancedModelData instancedModelData;
+                instancedModelData.mWorldMatrix       = transformComponent.mWorldMatrix;
+                instancedModelData.mNormalMatrix      = transformComponent.mRotationMatrix;
+                instancedModelData.mMaterialAmbient   = renderableComponent.mMaterial.mAmbient;
+                instancedModelData.mMaterialDiffuse   = renderableComponent.mMaterial.mDiffuse;
+                instancedModelData.mMaterialSpecular  = renderableComponent.mMaterial.mSpecular;
+                instancedModelData.mMaterialShininess = renderableComponent.mMaterial.mShininess;
+                
+                const auto batchKey = InstancedModelBatchKey
+                (
+                    renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex],
+                    renderableComponent.mTextureResourceId,
+                    SHADER_NAME_TO_INSTANCED_SHADER_NAME.at(renderableComponent.mShaderNameId),
+                    renderableComponent.mIsAffectedByLight
+                );
+                
+                instancedModelBatches[batchKey].push_back(instancedModelData);
+                GetRenderPassStats(renderStatsComponent, RenderPass::FINAL).mVisibleEntityCount++;
                 continue;
             }
 
@@ -305,8 +505,6 @@ void RenderingSystem::FinalRenderingPass(const std::vector<ecs::EntityId>& appli
             (
                 transformComponent,
                 renderableComponent,
-                cameraComponent,
-                lightStoreComponent,
                 shaderStoreComponent,
                 windowComponent,
                 renderingContextComponent
@@ -314,10 +512,19 @@ void RenderingSystem::FinalRenderingPass(const std::vector<ecs::EntityId>& appli
         }
         else
         {
+            // Frustum culling
+            if (renderableComponent.mRenderableType == RenderableType::TEXT_3D_MODEL && !cullingResults[i])
+            {
+                GetRenderPassStats(renderStatsComponent, RenderPass::TEXT).mCulledEntityCount++;
+                continue;
+            }
+            
             guiEntityGroups[renderableComponent.mRenderableType].push_back(entityId);
         }
     }
     
+    RenderInstancedModelBatches(instancedModelBatches, shaderStoreComponent, renderingContextComponent);
+    
     // Render 3d texts
     if (guiEntityGroups.count(RenderableType::TEXT_3D_MODEL))
     {
@@ -326,48 +533,30 @@ void RenderingSystem::FinalRenderingPass(const std::vector<ecs::EntityId>& appli
         {
             const auto& renderableComponent = world.GetComponent<RenderableComponent>(entityId);
             const auto& transformComponent = world.GetComponent<TransformComponent>(entityId);
-            const auto& textStringComponent = world.GetComponent<TextStringComponent>(entityId);
-            
-            if (renderableComponent.mRenderableType == RenderableType::TEXT_3D_MODEL)
-            {
-                // Frustum culling
-                if (!math::IsMeshInsideFrustum
-                (
-                    transformComponent.mPosition + glm::vec3(textStringComponent.mText.size() * textStringComponent.mCharacterSize/2, 0.0f, 0.0f),
-                    transformComponent.mScale,
-                    glm::vec3(textStringComponent.mText.size(), textStringComponent.mCharacterSize, textStringComponent.mCharacterSize),
-                    cameraComponent.mFrustum
-                ))
-                {
-                    continue;
-                }
-            }
+            auto& textStringComponent = world.GetComponent<TextStringComponent>(entityId);
             
-            RenderStringInternal
+            RenderString
             (
                 transformComponent,
                 renderableComponent,
-                cameraComponent,
-                lightStoreComponent,
                 shaderStoreComponent,
                 textStringComponent,
                 windowComponent,
                 renderingContextComponent
             );
         }
+        
+        FlushTextBatch(shaderStoreComponent, renderingContextComponent);
     }
     
     // Render particles
-    for (const auto& entityId: particleEntities)
+    if (renderingContextComponent.mParticlesEnabled)
     {
-        if (renderingContextComponent.mParticlesEnabled)
-        {
-            RenderParticleSystem(world.GetComponent<ParticleEmitterComponent>(entityId), world.GetComponent<TransformComponent>(entityId), world.GetComponent<RenderableComponent>(entityId), shaderStoreComponent, cameraComponent);
-        }
+        RenderParticleEmitters(particleEntities, shaderStoreComponent, renderingContextComponent);
     }
     
     // Execute disabled detph test GUI pass
-    GL_CHECK(glDisable(GL_DEPTH_TEST));
+    renderingContextComponent.mGLStateCache.SetDepthTestEnabled(false);
     
     // Execute normal gui sprite pass
     if (guiEntityGroups.count(RenderableType::GUI_SPRITE))
@@ -381,40 +570,39 @@ void RenderingSystem::FinalRenderingPass(const std::vector<ecs::EntityId>& appli
             // If normal gui text entity render text
             if (world.HasComponent<TextStringComponent>(entityId))
             {
-                const auto& textStringComponent = world.GetComponent<TextStringComponent>(entityId);
-                RenderStringInternal
+                auto& textStringComponent = world.GetComponent<TextStringComponent>(entityId);
+                RenderString
                 (
                     transformComponent,
                     renderableComponent,
-                    cameraComponent,
-                    lightStoreComponent,
                     shaderStoreComponent,
                     textStringComponent,
                     windowComponent,
                     renderingContextComponent
                 );
             }
-            // Else render normal gui entity
+            // Else render normal gui entity, on top of any strings batched before it
             else
             {
+                FlushTextBatch(shaderStoreComponent, renderingContextComponent);
                 RenderEntityInternal
                 (
                     transformComponent,
                     renderableComponent,
-                    cameraComponent,
-                    lightStoreComponent,
                     shaderStoreComponent,
                     windowComponent,
                     renderingContextComponent
                 );
             }
         }
+        
+        FlushTextBatch(shaderStoreComponent, renderingContextComponent);
     }
     
     // Execute gui 3d model pass
-    GL_CHECK(glEnable(GL_DEPTH_TEST));
+    renderingContextComponent.mGLStateCache.SetDepthTestEnabled(true);
     // Clear depth buffer
-    GL_CHECK(glClear(GL_DEPTH_BUFFER_BIT));
+    renderDevice.VClear(GL_DEPTH_BUFFER_BIT);
     
     if (guiEntityGroups.count(RenderableType::GUI_3D_MODEL))
     {
@@ -428,8 +616,6 @@ void RenderingSystem::FinalRenderingPass(const std::vector<ecs::EntityId>& appli
             (
                 transformComponent,
                 renderableComponent,
-                cameraComponent,
-                lightStoreComponent,
                 shaderStoreComponent,
                 windowComponent,
                 renderingContextComponent
@@ -440,78 +626,131 @@ void RenderingSystem::FinalRenderingPass(const std::vector<ecs::EntityId>& appli
 
 ///-----------------------------------------------------------------------------------------------
 
-void RenderingSystem::RenderParticleSystem
+void RenderingSystem::UpdateFrameUniformBuffer
 (
-     const ParticleEmitterComponent& particleEmitterComponent,
-     const TransformComponent&,
-     const RenderableComponent&,
-     const ShaderStoreSingletonComponent& shaderStoreComponent,
-     const CameraSingletonComponent& cameraComponent
+    const CameraSingletonComponent& cameraComponent,
+    const LightStoreSingletonComponent& lightStoreComponent,
+    const RenderingContextSingletonComponent& renderingContextComponent
 ) const
 {
-    const resources::ShaderResource* currentShader = &shaderStoreComponent.mShaders.at(particleEmitterComponent.mShaderNameId);
-    GL_CHECK(glUseProgram(currentShader->GetProgramId()));
-
-    currentShader->SetMatrix4fv(VIEW_MARIX_UNIFORM_NAME, cameraComponent.mViewMatrix);
-    currentShader->SetMatrix4fv(PROJECTION_MARIX_UNIFORM_NAME, cameraComponent.mProjectionMatrix);
-    currentShader->SetFloatVec3(EYE_POSITION_UNIFORM_NAME, cameraComponent.mPosition);
-    
-    const resources::TextureResource* currentTexture = &resources::ResourceLoadingService::GetInstance().GetResource<resources::TextureResource>(particleEmitterComponent.mParticleTextureResourceId);
-    GL_CHECK(glBindTexture(GL_TEXTURE_2D, currentTexture->GetGLTextureId()));
-    
-    GL_CHECK(glBindVertexArray(particleEmitterComponent.mParticleVertexArrayObject));
-    
-    GL_CHECK(glEnableVertexAttribArray(0));
-    GL_CHECK(glEnableVertexAttribArray(1));
-    GL_CHECK(glEnableVertexAttribArray(2));
-    GL_CHECK(glEnableVertexAttribArray(3));
-    GL_CHECK(glEnableVertexAttribArray(4));
-
-    // update the position buffer
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterComponent.mParticlePositionsBuffer));
-    GL_CHECK(glBufferSubData(GL_ARRAY_BUFFER, 0, particleEmitterComponent.mParticlePositions.size() * sizeof(glm::vec3), particleEmitterComponent.mParticlePositions.data()));
+    assert(lightStoreComponent.mLightPositions.size() <= FrameUniformData::MAX_LIGHT_COUNT && "Light count exceeds the light arrays of the frame uniform block");
     
-    // update the lifetime buffer
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterComponent.mParticleLifetimesBuffer));
-    GL_CHECK(glBufferSubData(GL_ARRAY_BUFFER, 0, particleEmitterComponent.mParticlePositions.size() * sizeof(float), particleEmitterComponent.mParticleLifetimes.data()));
+    FrameUniformData frameUniformData = {};
+    frameUniformData.mViewMatrix         = cameraComponent.mViewMatrix;
+    frameUniformData.mProjectionMatrix   = cameraComponent.mProjectionMatrix;
+    frameUniformData.mEyePosition        = cameraComponent.mPosition;
+    frameUniformData.mDtAccumulator      = renderingContextComponent.mDtAccumulator;
+    frameUniformData.mShadowsEnabled     = renderingContextComponent.mShadowsEnabled ? 1 : 0;
+    frameUniformData.mShadowCascadeCount = static_cast<std::int32_t>(renderingContextComponent.mShadowCascades.size());
     
-    // update the scale buffer
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterComponent.mParticleSizesBuffer));
-    GL_CHECK(glBufferSubData(GL_ARRAY_BUFFER, 0, particleEmitterComponent.mParticleSizes.size() * sizeof(float), particleEmitterComponent.mParticleSizes.data()));
+    for (auto i = 0U; i < renderingContextComponent.mShadowCascades.size(); ++i)
+    {
+        frameUniformData.mLightSpaceMatrices[i]       = renderingContextComponent.mShadowCascades[i].mLightSpaceMatrix;
+        frameUniformData.mShadowCascadeSplitDepths[i] = renderingContextComponent.mShadowCascades[i].mSplitDepth;
+    }
     
-    // vertex buffer
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER , particleEmitterComponent.mParticleVertexBuffer));
-    GL_CHECK(glVertexAttribPointer(0, 3 , GL_FLOAT, GL_FALSE , 0 , nullptr));
+    for (auto i = 0U; i < lightStoreComponent.mLightPositions.size() && i < FrameUniformData::MAX_LIGHT_COUNT; ++i)
+    {
+        frameUniformData.mLightPositions[i] = glm::vec4(lightStoreComponent.mLightPositions[i], 0.0f);
+        frameUniformData.mLightPowers[i].x  = lightStoreComponent.mLightPowers[i];
+    }
     
-    // uv buffer
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER , particleEmitterComponent.mParticleUVBuffer));
-    GL_CHECK(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE , 0 , nullptr));
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    renderDevice.VBindBuffer(GL_UNIFORM_BUFFER, renderingContextComponent.mFrameUniformBufferObject);
+    renderDevice.VBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameUniformData), &frameUniformData);
+    GetRenderPassStats(ecs::World::GetInstance().GetSingletonComponent<RenderStatsSingletonComponent>(), RenderPass::FINAL).mUploadedBufferBytes += sizeof(FrameUniformData);
+    renderDevice.VBindBufferBase(GL_UNIFORM_BUFFER, resources::ShaderResource::FRAME_DATA_UNIFORM_BLOCK_BINDING_POINT, renderingContextComponent.mFrameUniformBufferObject);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RenderingSystem::RenderParticleEmitters
+(
+     const std::vector<ecs::EntityId>& particleEntities,
+     const ShaderStoreSingletonComponent& shaderStoreComponent,
+     RenderingContextSingletonComponent& renderingContextComponent
+) const
+{
+    if (particleEntities.empty())
+    {
+        return;
+    }
     
-    // position buffer
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterComponent.mParticlePositionsBuffer));
-    GL_CHECK(glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE , 0 , nullptr));
-    GL_CHECK(glVertexAttribDivisor(2, 1));
+    const auto& world = ecs::World::GetInstance();
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    auto& renderStatsComponent = world.GetSingletonComponent<RenderStatsSingletonComponent>();
+    const RenderPassStatsScope particlesPassStatsScope(renderStatsComponent, renderingContextComponent.mGLStateCache, RenderPass::PARTICLES);
+    auto& particlesPassStats = GetRenderPassStats(renderStatsComponent, RenderPass::PARTICLES);
+    particlesPassStats.mVisibleEntityCount += particleEntities.size();
     
-    // lifetime buffer
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterComponent.mParticleLifetimesBuffer));
-    GL_CHECK(glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE , 0 , nullptr));
-    GL_CHECK(glVertexAttribDivisor(3, 1));
+    // Group emitters by type, so that each type's particles end up contiguous in the instance buffer
+    auto& emitterDrawQueue = renderingContextComponent.mParticleEmitterDrawQueue;
+    emitterDrawQueue.clear();
+    for (const auto& entityId: particleEntities)
+    {
+        emitterDrawQueue.push_back(&world.GetComponent<ParticleEmitterComponent>(entityId));
+    }
+    std::stable_sort(emitterDrawQueue.begin(), emitterDrawQueue.end(), [](const ParticleEmitterComponent* lhs, const ParticleEmitterComponent* rhs)
+    {
+        return lhs->mEmitterType < rhs->mEmitterType;
+    });
     
-    // size buffer
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, particleEmitterComponent.mParticleSizesBuffer));
-    GL_CHECK(glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE , 0 , nullptr));
-    GL_CHECK(glVertexAttribDivisor(4, 1));
+    auto& particleInstances = renderingContextComponent.mParticleInstances;
+    particleInstances.clear();
+    for (const auto* emitterComponent: emitterDrawQueue)
+    {
+        for (auto i = 0U; i < emitterComponent->mParticlePositions.size(); ++i)
+        {
+            particleInstances.push_back({ emitterComponent->mParticlePositions[i], emitterComponent->mParticleLifetimes[i], emitterComponent->mParticleSizes[i] });
+        }
+    }
     
-    // draw triangles
-    GL_CHECK(glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, particleEmitterComponent.mParticlePositions.size()));
-
-    GL_CHECK(glDisableVertexAttribArray(0));
-    GL_CHECK(glDisableVertexAttribArray(1));
-    GL_CHECK(glDisableVertexAttribArray(2));
-    GL_CHECK(glDisableVertexAttribArray(3));
-    GL_CHECK(glDisableVertexAttribArray(4));
+    if (particleInstances.empty())
+    {
+        return;
+    }
     
-    GL_CHECK(glBindVertexArray(0));
+    // Stream all particles with a single upload. Respecifying the buffer's storage orphans the
+    // previous frame's contents, so the upload does not wait on draws still reading from them.
+    renderingContextComponent.mGLStateCache.BindVertexArray(renderingContextComponent.mParticleVertexArrayObject);
+    renderDevice.VBindBuffer(GL_ARRAY_BUFFER, renderingContextComponent.mParticleInstanceBufferObject);
+    renderDevice.VBufferData(GL_ARRAY_BUFFER, particleInstances.size() * sizeof(ParticleInstanceData), particleInstances.data(), GL_STREAM_DRAW);
+    particlesPassStats.mUploadedBufferBytes += particleInstances.size() * sizeof(ParticleInstanceData);
+    
+    // Draw each type's particles with a single call, sourcing its shader and texture from the first emitter of the type
+    auto emitterIndex = 0U;
+    auto firstInstance = 0U;
+    while (emitterIndex < emitterDrawQueue.size())
+    {
+        const auto& firstEmitterComponent = *emitterDrawQueue[emitterIndex];
+        auto instanceCount = 0U;
+        for (; emitterIndex < emitterDrawQueue.size() && emitterDrawQueue[emitterIndex]->mEmitterType == firstEmitterComponent.mEmitterType; ++emitterIndex)
+        {
+            instanceCount += emitterDrawQueue[emitterIndex]->mParticlePositions.size();
+        }
+        
+        if (instanceCount == 0)
+        {
+            continue;
+        }
+        
+        const resources::ShaderResource* currentShader = &shaderStoreComponent.mShaders.at(firstEmitterComponent.mShaderNameId);
+        renderingContextComponent.mGLStateCache.UseProgram(currentShader->GetProgramId());
+        
+        const resources::TextureResource* currentTexture = &resources::ResourceLoadingService::GetInstance().GetResource<resources::TextureResource>(firstEmitterComponent.mParticleTextureResourceId);
+        renderingContextComponent.mGLStateCache.BindTexture(0, currentTexture->GetGLTextureId());
+        
+        // Point the per instance attributes at the type's sub-range of the instance buffer
+        const auto byteOffset = firstInstance * sizeof(ParticleInstanceData);
+        renderDevice.VSetVertexAttributePointer(2, 3, sizeof(ParticleInstanceData), byteOffset + offsetof(ParticleInstanceData, mPosition));
+        renderDevice.VSetVertexAttributePointer(3, 1, sizeof(ParticleInstanceData), byteOffset + offsetof(ParticleInstanceData, mLifetime));
+        renderDevice.VSetVertexAttributePointer(4, 1, sizeof(ParticleInstanceData), byteOffset + offsetof(ParticleInstanceData, mSize));
+        
+        renderDevice.VDrawArraysInstanced(GL_TRIANGLE_STRIP, PARTICLE_TYPE_TO_QUAD_FIRST_VERTEX.at(firstEmitterComponent.mEmitterType), 4, instanceCount);
+        RecordDrawCall(particlesPassStats, 2 * instanceCount);
+        
+        firstInstance += instanceCount;
+    }
 }
                      
 ///-----------------------------------------------------------------------------------------------
@@ -521,134 +760,171 @@ void RenderingSystem::RenderHeightMapInternal
     const TransformComponent& transformComponent,
     const RenderableComponent& renderableComponent,
     const HeightMapComponent& heightMapComponent,
-    const CameraSingletonComponent& cameraComponent,
-    const LightStoreSingletonComponent& lightStoreComponent,
     const ShaderStoreSingletonComponent& shaderStoreComponent,
     const WindowSingletonComponent& windowComponent,
     RenderingContextSingletonComponent& renderingContextComponent
 ) const
 {
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    
     // Update Shader
     const resources::ShaderResource* currentShader = &shaderStoreComponent.mShaders.at(renderableComponent.mShaderNameId);
-    GL_CHECK(glUseProgram(currentShader->GetProgramId()));
+    renderingContextComponent.mGLStateCache.UseProgram(currentShader->GetProgramId());
 
     // Calculate world matrix for entity
-    glm::mat4 world(1.0f);
-        
-    // Correct display of hud and billboard entities
-    glm::vec3 position = transformComponent.mPosition;
-    glm::vec3 scale    = transformComponent.mScale;
-    glm::vec3 rotation = transformComponent.mRotation;
-
-    if (renderableComponent.mRenderableType == RenderableType::GUI_SPRITE)
-    {
-        scale.x /= windowComponent.mAspectRatio;
-    }
-    
-    glm::mat4 rotMatrix = glm::mat4_cast(math::EulerAnglesToQuat(rotation));
-    
-    world = glm::translate(world, position);
-    world *= rotMatrix;
-    world = glm::scale(world, scale);
-       
+    const auto world = GetWorldMatrix(transformComponent, renderableComponent, windowComponent);
 
     // Bind all heightmap textures
     int textureIndex = 0;
     for (auto textureResourceId: heightMapComponent.mHeightMapTextureResourceIds)
     {
         auto& currentTexture = resources::ResourceLoadingService::GetInstance().GetResource<resources::TextureResource>(textureResourceId);
-        GL_CHECK(glActiveTexture(GL_TEXTURE0 + textureIndex++));
-        GL_CHECK(glBindTexture(GL_TEXTURE_2D, currentTexture.GetGLTextureId()));
-        
+        renderingContextComponent.mGLStateCache.BindTexture(textureIndex++, currentTexture.GetGLTextureId());
     }
     
-    currentShader->SetBool(SHADOWS_ENABLED_UNIFORM_NAME, renderingContextComponent.mShadowsEnabled);
-    currentShader->SetInt(SHADOW_MAP_TEXTURE_UNIFORM_NAME, textureIndex);
-    GL_CHECK(glActiveTexture(GL_TEXTURE0 + textureIndex));
-    GL_CHECK(glBindTexture(GL_TEXTURE_2D, renderingContextComponent.mShadowMapTexture));
-    
-    // Set mvp uniforms
-    currentShader->SetMatrix4fv(WORLD_MARIX_UNIFORM_NAME, world);
-    currentShader->SetMatrix4fv(VIEW_MARIX_UNIFORM_NAME, cameraComponent.mViewMatrix);
-    currentShader->SetMatrix4fv(PROJECTION_MARIX_UNIFORM_NAME, cameraComponent.mProjectionMatrix);
-    currentShader->SetMatrix4fv(NORMAL_MATRIX_UNIFORM_NAME, rotMatrix);
-    currentShader->SetMatrix4fv(LIGHT_SPACE_MATRIX_UNIFORM_NAME, lightStoreComponent.mMainShadowCastingLightMatrix);
-    currentShader->SetFloatVec4(MATERIAL_AMBIENT_UNIFORM_NAME, renderableComponent.mMaterial.mAmbient);
-    currentShader->SetFloatVec4(MATERIAL_DIFFUSE_UNIFORM_NAME, renderableComponent.mMaterial.mDiffuse);
-    currentShader->SetFloatVec4(MATERIAL_SPECULAR_UNIFORM_NAME, renderableComponent.mMaterial.mSpecular);
-    currentShader->SetFloat(MATERIAL_SHININESS_UNIFORM_NAME, renderableComponent.mMaterial.mShininess);
-    currentShader->SetFloat(DT_ACCUM_UNIFORM_NAME, renderingContextComponent.mDtAccumulator);
-    currentShader->SetFloatVec3Array(LIGHT_POSITIONS_UNIFORM_NAME, lightStoreComponent.mLightPositions);
-    currentShader->SetFloatArray(LIGHT_POWERS_UNIFORM_NAME, lightStoreComponent.mLightPowers);
-    currentShader->SetBool(IS_AFFECTED_BY_LIGHT_UNIFORM_NAME, renderableComponent.mIsAffectedByLight);
-    currentShader->SetFloatVec3(EYE_POSITION_UNIFORM_NAME, cameraComponent.mPosition);
-    
-    // Set other matrix uniforms
-    for (const auto& matrixUniformEntry: renderableComponent.mShaderUniforms.mShaderMatrixUniforms)
+    // Bind all shadow cascade depth maps
+    for (auto i = 0U; i < renderingContextComponent.mShadowCascades.size(); ++i)
     {
-        currentShader->SetMatrix4fv(matrixUniformEntry.first, matrixUniformEntry.second);
+        currentShader->SetInt(renderDevice, SHADOW_MAP_TEXTURE_UNIFORM_SLOTS[i], textureIndex);
+        renderingContextComponent.mGLStateCache.BindTexture(textureIndex++, renderingContextComponent.mShadowCascades[i].mDepthTexture);
     }
     
-    // Set other matrix array uniforms
-    for (const auto& mat4arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderMatrixArrayUniforms)
-    {
-        currentShader->SetMatrix4Array(mat4arrayUniformEntry.first, mat4arrayUniformEntry.second);
-    }
-
-    // Set other float vec4 array uniforms
-    for (const auto& vec4arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderFloatVec4ArrayUniforms)
+    // Set mvp uniforms
+    currentShader->SetMatrix4fv(renderDevice, WORLD_MATRIX_UNIFORM_SLOT, world);
+    currentShader->SetMatrix4fv(renderDevice, NORMAL_MATRIX_UNIFORM_SLOT, transformComponent.mRotationMatrix);
+    currentShader->SetFloatVec4(renderDevice, MATERIAL_AMBIENT_UNIFORM_SLOT, renderableComponent.mMaterial.mAmbient);
+    currentShader->SetFloatVec4(renderDevice, MATERIAL_DIFFUSE_UNIFORM_SLOT, renderableComponent.mMaterial.mDiffuse);
+    currentShader->SetFloatVec4(renderDevice, MATERIAL_SPECULAR_UNIFORM_SLOT, renderableComponent.mMaterial.mSpecular);
+    currentShader->SetFloat(renderDevice, MATERIAL_SHININESS_UNIFORM_SLOT, renderableComponent.mMaterial.mShininess);
+    currentShader->SetBool(renderDevice, IS_AFFECTED_BY_LIGHT_UNIFORM_SLOT, renderableComponent.mIsAffectedByLight);
+    
+    // Set custom uniforms
+    currentShader->SetUniforms(renderDevice, renderableComponent.mShaderUniforms);
+    
+    renderingContextComponent.mGLStateCache.BindVertexArray(heightMapComponent.mVertexArrayObject);
+    
+    const auto& cameraComponent = ecs::World::GetInstance().GetSingletonComponent<CameraSingletonComponent>();
+    auto& renderStatsComponent = ecs::World::GetInstance().GetSingletonComponent<RenderStatsSingletonComponent>();
+    auto& activePassStats = GetRenderPassStats(renderStatsComponent, renderStatsComponent.mActivePass);
+    activePassStats.mVisibleEntityCount++;
+    
+    // Cull the height map's chunks against the camera frustum
+    const auto& chunks = heightMapComponent.mChunks;
+    const auto maxScale = math::Max(transformComponent.mScale.x, math::Max(transformComponent.mScale.y, transformComponent.mScale.z));
+    auto& chunkCullingSpheres = renderingContextComponent.mHeightMapChunkCullingSpheres;
+    auto& chunkCullingResults = renderingContextComponent.mHeightMapChunkCullingResults;
+    ClearCullingSpheres(chunkCullingSpheres);
+    for (const auto& chunk: chunks)
     {
-        currentShader->SetFloatVec4Array(vec4arrayUniformEntry.first, vec4arrayUniformEntry.second);
+        AddCullingSphere(glm::vec3(world * glm::vec4(chunk.mCenter, 1.0f)), chunk.mRadius * maxScale, chunkCullingSpheres);
     }
+    CullSpheresAgainstFrustum(chunkCullingSpheres, cameraComponent.mFrustum, chunkCullingResults);
     
-    // Set other float vec3 array uniforms
-    for (const auto& vec3arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderFloatVec3ArrayUniforms)
-    {
-        currentShader->SetFloatVec3Array(vec3arrayUniformEntry.first, vec3arrayUniformEntry.second);
-    }
+    // Pixels that a world space error of one unit covers at unit distance from the camera. Model space
+    // geometric errors are heights, hence scaled by the height map's height scale
+    const auto pixelsPerUnitError = windowComponent.mRenderableHeight/(2.0f * std::tan(cameraComponent.mFieldOfView * 0.5f));
+    const auto geometricErrorScale = transformComponent.mScale.y * pixelsPerUnitError;
     
-    // Set other float vec4 uniforms
-    for (const auto& floatVec4UniformEntry : renderableComponent.mShaderUniforms.mShaderFloatVec4Uniforms)
+    for (auto i = 0U; i < chunks.size(); ++i)
     {
-        currentShader->SetFloatVec4(floatVec4UniformEntry.first, floatVec4UniformEntry.second);
+        if (!chunkCullingResults[i])
+        {
+            continue;
+        }
+        
+        const auto chunkCenter = glm::vec3(chunkCullingSpheres.mCenterX[i], chunkCullingSpheres.mCenterY[i], chunkCullingSpheres.mCenterZ[i]);
+        const auto cameraDistance = math::Max(glm::distance(chunkCenter, cameraComponent.mPosition) - chunkCullingSpheres.mRadius[i], cameraComponent.mZNear);
+        
+        // Pick the coarsest level of detail that still looks like the full resolution chunk
+        const auto& chunkLods = chunks[i].mLods;
+        auto lodIndex = 0U;
+        while (lodIndex + 1 < chunkLods.size() && chunkLods[lodIndex + 1].mGeometricError * geometricErrorScale/cameraDistance <= MAX_HEIGHTMAP_SCREEN_SPACE_ERROR)
+        {
+            lodIndex++;
+        }
+        
+        const auto& chunkLod = chunkLods[lodIndex];
+        renderDevice.VDrawElements(GL_TRIANGLES, chunkLod.mIndexCount, GL_UNSIGNED_INT, chunkLod.mFirstIndex * sizeof(unsigned int));
+        RecordDrawCall(activePassStats, chunkLod.mIndexCount/3);
     }
-    
-    // Set other float vec3 uniforms
-    for (const auto& floatVec3UniformEntry : renderableComponent.mShaderUniforms.mShaderFloatVec3Uniforms)
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RenderingSystem::RenderString
+(
+    const TransformComponent& transformComponent,
+    const RenderableComponent& renderableComponent,
+    const ShaderStoreSingletonComponent& shaderStoreComponent,
+    TextStringComponent& textStringComponent,
+    const WindowSingletonComponent& windowComponent,
+    RenderingContextSingletonComponent& renderingContextComponent
+) const
+{
+    if (!renderableComponent.mIsVisible)
     {
-        currentShader->SetFloatVec3(floatVec3UniformEntry.first, floatVec3UniformEntry.second);
+        return;
     }
     
-    // Set other float uniforms
-    for (const auto& floatUniformEntry : renderableComponent.mShaderUniforms.mShaderFloatUniforms)
+    auto& renderStatsComponent = ecs::World::GetInstance().GetSingletonComponent<RenderStatsSingletonComponent>();
+    const RenderPassStatsScope textPassStatsScope(renderStatsComponent, renderingContextComponent.mGLStateCache, RenderPass::TEXT);
+    GetRenderPassStats(renderStatsComponent, RenderPass::TEXT).mVisibleEntityCount++;
+    
+    // Strings that can't be batched are drawn glyph by glyph, after everything batched before them
+    if (!CanBeRenderedBatched(renderableComponent))
     {
-        currentShader->SetFloat(floatUniformEntry.first, floatUniformEntry.second);
+        FlushTextBatch(shaderStoreComponent, renderingContextComponent);
+        RenderStringInternal(transformComponent, renderableComponent, shaderStoreComponent, textStringComponent, windowComponent, renderingContextComponent);
+        return;
     }
     
-    // Set other int uniforms
-    for (const auto& intUniformEntry : renderableComponent.mShaderUniforms.mShaderIntUniforms)
+    const auto& batchedShaderNameId = SHADER_NAME_TO_BATCHED_TEXT_SHADER_NAME.at(renderableComponent.mShaderNameId);
+    if (batchedShaderNameId != renderingContextComponent.mTextBatchShaderNameId || renderableComponent.mTextureResourceId != renderingContextComponent.mTextBatchTextureResourceId)
     {
-        currentShader->SetInt(intUniformEntry.first, intUniformEntry.second);
+        FlushTextBatch(shaderStoreComponent, renderingContextComponent);
+        renderingContextComponent.mTextBatchShaderNameId = batchedShaderNameId;
+        renderingContextComponent.mTextBatchTextureResourceId = renderableComponent.mTextureResourceId;
     }
     
-    // Set other bool uniforms
-    for (const auto& boolUniformEntry : renderableComponent.mShaderUniforms.mShaderBoolUniforms)
+    UpdateTextStringVertices(renderableComponent, GetWorldMatrix(transformComponent, renderableComponent, windowComponent), textStringComponent);
+    renderingContextComponent.mTextBatchVertices.insert(renderingContextComponent.mTextBatchVertices.end(), textStringComponent.mVertices.cbegin(), textStringComponent.mVertices.cend());
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RenderingSystem::FlushTextBatch
+(
+    const ShaderStoreSingletonComponent& shaderStoreComponent,
+    RenderingContextSingletonComponent& renderingContextComponent
+) const
+{
+    if (renderingContextComponent.mTextBatchVertices.empty())
     {
-        currentShader->SetBool(boolUniformEntry.first, boolUniformEntry.second);
+        return;
     }
     
-    GL_CHECK(glBindVertexArray(heightMapComponent.mVertexArrayObject));
-    GL_CHECK(glEnable(GL_PRIMITIVE_RESTART));
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    auto& renderStatsComponent = ecs::World::GetInstance().GetSingletonComponent<RenderStatsSingletonComponent>();
+    const RenderPassStatsScope textPassStatsScope(renderStatsComponent, renderingContextComponent.mGLStateCache, RenderPass::TEXT);
+    auto& textPassStats = GetRenderPassStats(renderStatsComponent, RenderPass::TEXT);
     
-    const auto heightMapCols = heightMapComponent.mHeightMapTextureDimensions.x;
-    const auto heightMapRows = heightMapComponent.mHeightMapTextureDimensions.y;
+    // Update Shader
+    const resources::ShaderResource* currentShader = &shaderStoreComponent.mShaders.at(renderingContextComponent.mTextBatchShaderNameId);
+    renderingContextComponent.mGLStateCache.UseProgram(currentShader->GetProgramId());
     
-    GL_CHECK(glPrimitiveRestartIndex(heightMapCols * heightMapRows));
-    const auto numIndices = (heightMapRows - 1) * (heightMapCols * 2) + (heightMapRows - 1);
-    GL_CHECK(glDrawElements(GL_TRIANGLE_STRIP, numIndices, GL_UNSIGNED_INT, 0));
-    GL_CHECK(glDisable(GL_PRIMITIVE_RESTART));
-    GL_CHECK(glActiveTexture(GL_TEXTURE0));
-    GL_CHECK(glBindVertexArray(0));
+    // Update texture
+    const resources::TextureResource* currentTexture = &resources::ResourceLoadingService::GetInstance().GetResource<resources::TextureResource>(renderingContextComponent.mTextBatchTextureResourceId);
+    renderingContextComponent.mGLStateCache.BindTexture(0, currentTexture->GetGLTextureId());
+    
+    // Upload and draw all glyph quads of the batch at once
+    renderingContextComponent.mGLStateCache.BindVertexArray(renderingContextComponent.mTextVertexArrayObject);
+    renderDevice.VBindBuffer(GL_ARRAY_BUFFER, renderingContextComponent.mTextVertexBufferObject);
+    renderDevice.VBufferData(GL_ARRAY_BUFFER, renderingContextComponent.mTextBatchVertices.size() * sizeof(TextVertexData), renderingContextComponent.mTextBatchVertices.data(), GL_STREAM_DRAW);
+    renderDevice.VDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(renderingContextComponent.mTextBatchVertices.size()));
+    textPassStats.mUploadedBufferBytes += renderingContextComponent.mTextBatchVertices.size() * sizeof(TextVertexData);
+    RecordDrawCall(textPassStats, renderingContextComponent.mTextBatchVertices.size() / 3);
+    
+    renderingContextComponent.mTextBatchVertices.clear();
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -657,125 +933,50 @@ void RenderingSystem::RenderStringInternal
 (
     const TransformComponent& transformComponent,
     const RenderableComponent& renderableComponent,
-    const CameraSingletonComponent& cameraComponent,
-    const LightStoreSingletonComponent& lightStoreComponent,
     const ShaderStoreSingletonComponent& shaderStoreComponent,
     const TextStringComponent& textStringComponent,
     const WindowSingletonComponent& windowComponent,
-    RenderingContextSingletonComponent&
+    RenderingContextSingletonComponent& renderingContextComponent
 ) const
 {
     if (!renderableComponent.mIsVisible)
     {
         return;
     }
+    
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    auto& textPassStats = GetRenderPassStats(ecs::World::GetInstance().GetSingletonComponent<RenderStatsSingletonComponent>(), RenderPass::TEXT);
 
     // Update Shader
     const resources::ShaderResource* currentShader = &shaderStoreComponent.mShaders.at(renderableComponent.mShaderNameId);
-    GL_CHECK(glUseProgram(currentShader->GetProgramId()));
+    renderingContextComponent.mGLStateCache.UseProgram(currentShader->GetProgramId());
 
     auto currentTexture = &resources::ResourceLoadingService::GetInstance().GetResource<resources::TextureResource>(renderableComponent.mTextureResourceId);
-    GL_CHECK(glBindTexture(GL_TEXTURE_2D, currentTexture->GetGLTextureId()));
+    renderingContextComponent.mGLStateCache.BindTexture(0, currentTexture->GetGLTextureId());
     
-    auto positionCounter = transformComponent.mPosition;
+    // Each glyph is offset along the x axis from the previous one, in world space
+    auto world = GetWorldMatrix(transformComponent, renderableComponent, windowComponent);
     for (const auto& meshResourceId: renderableComponent.mMeshResourceIds)
     {
         auto currentMesh = &resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(meshResourceId);
-        GL_CHECK(glBindVertexArray(currentMesh->GetVertexArrayObject()));
-        
-        // Calculate world matrix for entity
-        glm::mat4 world(1.0f);
-           
-        // Correct display of hud and billboard entities
-        glm::vec3 position = positionCounter;
-        positionCounter.x += textStringComponent.mPaddingProportionalToSize * textStringComponent.mCharacterSize;
-        
-        glm::vec3 scale    = transformComponent.mScale;
-        glm::vec3 rotation = transformComponent.mRotation;
-        
-        if (renderableComponent.mRenderableType == RenderableType::GUI_SPRITE)
-        {
-            scale.x /= windowComponent.mAspectRatio;
-        }
-        
-        glm::mat4 rotMatrix = glm::mat4_cast(math::EulerAnglesToQuat(rotation));
-           
-        world = glm::translate(world, position);
-        world *= rotMatrix;
-        world = glm::scale(world, scale);
+        renderingContextComponent.mGLStateCache.BindVertexArray(currentMesh->GetVertexArrayObject());
         
         // Set mvp uniforms
-        currentShader->SetMatrix4fv(WORLD_MARIX_UNIFORM_NAME, world);
-        currentShader->SetMatrix4fv(VIEW_MARIX_UNIFORM_NAME, cameraComponent.mViewMatrix);
-        currentShader->SetMatrix4fv(PROJECTION_MARIX_UNIFORM_NAME, cameraComponent.mProjectionMatrix);
-        currentShader->SetMatrix4fv(NORMAL_MATRIX_UNIFORM_NAME, rotMatrix);
-        currentShader->SetFloatVec4(MATERIAL_AMBIENT_UNIFORM_NAME, renderableComponent.mMaterial.mAmbient);
-        currentShader->SetFloatVec4(MATERIAL_DIFFUSE_UNIFORM_NAME, renderableComponent.mMaterial.mDiffuse);
-        currentShader->SetFloatVec4(MATERIAL_SPECULAR_UNIFORM_NAME, renderableComponent.mMaterial.mSpecular);
-        currentShader->SetFloat(MATERIAL_SHININESS_UNIFORM_NAME, renderableComponent.mMaterial.mShininess);
-        currentShader->SetFloatVec3Array(LIGHT_POSITIONS_UNIFORM_NAME, lightStoreComponent.mLightPositions);
-        currentShader->SetFloatArray(LIGHT_POWERS_UNIFORM_NAME, lightStoreComponent.mLightPowers);
-        currentShader->SetBool(IS_AFFECTED_BY_LIGHT_UNIFORM_NAME, renderableComponent.mIsAffectedByLight);
-        currentShader->SetFloatVec3(EYE_POSITION_UNIFORM_NAME, cameraComponent.mPosition);
-        
-        // Set other matrix uniforms
-        for (const auto& matrixUniformEntry: renderableComponent.mShaderUniforms.mShaderMatrixUniforms)
-        {
-            currentShader->SetMatrix4fv(matrixUniformEntry.first, matrixUniformEntry.second);
-        }
-
-        // Set other matrix array uniforms
-        for (const auto& mat4arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderMatrixArrayUniforms)
-        {
-            currentShader->SetMatrix4Array(mat4arrayUniformEntry.first, mat4arrayUniformEntry.second);
-        }
-        
-        // Set other float vec4 array uniforms
-        for (const auto& vec4arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderFloatVec4ArrayUniforms)
-        {
-            currentShader->SetFloatVec4Array(vec4arrayUniformEntry.first, vec4arrayUniformEntry.second);
-        }
+        currentShader->SetMatrix4fv(renderDevice, WORLD_MATRIX_UNIFORM_SLOT, world);
+        currentShader->SetMatrix4fv(renderDevice, NORMAL_MATRIX_UNIFORM_SLOT, transformComponent.mRotationMatrix);
+        world[3].x += textStringComponent.mPaddingProportionalToSize * textStringComponent.mCharacterSize;
+        currentShader->SetFloatVec4(renderDevice, MATERIAL_AMBIENT_UNIFORM_SLOT, renderableComponent.mMaterial.mAmbient);
+        currentShader->SetFloatVec4(renderDevice, MATERIAL_DIFFUSE_UNIFORM_SLOT, renderableComponent.mMaterial.mDiffuse);
+        currentShader->SetFloatVec4(renderDevice, MATERIAL_SPECULAR_UNIFORM_SLOT, renderableComponent.mMaterial.mSpecular);
+        currentShader->SetFloat(renderDevice, MATERIAL_SHININESS_UNIFORM_SLOT, renderableComponent.mMaterial.mShininess);
+        currentShader->SetBool(renderDevice, IS_AFFECTED_BY_LIGHT_UNIFORM_SLOT, renderableComponent.mIsAffectedByLight);
         
-        // Set other float vec3 array uniforms
-        for (const auto& vec3arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderFloatVec3ArrayUniforms)
-        {
-            currentShader->SetFloatVec3Array(vec3arrayUniformEntry.first, vec3arrayUniformEntry.second);
-        }
-        
-        // Set other float vec4 uniforms
-        for (const auto& floatVec4UniformEntry : renderableComponent.mShaderUniforms.mShaderFloatVec4Uniforms)
-        {
-            currentShader->SetFloatVec4(floatVec4UniformEntry.first, floatVec4UniformEntry.second);
-        }
-        
-        // Set other float vec3 uniforms
-        for (const auto& floatVec3UniformEntry : renderableComponent.mShaderUniforms.mShaderFloatVec3Uniforms)
-        {
-            currentShader->SetFloatVec3(floatVec3UniformEntry.first, floatVec3UniformEntry.second);
-        }
-        
-        // Set other float uniforms
-        for (const auto& floatUniformEntry : renderableComponent.mShaderUniforms.mShaderFloatUniforms)
-        {
-            currentShader->SetFloat(floatUniformEntry.first, floatUniformEntry.second);
-        }
-        
-        // Set other int uniforms
-        for (const auto& intUniformEntry : renderableComponent.mShaderUniforms.mShaderIntUniforms)
-        {
-            currentShader->SetInt(intUniformEntry.first, intUniformEntry.second);
-        }
-        
-        // Set other bool uniforms
-        for (const auto& boolUniformEntry : renderableComponent.mShaderUniforms.mShaderBoolUniforms)
-        {
-            currentShader->SetBool(boolUniformEntry.first, boolUniformEntry.second);
-        }
+        // Set custom uniforms
+        currentShader->SetUniforms(renderDevice, renderableComponent.mShaderUniforms);
         
         // Perform draw call
-        GL_CHECK(glDrawElements(GL_TRIANGLES, currentMesh->GetIndexCountPerMesh()[0], GL_UNSIGNED_SHORT, (void*)0));
-
-        GL_CHECK(glBindVertexArray(0));
+        renderDevice.VDrawElements(GL_TRIANGLES, currentMesh->GetIndexCountPerMesh()[0], GL_UNSIGNED_SHORT, 0);
+        RecordDrawCall(textPassStats, currentMesh->GetIndexCountPerMesh()[0] / 3);
     }
 }
 
@@ -785,130 +986,151 @@ void RenderingSystem::RenderEntityInternal
 (    
     const TransformComponent& transformComponent,
     const RenderableComponent& renderableComponent,    
-    const CameraSingletonComponent& cameraComponent,
-    const LightStoreSingletonComponent& lightStoreComponent,
     const ShaderStoreSingletonComponent& shaderStoreComponent,
     const WindowSingletonComponent& windowComponent,    
-    RenderingContextSingletonComponent&
+    RenderingContextSingletonComponent& renderingContextComponent
 ) const
 {
     if (!renderableComponent.mIsVisible)
     {
         return;
     }
+    
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    auto& renderStatsComponent = ecs::World::GetInstance().GetSingletonComponent<RenderStatsSingletonComponent>();
+    auto& activePassStats = GetRenderPassStats(renderStatsComponent, renderStatsComponent.mActivePass);
+    activePassStats.mVisibleEntityCount++;
 
     // Update Shader
     const resources::ShaderResource* currentShader = &shaderStoreComponent.mShaders.at(renderableComponent.mShaderNameId);
-    GL_CHECK(glUseProgram(currentShader->GetProgramId()));
+    renderingContextComponent.mGLStateCache.UseProgram(currentShader->GetProgramId());
     
     // Calculate world matrix for entity
-    glm::mat4 world(1.0f);
-        
-    // Correct display of hud and billboard entities    
-    glm::vec3 position = transformComponent.mPosition;
-    glm::vec3 scale    = transformComponent.mScale;
-    glm::vec3 rotation = transformComponent.mRotation;
-
-    if (renderableComponent.mRenderableType == RenderableType::GUI_SPRITE)
-    {        
-        scale.x /= windowComponent.mAspectRatio;        
-    }  
+    const auto world = GetWorldMatrix(transformComponent, renderableComponent, windowComponent);
     
-    glm::mat4 rotMatrix = glm::mat4_cast(math::EulerAnglesToQuat(rotation));
-    
-    world = glm::translate(world, position);
-    world *= rotMatrix;
-    world = glm::scale(world, scale);
-       
     // Update texture
     const resources::TextureResource* currentTexture = &resources::ResourceLoadingService::GetInstance().GetResource<resources::TextureResource>(renderableComponent.mTextureResourceId);
-    GL_CHECK(glBindTexture(GL_TEXTURE_2D, currentTexture->GetGLTextureId()));
+    renderingContextComponent.mGLStateCache.BindTexture(0, currentTexture->GetGLTextureId());
 
     // Set mvp uniforms    
-    currentShader->SetMatrix4fv(WORLD_MARIX_UNIFORM_NAME, world);
-    currentShader->SetMatrix4fv(VIEW_MARIX_UNIFORM_NAME, cameraComponent.mViewMatrix);
-    currentShader->SetMatrix4fv(PROJECTION_MARIX_UNIFORM_NAME, cameraComponent.mProjectionMatrix);    
-    currentShader->SetMatrix4fv(NORMAL_MATRIX_UNIFORM_NAME, rotMatrix);
-    currentShader->SetFloatVec4(MATERIAL_AMBIENT_UNIFORM_NAME, renderableComponent.mMaterial.mAmbient);
-    currentShader->SetFloatVec4(MATERIAL_DIFFUSE_UNIFORM_NAME, renderableComponent.mMaterial.mDiffuse);
-    currentShader->SetFloatVec4(MATERIAL_SPECULAR_UNIFORM_NAME, renderableComponent.mMaterial.mSpecular);
-    currentShader->SetFloat(MATERIAL_SHININESS_UNIFORM_NAME, renderableComponent.mMaterial.mShininess);
-    currentShader->SetFloatVec3Array(LIGHT_POSITIONS_UNIFORM_NAME, lightStoreComponent.mLightPositions);
-    currentShader->SetFloatArray(LIGHT_POWERS_UNIFORM_NAME, lightStoreComponent.mLightPowers);
-    currentShader->SetBool(IS_AFFECTED_BY_LIGHT_UNIFORM_NAME, renderableComponent.mIsAffectedByLight);
-    currentShader->SetFloatVec3(EYE_POSITION_UNIFORM_NAME, cameraComponent.mPosition);
+    currentShader->SetMatrix4fv(renderDevice, WORLD_MATRIX_UNIFORM_SLOT, world);    
+    currentShader->SetMatrix4fv(renderDevice, NORMAL_MATRIX_UNIFORM_SLOT, transformComponent.mRotationMatrix);
+    currentShader->SetFloatVec4(renderDevice, MATERIAL_AMBIENT_UNIFORM_SLOT, renderableComponent.mMaterial.mAmbient);
+    currentShader->SetFloatVec4(renderDevice, MATERIAL_DIFFUSE_UNIFORM_SLOT, renderableComponent.mMaterial.mDiffuse);
+    currentShader->SetFloatVec4(renderDevice, MATERIAL_SPECULAR_UNIFORM_SLOT, renderableComponent.mMaterial.mSpecular);
+    currentShader->SetFloat(renderDevice, MATERIAL_SHININESS_UNIFORM_SLOT, renderableComponent.mMaterial.mShininess);
+    currentShader->SetBool(renderDevice, IS_AFFECTED_BY_LIGHT_UNIFORM_SLOT, renderableComponent.mIsAffectedByLight);
     
-    // Set other matrix uniforms
-    for (const auto& matrixUniformEntry: renderableComponent.mShaderUniforms.mShaderMatrixUniforms)
-    {
-        currentShader->SetMatrix4fv(matrixUniformEntry.first, matrixUniformEntry.second);
-    }
+    // Set custom uniforms
+    currentShader->SetUniforms(renderDevice, renderableComponent.mShaderUniforms);
     
-    // Set other matrix array uniforms
-    for (const auto& mat4arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderMatrixArrayUniforms)
-    {
-        currentShader->SetMatrix4Array(mat4arrayUniformEntry.first, mat4arrayUniformEntry.second);
-    }
+    // Update current mesh
+    const resources::MeshResource* currentMesh = &resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex]);
+    renderingContextComponent.mGLStateCache.BindVertexArray(currentMesh->GetVertexArrayObject());
 
-    // Set other float vec4 array uniforms
-    for (const auto& vec4arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderFloatVec4ArrayUniforms)
-    {
-        currentShader->SetFloatVec4Array(vec4arrayUniformEntry.first, vec4arrayUniformEntry.second);
-    }
-    
-    // Set other float vec3 array uniforms
-    for (const auto& vec3arrayUniformEntry: renderableComponent.mShaderUniforms.mShaderFloatVec3ArrayUniforms)
-    {
-        currentShader->SetFloatVec3Array(vec3arrayUniformEntry.first, vec3arrayUniformEntry.second);
-    }
-    
-    // Set other float vec4 uniforms
-    for (const auto& floatVec4UniformEntry : renderableComponent.mShaderUniforms.mShaderFloatVec4Uniforms)
+    // Perform draw call
+    const auto& indexCountPerMesh = currentMesh->GetIndexCountPerMesh();
+    const auto& baseIndexPerMesh = currentMesh->GetBaseIndexPerMesh();
+    const auto& baseVertexPerMesh = currentMesh->GetBaseVertexPerMesh();
+    for (auto i = 0U; i < indexCountPerMesh.size(); ++i)
     {
-        currentShader->SetFloatVec4(floatVec4UniformEntry.first, floatVec4UniformEntry.second);
+        if (indexCountPerMesh[i] > 0)
+        {
+            renderDevice.VDrawElementsBaseVertex(GL_TRIANGLES, indexCountPerMesh.at(i), GL_UNSIGNED_SHORT, sizeof(unsigned short) * baseIndexPerMesh.at(i), baseVertexPerMesh.at(i));
+            RecordDrawCall(activePassStats, indexCountPerMesh[i] / 3);
+        }
     }
-    
-    // Set other float vec3 uniforms
-    for (const auto& floatVec3UniformEntry : renderableComponent.mShaderUniforms.mShaderFloatVec3Uniforms)
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RenderingSystem::RenderInstancedModelBatches
+(
+    const InstancedModelBatches& instancedModelBatches,
+    const ShaderStoreSingletonComponent& shaderStoreComponent,
+    RenderingContextSingletonComponent& renderingContextComponent
+) const
+{
+    if (instancedModelBatches.empty())
     {
-        currentShader->SetFloatVec3(floatVec3UniformEntry.first, floatVec3UniformEntry.second);
+        return;
     }
     
-    // Set other float uniforms
-    for (const auto& floatUniformEntry : renderableComponent.mShaderUniforms.mShaderFloatUniforms)
+    // Upload the instance data of all batches at once. Each batch then points
+    // the per instance attributes at its own range of the instance buffer
+    std::vector<InstancedModelData> instanceData;
+    for (const auto& instancedModelBatchEntry: instancedModelBatches)
     {
-        currentShader->SetFloat(floatUniformEntry.first, floatUniformEntry.second);
+        instanceData.insert(instanceData.end(), instancedModelBatchEntry.second.cbegin(), instancedModelBatchEntry.second.cend());
     }
     
-    // Set other int uniforms
-    for (const auto& intUniformEntry : renderableComponent.mShaderUniforms.mShaderIntUniforms)
-    {
-        currentShader->SetInt(intUniformEntry.first, intUniformEntry.second);
-    }
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    renderDevice.VBindBuffer(GL_ARRAY_BUFFER, renderingContextComponent.mInstanceBufferObject);
+    renderDevice.VBufferData(GL_ARRAY_BUFFER, instanceData.size() * sizeof(InstancedModelData), instanceData.data(), GL_STREAM_DRAW);
     
-    // Set other bool uniforms
-    for (const auto& boolUniformEntry : renderableComponent.mShaderUniforms.mShaderBoolUniforms)
-    {
-        currentShader->SetBool(boolUniformEntry.first, boolUniformEntry.second);
-    }
+    auto& renderStatsComponent = ecs::World::GetInstance().GetSingletonComponent<RenderStatsSingletonComponent>();
+    auto& activePassStats = GetRenderPassStats(renderStatsComponent, renderStatsComponent.mActivePass);
+    activePassStats.mUploadedBufferBytes += instanceData.size() * sizeof(InstancedModelData);
     
-    // Update current mesh
-    const resources::MeshResource* currentMesh = &resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex]);
-    GL_CHECK(glBindVertexArray(currentMesh->GetVertexArrayObject()));;
-
-    // Perform draw call
-    const auto& indexCountPerMesh = currentMesh->GetIndexCountPerMesh();
-    const auto& baseIndexPerMesh = currentMesh->GetBaseIndexPerMesh();
-    const auto& baseVertexPerMesh = currentMesh->GetBaseVertexPerMesh();
-    for (auto i = 0U; i < indexCountPerMesh.size(); ++i)
+    auto batchFirstInstanceIndex = 0U;
+    for (const auto& instancedModelBatchEntry: instancedModelBatches)
     {
-        if (indexCountPerMesh[i] > 0)
+        const auto& meshResourceId    = std::get<0>(instancedModelBatchEntry.first);
+        const auto& textureResourceId = std::get<1>(instancedModelBatchEntry.first);
+        const auto& shaderNameId      = std::get<2>(instancedModelBatchEntry.first);
+        const auto isAffectedByLight  = std::get<3>(instancedModelBatchEntry.first);
+        const auto instanceCount      = static_cast<GLsizei>(instancedModelBatchEntry.second.size());
+        
+        // Update Shader
+        const resources::ShaderResource* currentShader = &shaderStoreComponent.mShaders.at(shaderNameId);
+        renderingContextComponent.mGLStateCache.UseProgram(currentShader->GetProgramId());
+        
+        // Update texture
+        const resources::TextureResource* currentTexture = &resources::ResourceLoadingService::GetInstance().GetResource<resources::TextureResource>(textureResourceId);
+        renderingContextComponent.mGLStateCache.BindTexture(0, currentTexture->GetGLTextureId());
+        
+        // Set batch-constant uniforms. World, normal matrices and materials are per instance attributes,
+        // while camera and light data come from the frame uniform block
+        currentShader->SetBool(renderDevice, IS_AFFECTED_BY_LIGHT_UNIFORM_SLOT, isAffectedByLight);
+        
+        // Update current mesh
+        const resources::MeshResource* currentMesh = &resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(meshResourceId);
+        renderingContextComponent.mGLStateCache.BindVertexArray(currentMesh->GetVertexArrayObject());
+        renderDevice.VBindBuffer(GL_ARRAY_BUFFER, renderingContextComponent.mInstanceBufferObject);
+        
+        const auto batchByteOffset = batchFirstInstanceIndex * sizeof(InstancedModelData);
+        for (auto column = 0U; column < 4U; ++column)
+        {
+            EnableInstanceAttribute(renderDevice, INSTANCE_WORLD_MATRIX_ATTRIBUTE_LOCATION + column, 4, batchByteOffset + offsetof(InstancedModelData, mWorldMatrix) + column * sizeof(glm::vec4));
+            EnableInstanceAttribute(renderDevice, INSTANCE_NORMAL_MATRIX_ATTRIBUTE_LOCATION + column, 4, batchByteOffset + offsetof(InstancedModelData, mNormalMatrix) + column * sizeof(glm::vec4));
+        }
+        EnableInstanceAttribute(renderDevice, INSTANCE_MATERIAL_AMBIENT_ATTRIBUTE_LOCATION, 4, batchByteOffset + offsetof(InstancedModelData, mMaterialAmbient));
+        EnableInstanceAttribute(renderDevice, INSTANCE_MATERIAL_DIFFUSE_ATTRIBUTE_LOCATION, 4, batchByteOffset + offsetof(InstancedModelData, mMaterialDiffuse));
+        EnableInstanceAttribute(renderDevice, INSTANCE_MATERIAL_SPECULAR_ATTRIBUTE_LOCATION, 4, batchByteOffset + offsetof(InstancedModelData, mMaterialSpecular));
+        EnableInstanceAttribute(renderDevice, INSTANCE_MATERIAL_SHININESS_ATTRIBUTE_LOCATION, 1, batchByteOffset + offsetof(InstancedModelData, mMaterialShininess));
+        
+        // Perform draw call
+        const auto& indexCountPerMesh = currentMesh->GetIndexCountPerMesh();
+        const auto& baseIndexPerMesh = currentMesh->GetBaseIndexPerMesh();
+        const auto& baseVertexPerMesh = currentMesh->GetBaseVertexPerMesh();
+        for (auto i = 0U; i < indexCountPerMesh.size(); ++i)
+        {
+            if (indexCountPerMesh[i] > 0)
+            {
+                renderDevice.VDrawElementsInstancedBaseVertex(GL_TRIANGLES, indexCountPerMesh.at(i), GL_UNSIGNED_SHORT, sizeof(unsigned short) * baseIndexPerMesh.at(i), instanceCount, baseVertexPerMesh.at(i));
+                RecordDrawCall(activePassStats, indexCountPerMesh[i] / 3 * instanceCount);
+            }
+        }
+        
+        // The mesh's vertex array object is shared with the non instanced draws
+        for (auto attributeLocation = INSTANCE_WORLD_MATRIX_ATTRIBUTE_LOCATION; attributeLocation <= INSTANCE_MATERIAL_SHININESS_ATTRIBUTE_LOCATION; ++attributeLocation)
         {
-            GL_CHECK(glDrawElementsBaseVertex(GL_TRIANGLES, indexCountPerMesh.at(i), GL_UNSIGNED_SHORT, (void*)(sizeof(unsigned short) * baseIndexPerMesh.at(i)), baseVertexPerMesh.at(i)));
+            renderDevice.VSetVertexAttributeDivisor(attributeLocation, 0);
+            renderDevice.VSetVertexAttributeEnabled(attributeLocation, false);
         }
+        
+        batchFirstInstanceIndex += instanceCount;
     }
-    
-    GL_CHECK(glBindVertexArray(0));
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -927,34 +1149,128 @@ void RenderingSystem::InitializeLights() const
 
 ///-----------------------------------------------------------------------------------------------
 
-void RenderingSystem::InitializeShadowMapTexture() const
+void RenderingSystem::InitializeShadowMapTextures() const
 {
     auto& renderingContextComponent = ecs::World::GetInstance().GetSingletonComponent<RenderingContextSingletonComponent>();
-    GL_CHECK(glGenTextures(1, &renderingContextComponent.mShadowMapTexture));
-    GL_CHECK(glBindTexture(GL_TEXTURE_2D, renderingContextComponent.mShadowMapTexture));
-    GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT,
-                 SHADOW_TEXTURE_WIDTH, SHADOW_TEXTURE_HEIGHT, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL));
-    GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
-    GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
-    GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER));
-    GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER));
-    float borderColor[] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
-    GL_CHECK(glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor));
+    assert(!renderingContextComponent.mShadowCascades.empty() && renderingContextComponent.mShadowCascades.size() <= MAX_SHADOW_CASCADE_COUNT && "Invalid shadow cascade count");
+    
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    for (auto& shadowCascade: renderingContextComponent.mShadowCascades)
+    {
+        shadowCascade.mDepthTexture = renderDevice.VCreateTexture();
+        renderDevice.VBindTexture(shadowCascade.mDepthTexture);
+        renderDevice.VTextureImage2D(GL_DEPTH_COMPONENT, shadowCascade.mResolution, shadowCascade.mResolution, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+        renderDevice.VSetTextureParameter(GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        renderDevice.VSetTextureParameter(GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        renderDevice.VSetTextureParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+        renderDevice.VSetTextureParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+        float borderColor[] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+        renderDevice.VSetTextureParameterValues(GL_TEXTURE_BORDER_COLOR, borderColor);
+    }
 }
 
 ///-----------------------------------------------------------------------------------------------
 
-void RenderingSystem::InitializeFrameBuffers() const
+void RenderingSystem::InitializeShadowMapFrameBuffers() const
 {
     auto& renderingContextComponent = ecs::World::GetInstance().GetSingletonComponent<RenderingContextSingletonComponent>();
     
-    GL_CHECK(glGenFramebuffers(1, &renderingContextComponent.mDepthMapFrameBufferObject));
-    GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, renderingContextComponent.mDepthMapFrameBufferObject));
-    GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, renderingContextComponent.mShadowMapTexture, 0));
-    GL_CHECK(glDrawBuffer(GL_NONE));
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    for (auto& shadowCascade: renderingContextComponent.mShadowCascades)
+    {
+        shadowCascade.mFrameBufferObject = renderDevice.VCreateFramebuffer();
+        renderDevice.VBindFramebuffer(shadowCascade.mFrameBufferObject);
+        renderDevice.VAttachFramebufferDepthTexture(shadowCascade.mDepthTexture);
+        renderDevice.VSetDrawBuffer(GL_NONE);
+        
+        const auto isFramebufferComplete = renderDevice.VIsFramebufferComplete();
+        assert(isFramebufferComplete && "Incomplete shadow cascade frame buffer");
+        (void)isFramebufferComplete;
+    }
+    
+    renderDevice.VBindFramebuffer(0);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RenderingSystem::InitializeInstanceBuffer() const
+{
+    auto& renderingContextComponent = ecs::World::GetInstance().GetSingletonComponent<RenderingContextSingletonComponent>();
+    renderingContextComponent.mInstanceBufferObject = renderingContextComponent.mRenderDevice->VCreateBuffer();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RenderingSystem::InitializeTextBuffers() const
+{
+    auto& renderingContextComponent = ecs::World::GetInstance().GetSingletonComponent<RenderingContextSingletonComponent>();
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    renderingContextComponent.mTextVertexArrayObject = renderDevice.VCreateVertexArray();
+    renderingContextComponent.mTextVertexBufferObject = renderDevice.VCreateBuffer();
+    
+    // Matches the vertex attribute locations of the batched text shaders
+    renderDevice.VBindVertexArray(renderingContextComponent.mTextVertexArrayObject);
+    renderDevice.VBindBuffer(GL_ARRAY_BUFFER, renderingContextComponent.mTextVertexBufferObject);
+    renderDevice.VSetVertexAttributeEnabled(0, true);
+    renderDevice.VSetVertexAttributePointer(0, 3, sizeof(TextVertexData), offsetof(TextVertexData, mPosition));
+    renderDevice.VSetVertexAttributeEnabled(1, true);
+    renderDevice.VSetVertexAttributePointer(1, 2, sizeof(TextVertexData), offsetof(TextVertexData, mTexCoords));
+    renderDevice.VSetVertexAttributeEnabled(2, true);
+    renderDevice.VSetVertexAttributePointer(2, 4, sizeof(TextVertexData), offsetof(TextVertexData, mColor));
+    renderDevice.VBindVertexArray(0);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RenderingSystem::InitializeParticleBuffers() const
+{
+    auto& renderingContextComponent = ecs::World::GetInstance().GetSingletonComponent<RenderingContextSingletonComponent>();
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    renderingContextComponent.mParticleVertexArrayObject = renderDevice.VCreateVertexArray();
+    renderingContextComponent.mParticleQuadBufferObject = renderDevice.VCreateBuffer();
+    renderingContextComponent.mParticleInstanceBufferObject = renderDevice.VCreateBuffer();
+    
+    // The quad positions are followed by the quad uvs in the same buffer
+    renderDevice.VBindVertexArray(renderingContextComponent.mParticleVertexArrayObject);
+    renderDevice.VBindBuffer(GL_ARRAY_BUFFER, renderingContextComponent.mParticleQuadBufferObject);
+    renderDevice.VBufferData(GL_ARRAY_BUFFER, sizeof(PARTICLE_QUAD_VERTEX_POSITIONS) + sizeof(PARTICLE_QUAD_UVS), nullptr, GL_STATIC_DRAW);
+    renderDevice.VBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(PARTICLE_QUAD_VERTEX_POSITIONS), PARTICLE_QUAD_VERTEX_POSITIONS.data());
+    renderDevice.VBufferSubData(GL_ARRAY_BUFFER, sizeof(PARTICLE_QUAD_VERTEX_POSITIONS), sizeof(PARTICLE_QUAD_UVS), PARTICLE_QUAD_UVS.data());
+    renderDevice.VSetVertexAttributeEnabled(0, true);
+    renderDevice.VSetVertexAttributePointer(0, 3, 0, 0);
+    renderDevice.VSetVertexAttributeEnabled(1, true);
+    renderDevice.VSetVertexAttributePointer(1, 2, 0, sizeof(PARTICLE_QUAD_VERTEX_POSITIONS));
+    
+    // Matches the per instance attribute locations of the particle shaders. The pointers themselves
+    // are respecified for every emitter type's sub-range of the instance buffer.
+    renderDevice.VBindBuffer(GL_ARRAY_BUFFER, renderingContextComponent.mParticleInstanceBufferObject);
+    for (GLuint attributeLocation = 2; attributeLocation <= 4; ++attributeLocation)
+    {
+        renderDevice.VSetVertexAttributeEnabled(attributeLocation, true);
+        renderDevice.VSetVertexAttributeDivisor(attributeLocation, 1);
+    }
+    renderDevice.VBindVertexArray(0);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RenderingSystem::InitializeFrameUniformBuffer() const
+{
+    static_assert(sizeof(FrameUniformData) % sizeof(glm::vec4) == 0, "std140 uniform blocks are sized in multiples of vec4s");
     
-    GL_CHECK_AGAINST_ARG(glCheckFramebufferStatus(GL_FRAMEBUFFER), GL_FRAMEBUFFER_COMPLETE);
-    GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+    auto& renderingContextComponent = ecs::World::GetInstance().GetSingletonComponent<RenderingContextSingletonComponent>();
+    auto& renderDevice = *renderingContextComponent.mRenderDevice;
+    renderingContextComponent.mFrameUniformBufferObject = renderDevice.VCreateBuffer();
+    renderDevice.VBindBuffer(GL_UNIFORM_BUFFER, renderingContextComponent.mFrameUniformBufferObject);
+    renderDevice.VBufferData(GL_UNIFORM_BUFFER, sizeof(FrameUniformData), nullptr, GL_DYNAMIC_DRAW);
+    renderDevice.VBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RenderingSystem::InitializeRenderStats() const
+{
+    ecs::World::GetInstance().SetSingletonComponent<RenderStatsSingletonComponent>(std::make_unique<RenderStatsSingletonComponent>());
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -964,9 +1280,10 @@ void RenderingSystem::CompileAndLoadShaders() const
     auto& renderingContextComponent = ecs::World::GetInstance().GetSingletonComponent<RenderingContextSingletonComponent>();
     
     // Bind default VAO for correct shader compilation
-    GL_CHECK(glGenVertexArrays(1, &renderingContextComponent.mDefaultVertexArrayObject));
-    GL_CHECK(glBindVertexArray(renderingContextComponent.mDefaultVertexArrayObject));
+    renderingContextComponent.mDefaultVertexArrayObject = renderingContextComponent.mRenderDevice->VCreateVertexArray();
+    renderingContextComponent.mRenderDevice->VBindVertexArray(renderingContextComponent.mDefaultVertexArrayObject);
     
+    const auto shaderLoadingStartNanos = debug::Profiler::GetTimestampNanos();
     const auto shaderNames    = GetAndFilterShaderNames();
     auto shaderStoreComponent = std::make_unique<ShaderStoreSingletonComponent>();
     
@@ -985,7 +1302,10 @@ void RenderingSystem::CompileAndLoadShaders() const
     }
     
     // Unbind any VAO currently bound
-    GL_CHECK(glBindVertexArray(0));
+    renderingContextComponent.mRenderDevice->VBindVertexArray(0);
+    
+    // Startup cost of the shaders, for comparing runs with a cold and a warm program binary cache
+    Log(LogType::INFO, "Loaded %d shaders in %.2fms", static_cast<int>(shaderNames.size()), (debug::Profiler::GetTimestampNanos() - shaderLoadingStartNanos)/NANOS_PER_MILLI);
     
     ecs::World::GetInstance().SetSingletonComponent<ShaderStoreSingletonComponent>(std::move(shaderStoreComponent));
 }
@@ -1010,7 +1330,207 @@ std::set<std::string> RenderingSystem::GetAndFilterShaderNames() const
 
 ///-----------------------------------------------------------------------------------------------
 
+bool CanBeRenderedInstanced(const RenderableComponent& renderableComponent, const resources::MeshResource& mesh)
+{
+    // Skeletal models carry per entity bone transforms, and custom uniforms can't be shared across a batch
+    return renderableComponent.mIsVisible &&
+        !mesh.HasSkeleton() &&
+        SHADER_NAME_TO_INSTANCED_SHADER_NAME.count(renderableComponent.mShaderNameId) != 0 &&
+        renderableComponent.mShaderUniforms.IsEmpty();
 }
 
+///-----------------------------------------------------------------------------------------------
+
+bool CanBeRenderedBatched(const RenderableComponent& renderableComponent)
+{
+    // Text colors are baked in to the vertices, any other custom uniform can't be shared across a batch
+    const auto& shaderUniformEntries = renderableComponent.mShaderUniforms.GetEntries();
+    return SHADER_NAME_TO_BATCHED_TEXT_SHADER_NAME.count(renderableComponent.mShaderNameId) != 0 &&
+        (shaderUniformEntries.empty() || (shaderUniformEntries.size() == 1 && shaderUniformEntries[0].mSlot == CUSTOM_COLOR_UNIFORM_SLOT && shaderUniformEntries[0].mType == UniformType::FLOAT_VEC4));
 }
 
+///-----------------------------------------------------------------------------------------------
+
+void UpdateTextStringVertices(const RenderableComponent& renderableComponent, const glm::mat4& worldMatrix, TextStringComponent& textStringComponent)
+{
+    auto color = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
+    const auto& shaderUniformEntries = renderableComponent.mShaderUniforms.GetEntries();
+    if (!shaderUniformEntries.empty())
+    {
+        std::memcpy(&color, renderableComponent.mShaderUniforms.GetEntryValues(shaderUniformEntries[0]), sizeof(glm::vec4));
+    }
+    
+    if
+    (
+        !textStringComponent.mVerticesDirty &&
+        textStringComponent.mVerticesText == textStringComponent.mText &&
+        textStringComponent.mVerticesWorldMatrix == worldMatrix &&
+        textStringComponent.mVerticesColor == color
+    )
+    {
+        return;
+    }
+    
+    const auto& fontsStoreComponent = ecs::World::GetInstance().GetSingletonComponent<FontsStoreSingletonComponent>();
+    
+    // Each glyph is offset along the x axis from the previous one, in world space
+    auto glyphWorldMatrix = worldMatrix;
+    textStringComponent.mVertices.clear();
+    for (const auto& meshResourceId: renderableComponent.mMeshResourceIds)
+    {
+        const auto& glyphTexCoords = fontsStoreComponent.mGlyphTexCoords.at(meshResourceId);
+        for (const auto cornerIndex: GLYPH_QUAD_CORNER_INDICES)
+        {
+            textStringComponent.mVertices.push_back({ glm::vec3(glyphWorldMatrix * GLYPH_QUAD_CORNERS[cornerIndex]), glyphTexCoords[cornerIndex], color });
+        }
+        glyphWorldMatrix[3].x += textStringComponent.mPaddingProportionalToSize * textStringComponent.mCharacterSize;
+    }
+    
+    textStringComponent.mVerticesText        = textStringComponent.mText;
+    textStringComponent.mVerticesWorldMatrix = worldMatrix;
+    textStringComponent.mVerticesColor       = color;
+    textStringComponent.mVerticesDirty       = false;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void EnableInstanceAttribute(IRenderDevice& renderDevice, const GLuint attributeLocation, const GLint componentCount, const std::size_t byteOffset)
+{
+    renderDevice.VSetVertexAttributeEnabled(attributeLocation, true);
+    renderDevice.VSetVertexAttributePointer(attributeLocation, componentCount, sizeof(InstancedModelData), byteOffset);
+    renderDevice.VSetVertexAttributeDivisor(attributeLocation, 1);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+glm::mat4 GetWorldMatrix(const TransformComponent& transformComponent, const RenderableComponent& renderableComponent, const WindowSingletonComponent& windowComponent)
+{
+    // Correct display of hud entities, whose x scale is relative to the window's height
+    if (renderableComponent.mRenderableType == RenderableType::GUI_SPRITE)
+    {
+        return glm::scale(transformComponent.mWorldMatrix, glm::vec3(1.0f/windowComponent.mAspectRatio, 1.0f, 1.0f));
+    }
+    
+    return transformComponent.mWorldMatrix;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void AddEntityCullingSphere(const ecs::EntityId entityId, CullingSpheres& cullingSpheres)
+{
+    const auto& world = ecs::World::GetInstance();
+    const auto& transformComponent = world.GetComponent<TransformComponent>(entityId);
+    const auto& renderableComponent = world.GetComponent<RenderableComponent>(entityId);
+    
+    // 3d texts are bounded by their string's extent
+    if (renderableComponent.mRenderableType == RenderableType::TEXT_3D_MODEL)
+    {
+        const auto& textStringComponent = world.GetComponent<TextStringComponent>(entityId);
+        const auto scaledTextDimensions = glm::vec3(textStringComponent.mText.size(), textStringComponent.mCharacterSize, textStringComponent.mCharacterSize) * transformComponent.mScale;
+        AddCullingSphere
+        (
+            transformComponent.mPosition + glm::vec3(textStringComponent.mText.size() * textStringComponent.mCharacterSize/2, 0.0f, 0.0f),
+            math::Max(scaledTextDimensions.x, math::Max(scaledTextDimensions.y, scaledTextDimensions.z)) * 0.5f,
+            cullingSpheres
+        );
+        return;
+    }
+    
+    // Other entities without a model are never culled
+    if (renderableComponent.mRenderableType != RenderableType::NORMAL_MODEL || renderableComponent.mMeshResourceIds.size() == 0)
+    {
+        AddCullingSphere(transformComponent.mPosition, std::numeric_limits<float>::max(), cullingSpheres);
+        return;
+    }
+    
+    const auto& currentMesh = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex]);
+    const auto maxScale = math::Max(transformComponent.mScale.x, math::Max(transformComponent.mScale.y, transformComponent.mScale.z));
+    
+    // Meshes are not necessarily modelled around their origin
+    const auto boundingBoxCenter = glm::vec3(transformComponent.mWorldMatrix * glm::vec4(currentMesh.GetBoundingBoxCenter(), 1.0f));
+    AddCullingSphere(boundingBoxCenter, currentMesh.GetBoundingSphereRadius() * maxScale, cullingSpheres);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RasterizeOccluders(const std::vector<ecs::EntityId>& applicableEntities, const CameraSingletonComponent& cameraComponent, RenderingContextSingletonComponent& renderingContextComponent)
+{
+    const debug::ProfilerZone rasterizeOccludersZone("RasterizeOccluders");
+    
+    const auto& world = ecs::World::GetInstance();
+    const auto& cullingSpheres = renderingContextComponent.mCullingSpheres;
+    const auto& cullingResults = renderingContextComponent.mCullingResults;
+    auto& occlusionDepthBuffer = renderingContextComponent.mOcclusionDepthBuffer;
+    
+    ClearOcclusionDepthBuffer(cameraComponent.mProjectionMatrix * cameraComponent.mViewMatrix, cameraComponent.mZNear, occlusionDepthBuffer);
+    
+    // Height maps always occlude, while static models are picked by how large they appear on screen
+    std::vector<std::pair<float, std::size_t>> occluderModelCandidates;
+    for (auto i = 0U; i < applicableEntities.size(); ++i)
+    {
+        const auto entityId = applicableEntities[i];
+        const auto& renderableComponent = world.GetComponent<RenderableComponent>(entityId);
+        if (renderableComponent.mRenderableType != RenderableType::NORMAL_MODEL || !renderableComponent.mIsVisible)
+        {
+            continue;
+        }
+        
+        if (world.HasComponent<HeightMapComponent>(entityId))
+        {
+            const auto& heightMapComponent = world.GetComponent<HeightMapComponent>(entityId);
+            RasterizeOccluder(heightMapComponent.mOccluderVertices, heightMapComponent.mOccluderIndices, world.GetComponent<TransformComponent>(entityId).mWorldMatrix, occlusionDepthBuffer);
+            continue;
+        }
+        
+        // Only models known to be solid are guaranteed to cover their proxy box. Ships, banners, animated
+        // models and the like are mostly empty space within their bounds.
+        if (!cullingResults[i] || !renderableComponent.mIsOccluder || renderableComponent.mMeshResourceIds.size() == 0)
+        {
+            continue;
+        }
+        
+        const auto cullingSphereCenter = glm::vec3(cullingSpheres.mCenterX[i], cullingSpheres.mCenterY[i], cullingSpheres.mCenterZ[i]);
+        const auto cameraDistance = math::Max(glm::distance(cullingSphereCenter, cameraComponent.mPosition), cameraComponent.mZNear);
+        const auto screenSize = cullingSpheres.mRadius[i]/cameraDistance;
+        if (screenSize >= MIN_OCCLUDER_MODEL_SCREEN_SIZE)
+        {
+            occluderModelCandidates.emplace_back(screenSize, i);
+        }
+    }
+    
+    const auto occluderModelCount = math::Min(occluderModelCandidates.size(), MAX_OCCLUDER_MODELS_PER_FRAME);
+    std::partial_sort(occluderModelCandidates.begin(), occluderModelCandidates.begin() + occluderModelCount, occluderModelCandidates.end(), [](const std::pair<float, std::size_t>& lhs, const std::pair<float, std::size_t>& rhs)
+    {
+        return lhs.first > rhs.first;
+    });
+    
+    std::vector<glm::vec3> occluderProxyBoxVertices(8);
+    for (auto i = 0U; i < occluderModelCount; ++i)
+    {
+        const auto entityId = applicableEntities[occluderModelCandidates[i].second];
+        const auto& renderableComponent = world.GetComponent<RenderableComponent>(entityId);
+        const auto& currentMesh = resources::ResourceLoadingService::GetInstance().GetResource<resources::MeshResource>(renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex]);
+        
+        const auto proxyBoxCenter = currentMesh.GetBoundingBoxCenter();
+        const auto proxyBoxHalfExtents = currentMesh.GetDimensions() * OCCLUDER_PROXY_DIMENSIONS_FRACTION * 0.5f;
+        for (auto corner = 0U; corner < occluderProxyBoxVertices.size(); ++corner)
+        {
+            occluderProxyBoxVertices[corner] = proxyBoxCenter + glm::vec3
+            (
+                (corner & 0x1) ? proxyBoxHalfExtents.x : -proxyBoxHalfExtents.x,
+                (corner & 0x2) ? proxyBoxHalfExtents.y : -proxyBoxHalfExtents.y,
+                (corner & 0x4) ? proxyBoxHalfExtents.z : -proxyBoxHalfExtents.z
+            );
+        }
+        
+        RasterizeOccluder(occluderProxyBoxVertices, OCCLUDER_PROXY_BOX_INDICES, world.GetComponent<TransformComponent>(entityId).mWorldMatrix, occlusionDepthBuffer);
+    }
+    
+    BuildHiZPyramid(occlusionDepthBuffer);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
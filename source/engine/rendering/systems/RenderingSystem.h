@@ -13,10 +13,15 @@
 #include "../../common/utils/StringUtils.h"
 #include "../../common/utils/MathUtils.h"
 #include "../../ECS.h"
+#include "../utils/ShadowCascadeUtils.h"
 
+#include <cstdint>
+#include <map>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_set>
+#include <vector>
 
 ///-----------------------------------------------------------------------------------------------
 
@@ -37,13 +42,50 @@ namespace rendering
 class CameraSingletonComponent;
 class HeightMapComponent;
 class LightStoreSingletonComponent;
-class ParticleEmitterComponent;
 class RenderableComponent;
 class RenderingContextSingletonComponent;
 class TextStringComponent;
 class ShaderStoreSingletonComponent;
 class WindowSingletonComponent;
 
+///-----------------------------------------------------------------------------------------------
+/// Per instance data of the models drawn instanced, laid out as the per instance
+/// attributes of the instanced shaders expect it.
+struct InstancedModelData final
+{
+    glm::mat4 mWorldMatrix;
+    glm::mat4 mNormalMatrix;
+    glm::vec4 mMaterialAmbient;
+    glm::vec4 mMaterialDiffuse;
+    glm::vec4 mMaterialSpecular;
+    float mMaterialShininess;
+};
+
+/// Models sharing the same mesh resource, texture resource, instanced shader and
+/// light affection are drawn together with a single instanced draw call.
+using InstancedModelBatchKey = std::tuple<std::size_t, std::size_t, StringId, bool>;
+using InstancedModelBatches  = std::map<InstancedModelBatchKey, std::vector<InstancedModelData>>;
+
+///-----------------------------------------------------------------------------------------------
+/// Per frame camera and light data shared by all shaders through the FrameData uniform
+/// block, laid out following the std140 rules the block is declared with.
+struct FrameUniformData final
+{
+    static constexpr std::size_t MAX_LIGHT_COUNT = 32;
+    
+    glm::mat4 mViewMatrix;
+    glm::mat4 mProjectionMatrix;
+    glm::mat4 mLightSpaceMatrices[MAX_SHADOW_CASCADE_COUNT];
+    glm::vec4 mLightPositions[MAX_LIGHT_COUNT]; // std140 pads array elements to vec4s
+    glm::vec4 mLightPowers[MAX_LIGHT_COUNT];
+    glm::vec4 mShadowCascadeSplitDepths;        // far view space depth of each cascade
+    glm::vec3 mEyePosition;
+    float mDtAccumulator;
+    std::int32_t mShadowsEnabled;
+    std::int32_t mShadowCascadeCount;
+    std::int32_t mPadding[2];
+};
+
 ///-----------------------------------------------------------------------------------------------
 
 class RenderingSystem final: public ecs::BaseSystem<TransformComponent, RenderableComponent>
@@ -57,13 +99,18 @@ private:
     void DepthRenderingPass(const std::vector<ecs::EntityId>& applicableEntities) const;
     void FinalRenderingPass(const std::vector<ecs::EntityId>& applicableEntities) const;
     
-    void RenderParticleSystem
+    void UpdateFrameUniformBuffer
     (
-        const ParticleEmitterComponent& particleEmitterComponent,
-        const TransformComponent& entityTransformComponent,
-        const RenderableComponent& entityRenderableComponent,
+        const CameraSingletonComponent& globalCameraComponent,
+        const LightStoreSingletonComponent& lightStoreComponent,
+        const RenderingContextSingletonComponent& renderingContextComponent
+    ) const;
+    
+    void RenderParticleEmitters
+    (
+        const std::vector<ecs::EntityId>& particleEntities,
         const ShaderStoreSingletonComponent& shaderStoreComponent,
-        const CameraSingletonComponent& cameraComponent
+        RenderingContextSingletonComponent& renderingContextComponent
     ) const;
     
     void RenderHeightMapInternal
@@ -71,19 +118,31 @@ private:
         const TransformComponent& entityTransformComponent,
         const RenderableComponent& entityRenderableComponent,
         const HeightMapComponent& entityHeightMapComponent,
-        const CameraSingletonComponent& globalCameraComponent,
-        const LightStoreSingletonComponent& lightStoreComponent,
         const ShaderStoreSingletonComponent& globalShaderStoreComponent,
         const WindowSingletonComponent& globalWindowComponent,
         RenderingContextSingletonComponent& renderingContextComponent
     ) const;
     
+    void RenderString
+    (
+        const TransformComponent& entityTransformComponent,
+        const RenderableComponent& entityRenderableComponent,
+        const ShaderStoreSingletonComponent& globalShaderStoreComponent,
+        TextStringComponent& textStringComponent,
+        const WindowSingletonComponent& globalWindowComponent,
+        RenderingContextSingletonComponent& renderingContextComponent
+    ) const;
+    
+    void FlushTextBatch
+    (
+        const ShaderStoreSingletonComponent& globalShaderStoreComponent,
+        RenderingContextSingletonComponent& renderingContextComponent
+    ) const;
+    
     void RenderStringInternal
     (
         const TransformComponent& entityTransformComponent,
         const RenderableComponent& entityRenderableComponent,
-        const CameraSingletonComponent& globalCameraComponent,
-        const LightStoreSingletonComponent& lightStoreComponent,
         const ShaderStoreSingletonComponent& globalShaderStoreComponent,
         const TextStringComponent& textStringComponent,
         const WindowSingletonComponent& globalWindowComponent,
@@ -94,17 +153,27 @@ private:
     (        
         const TransformComponent& entityTransformComponent,
         const RenderableComponent& entityRenderableComponent,        
-        const CameraSingletonComponent& globalCameraComponent,
-        const LightStoreSingletonComponent& lightStoreComponent,
         const ShaderStoreSingletonComponent& globalShaderStoreComponent,
         const WindowSingletonComponent& globalWindowComponent,        
         RenderingContextSingletonComponent& renderingContextComponent        
     ) const;
     
+    void RenderInstancedModelBatches
+    (
+        const InstancedModelBatches& instancedModelBatches,
+        const ShaderStoreSingletonComponent& globalShaderStoreComponent,
+        RenderingContextSingletonComponent& renderingContextComponent
+    ) const;
+    
     void InitializeCamera() const;
     void InitializeLights() const;
-    void InitializeShadowMapTexture() const;
-    void InitializeFrameBuffers() const;
+    void InitializeShadowMapTextures() const;
+    void InitializeShadowMapFrameBuffers() const;
+    void InitializeInstanceBuffer() const;
+    void InitializeTextBuffers() const;
+    void InitializeParticleBuffers() const;
+    void InitializeFrameUniformBuffer() const;
+    void InitializeRenderStats() const;
     void CompileAndLoadShaders() const;
 
     std::set<std::string> GetAndFilterShaderNames() const;
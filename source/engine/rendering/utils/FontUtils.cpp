@@ -31,7 +31,8 @@ namespace
 {
     static const StringId TEXT_SHADER_NAME                     = StringId("default_gui");
     static const StringId TEXT_3D_SHADER_NAME                  = StringId("text_3d");
-    static const StringId GUI_SHADER_CUSTOM_COLOR_UNIFORM_NAME = StringId("custom_color");
+    
+    static const UniformSlot GUI_SHADER_CUSTOM_COLOR_UNIFORM_SLOT = GetUniformSlot(StringId("custom_color"));
 
     static const std::string FONT_MAP_FILE_EXTENSION           = ".dat";
     static const std::string FONT_ATLAS_TEXTURE_FILE_EXTENSION = ".png";
@@ -42,6 +43,17 @@ namespace
 
 ///------------------------------------------------------------------------------------------------
 
+static resources::ResourceId LoadGlyph
+(
+    const int glyphAtlasCol,
+    const int glyphAtlasRow,
+    const int fontAtlasCols,
+    const int fontAtlasRows,
+    FontsStoreSingletonComponent& fontStoreComponent
+);
+
+///------------------------------------------------------------------------------------------------
+
 void LoadFont
 (
     const StringId& fontName,
@@ -75,25 +87,25 @@ void LoadFont
         for (auto col = 0U; col < fontMapLineSplitBySpace.size(); ++col)
         {
             const auto currentFontCharacter = fontMapLineSplitBySpace[col][0];
-            fontStoreComponent.mLoadedFonts[fontName][currentFontCharacter] = LoadAndCreateMeshFromAtlasTexCoords
+            fontStoreComponent.mLoadedFonts[fontName][currentFontCharacter] = LoadGlyph
             (
                 col,
                 row,
                 fontAtlasCols,
                 fontAtlasRows,
-                false                
+                fontStoreComponent
             );
         }
     }
 
     // Add space character
-    fontStoreComponent.mLoadedFonts[fontName][' '] = LoadAndCreateMeshFromAtlasTexCoords
+    fontStoreComponent.mLoadedFonts[fontName][' '] = LoadGlyph
     (
         fontAtlasCols - 1,
         fontAtlasRows - 1,
         fontAtlasCols,
         fontAtlasRows,
-        false
+        fontStoreComponent
     );
 
     resources::ResourceLoadingService::GetInstance().UnloadResource(fontMapFileResourceId);
@@ -123,7 +135,7 @@ ecs::EntityId RenderText
     renderableComponent->mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource(resources::ResourceLoadingService::RES_ATLASES_ROOT + fontName.GetString() + FONT_ATLAS_TEXTURE_FILE_EXTENSION);
     renderableComponent->mShaderNameId = is3d ? TEXT_3D_SHADER_NAME : TEXT_SHADER_NAME;
     renderableComponent->mRenderableType = is3d ? genesis::rendering::RenderableType::TEXT_3D_MODEL : genesis::rendering::RenderableType::GUI_SPRITE;
-    renderableComponent->mShaderUniforms.mShaderFloatVec4Uniforms[GUI_SHADER_CUSTOM_COLOR_UNIFORM_NAME] = color;
+    renderableComponent->mShaderUniforms.SetFloatVec4(GUI_SHADER_CUSTOM_COLOR_UNIFORM_SLOT, color);
     
     for (const auto& character : text)
     {
@@ -217,6 +229,26 @@ genesis::math::Rectangle CalculateTextBoundingRect
 
 ///-----------------------------------------------------------------------------------------------
 
+resources::ResourceId LoadGlyph
+(
+    const int glyphAtlasCol,
+    const int glyphAtlasRow,
+    const int fontAtlasCols,
+    const int fontAtlasRows,
+    FontsStoreSingletonComponent& fontStoreComponent
+)
+{
+    const auto glyphMeshResourceId = LoadAndCreateMeshFromAtlasTexCoords(glyphAtlasCol, glyphAtlasRow, fontAtlasCols, fontAtlasRows, false);
+    
+    // Kept around so that strings can be batched without going through the glyph meshes
+    const auto texCoords = CalculateAtlasTexCoords(glyphAtlasCol, glyphAtlasRow, fontAtlasCols, fontAtlasRows, false);
+    fontStoreComponent.mGlyphTexCoords[glyphMeshResourceId] = { texCoords[0], texCoords[1], texCoords[2], texCoords[3] };
+    
+    return glyphMeshResourceId;
+}
+
+///-----------------------------------------------------------------------------------------------
+
 }
 
 }
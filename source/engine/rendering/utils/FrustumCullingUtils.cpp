@@ -0,0 +1,152 @@
+///------------------------------------------------------------------------------------------------
+///  FrustumCullingUtils.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "FrustumCullingUtils.h"
+#include "../../jobs/JobSystem.h"
+
+#include <algorithm>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define GENESIS_SSE_FRUSTUM_CULLING
+#include <xmmintrin.h>
+#endif
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace
+{
+    // Below this many spheres per job the dispatch overhead outweighs the culling work itself
+    static const std::size_t MIN_SPHERES_PER_CULLING_JOB = 1024;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+static void CullSphereRange(const CullingSpheres& cullingSpheres, const math::Frustum& frustum, const std::size_t rangeBegin, const std::size_t rangeEnd, std::vector<std::uint8_t>& visibilityResults);
+
+///-----------------------------------------------------------------------------------------------
+
+void ClearCullingSpheres(CullingSpheres& cullingSpheres)
+{
+    cullingSpheres.mCenterX.clear();
+    cullingSpheres.mCenterY.clear();
+    cullingSpheres.mCenterZ.clear();
+    cullingSpheres.mRadius.clear();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void AddCullingSphere(const glm::vec3& center, const float radius, CullingSpheres& cullingSpheres)
+{
+    cullingSpheres.mCenterX.push_back(center.x);
+    cullingSpheres.mCenterY.push_back(center.y);
+    cullingSpheres.mCenterZ.push_back(center.z);
+    cullingSpheres.mRadius.push_back(radius);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void CullSpheresAgainstFrustum(const CullingSpheres& cullingSpheres, const math::Frustum& frustum, std::vector<std::uint8_t>& visibilityResults)
+{
+    const auto sphereCount = cullingSpheres.mRadius.size();
+    visibilityResults.resize(sphereCount);
+
+    auto& jobSystem = jobs::JobSystem::GetInstance();
+    const auto jobCount = std::min(jobSystem.GetWorkerCount() + 1, sphereCount / MIN_SPHERES_PER_CULLING_JOB);
+    if (jobCount <= 1)
+    {
+        CullSphereRange(cullingSpheres, frustum, 0, sphereCount, visibilityResults);
+        return;
+    }
+
+    jobs::JobCounter cullingCounter;
+    for (auto i = 0U; i < jobCount; ++i)
+    {
+        const auto rangeBegin = i * sphereCount / jobCount;
+        const auto rangeEnd = (i + 1) * sphereCount / jobCount;
+        jobSystem.Run([&cullingSpheres, &frustum, &visibilityResults, rangeBegin, rangeEnd](){ CullSphereRange(cullingSpheres, frustum, rangeBegin, rangeEnd, visibilityResults); }, cullingCounter);
+    }
+    jobSystem.Wait(cullingCounter);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void CullSphereRange(const CullingSpheres& cullingSpheres, const math::Frustum& frustum, const std::size_t rangeBegin, const std::size_t rangeEnd, std::vector<std::uint8_t>& visibilityResults)
+{
+    auto i = rangeBegin;
+
+#if defined(GENESIS_SSE_FRUSTUM_CULLING)
+    __m128 planesX[6], planesY[6], planesZ[6], planesW[6];
+    for (auto j = 0U; j < 6U; ++j)
+    {
+        planesX[j] = _mm_set1_ps(frustum[j].x);
+        planesY[j] = _mm_set1_ps(frustum[j].y);
+        planesZ[j] = _mm_set1_ps(frustum[j].z);
+        planesW[j] = _mm_set1_ps(frustum[j].w);
+    }
+
+    const auto zero = _mm_setzero_ps();
+    for (; i + 4 <= rangeEnd; i += 4)
+    {
+        const auto centerX = _mm_loadu_ps(&cullingSpheres.mCenterX[i]);
+        const auto centerY = _mm_loadu_ps(&cullingSpheres.mCenterY[i]);
+        const auto centerZ = _mm_loadu_ps(&cullingSpheres.mCenterZ[i]);
+        const auto radius  = _mm_loadu_ps(&cullingSpheres.mRadius[i]);
+
+        // A sphere is outside of the frustum if it lies fully in front of any of its planes
+        auto outside = zero;
+        for (auto j = 0U; j < 6U; ++j)
+        {
+            auto dist = _mm_add_ps(_mm_mul_ps(planesX[j], centerX), _mm_mul_ps(planesY[j], centerY));
+            dist = _mm_add_ps(dist, _mm_mul_ps(planesZ[j], centerZ));
+            dist = _mm_sub_ps(_mm_add_ps(dist, planesW[j]), radius);
+            outside = _mm_or_ps(outside, _mm_cmpgt_ps(dist, zero));
+        }
+
+        const auto outsideMask = _mm_movemask_ps(outside);
+        visibilityResults[i + 0] = (outsideMask & 0x1) == 0;
+        visibilityResults[i + 1] = (outsideMask & 0x2) == 0;
+        visibilityResults[i + 2] = (outsideMask & 0x4) == 0;
+        visibilityResults[i + 3] = (outsideMask & 0x8) == 0;
+    }
+#endif
+
+    // Scalar path for the remaining spheres (or for all of them when SSE is unavailable)
+    for (; i < rangeEnd; ++i)
+    {
+        auto isOutside = false;
+        for (auto j = 0U; j < 6U && !isOutside; ++j)
+        {
+            const auto dist =
+                frustum[j].x * cullingSpheres.mCenterX[i] +
+                frustum[j].y * cullingSpheres.mCenterY[i] +
+                frustum[j].z * cullingSpheres.mCenterZ[i] +
+                frustum[j].w - cullingSpheres.mRadius[i];
+            
+            isOutside = dist > 0;
+        }
+        
+        visibilityResults[i] = !isOutside;
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
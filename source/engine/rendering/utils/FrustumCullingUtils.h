@@ -0,0 +1,68 @@
+///------------------------------------------------------------------------------------------------
+///  FrustumCullingUtils.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef FrustumCullingUtils_h
+#define FrustumCullingUtils_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../common/utils/MathUtils.h"
+
+#include <cstdint>
+#include <vector>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+/// The bounding spheres of a set of renderables, stored as one array per sphere component so
+/// that several spheres can be tested against a frustum plane at once.
+struct CullingSpheres final
+{
+    std::vector<float> mCenterX;
+    std::vector<float> mCenterY;
+    std::vector<float> mCenterZ;
+    std::vector<float> mRadius;
+};
+
+///-----------------------------------------------------------------------------------------------
+/// Removes all spheres from the given set, keeping its storage around.
+/// @param[in] cullingSpheres the sphere set to clear.
+void ClearCullingSpheres(CullingSpheres& cullingSpheres);
+
+///-----------------------------------------------------------------------------------------------
+/// Appends a sphere to the given set.
+/// @param[in] center the center of the sphere.
+/// @param[in] radius the radius of the sphere.
+/// @param[in] cullingSpheres the sphere set to append the sphere to.
+void AddCullingSphere(const glm::vec3& center, const float radius, CullingSpheres& cullingSpheres);
+
+///-----------------------------------------------------------------------------------------------
+/// Tests all spheres of the given set against the given frustum, with the same semantics as
+/// math::IsMeshInsideFrustum. Spheres are tested 4 at a time where SSE is available, and large
+/// sets are split across the workers of the job system.
+/// @param[in] cullingSpheres the spheres to test.
+/// @param[in] frustum the frustum to test the spheres against.
+/// @param[out] visibilityResults receives 1 for each sphere that is (at least partly) inside the frustum and 0 otherwise.
+void CullSpheresAgainstFrustum(const CullingSpheres& cullingSpheres, const math::Frustum& frustum, std::vector<std::uint8_t>& visibilityResults);
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* FrustumCullingUtils_h */
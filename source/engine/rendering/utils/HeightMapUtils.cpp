@@ -42,9 +42,41 @@ namespace
     static const StringId HEIGHTMAP_SHADER_NAME = StringId("heightMap");
 
     static const float HEIGHTMAP_Z_OFFSET = 0.001f;
+    
+    static const int HEIGHTMAP_OCCLUDER_MAX_CELLS_PER_SIDE = 32;
+    static const int HEIGHTMAP_CHUNK_CELLS_PER_SIDE        = 32;
 }
 
 
+///------------------------------------------------------------------------------------------------
+
+static void CreateHeightMapOccluderMesh
+(
+    const std::vector<glm::vec3>& vertices,
+    const int heightMapCols,
+    const int heightMapRows,
+    std::vector<glm::vec3>& occluderVertices,
+    std::vector<unsigned int>& occluderIndices
+);
+static void CreateHeightMapChunks
+(
+    const int heightMapCols,
+    const int heightMapRows,
+    std::vector<glm::vec3>& vertices,
+    std::vector<glm::vec2>& uvs,
+    std::vector<glm::vec3>& normals,
+    std::vector<unsigned int>& indices,
+    std::vector<HeightMapChunk>& chunks
+);
+static float CalculateChunkLodGeometricError
+(
+    const std::vector<glm::vec3>& vertices,
+    const int heightMapCols,
+    const std::vector<int>& lodRows,
+    const std::vector<int>& lodCols
+);
+static std::vector<int> GetGridSampleLines(const int firstLine, const int lastLine, const int step);
+
 ///------------------------------------------------------------------------------------------------
 
 ecs::EntityId LoadAndCreateHeightMapByName
@@ -182,19 +214,18 @@ ecs::EntityId LoadAndCreateHeightMapByName
         }
     }
     
-    const auto primitiveRestart = heightMapRows * heightMapCols;
-    for (auto row = 0; row < heightMapRows - 1; ++row)
-    {
-        for (auto col = 0; col < heightMapCols; ++col)
-        {
-            indices.push_back((row + 1) * heightMapCols + col);
-            indices.push_back(row * heightMapCols + col);
-        }
-        indices.push_back(primitiveRestart);
-    }
+    // Build the occluder before any skirt vertices get appended to the mesh
+    std::vector<glm::vec3> occluderVertices;
+    std::vector<unsigned int> occluderIndices;
+    CreateHeightMapOccluderMesh(vertices, heightMapCols, heightMapRows, occluderVertices, occluderIndices);
     
+    std::vector<HeightMapChunk> chunks;
+    CreateHeightMapChunks(heightMapCols, heightMapRows, vertices, uvs, normals, indices, chunks);
     
-    GLuint vertexArrayObject;
+    GLuint vertexArrayObject = 0;
+
+    // Headless builds keep the CPU side mesh data only
+#if !defined(GENESIS_HEADLESS)
     GLuint vertexBufferObject;
     GLuint uvCoordsBufferObject;
     GLuint normalsBufferObject;
@@ -220,7 +251,7 @@ ecs::EntityId LoadAndCreateHeightMapByName
     
     // Bind and buffer TBO
     GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, uvCoordsBufferObject));
-    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(glm::vec2), &uvs[0], GL_STATIC_DRAW));
+    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, uvs.size() * sizeof(glm::vec2), &uvs[0], GL_STATIC_DRAW));
     
     // 2nd attribute buffer: tex coords
     GL_CHECK(glEnableVertexAttribArray(1));
@@ -228,7 +259,7 @@ ecs::EntityId LoadAndCreateHeightMapByName
     
     // Bind and buffer NBO
     GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, normalsBufferObject));
-    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(glm::vec3), &normals[0], GL_STATIC_DRAW));
+    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(glm::vec3), &normals[0], GL_STATIC_DRAW));
     
     // 3rd attribute buffer: normals
     GL_CHECK(glEnableVertexAttribArray(2));
@@ -239,6 +270,7 @@ ecs::EntityId LoadAndCreateHeightMapByName
     GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), &indices[0], GL_STATIC_DRAW));
     
     GL_CHECK(glBindVertexArray(0));
+#endif
     
     auto& world = ecs::World::GetInstance();
     const auto heightMapEntity = world.CreateEntity();
@@ -258,7 +290,7 @@ ecs::EntityId LoadAndCreateHeightMapByName
     
     for (auto i = 0U; i < heightMapTextures.size(); ++i)
     {
-        renderableComponent->mShaderUniforms.mShaderIntUniforms[StringId(HEIGHTMAP_TEXTURE_UNIFORM_NAME + std::to_string(i))] = i;
+        renderableComponent->mShaderUniforms.SetInt(GetUniformSlot(StringId(HEIGHTMAP_TEXTURE_UNIFORM_NAME + std::to_string(i))), i);
     }
     
     auto heightMapComponent = std::make_unique<HeightMapComponent>();
@@ -267,6 +299,9 @@ ecs::EntityId LoadAndCreateHeightMapByName
     heightMapComponent->mHeightMapTextureResourceIds = heightMapTextures;
     heightMapComponent->mHeightMapTileHeights = heightMapTileHeights;
     heightMapComponent->mHeightMapScale = heightMapHeightScale;
+    heightMapComponent->mChunks = std::move(chunks);
+    heightMapComponent->mOccluderVertices = std::move(occluderVertices);
+    heightMapComponent->mOccluderIndices = std::move(occluderIndices);
     
     world.AddComponent<HeightMapComponent>(heightMapEntity, std::move(heightMapComponent));
     world.AddComponent<RenderableComponent>(heightMapEntity, std::move(renderableComponent));
@@ -305,6 +340,293 @@ float GetTerrainHeightAtPosition(const genesis::ecs::EntityId heightMapEntityId,
 
 ///-----------------------------------------------------------------------------------------------
 
+void CreateHeightMapOccluderMesh
+(
+    const std::vector<glm::vec3>& vertices,
+    const int heightMapCols,
+    const int heightMapRows,
+    std::vector<glm::vec3>& occluderVertices,
+    std::vector<unsigned int>& occluderIndices
+)
+{
+    const auto sampleColStep = math::Max(1, (heightMapCols - 1 + HEIGHTMAP_OCCLUDER_MAX_CELLS_PER_SIDE - 1)/HEIGHTMAP_OCCLUDER_MAX_CELLS_PER_SIDE);
+    const auto sampleRowStep = math::Max(1, (heightMapRows - 1 + HEIGHTMAP_OCCLUDER_MAX_CELLS_PER_SIDE - 1)/HEIGHTMAP_OCCLUDER_MAX_CELLS_PER_SIDE);
+    const auto sampleCols = GetGridSampleLines(0, heightMapCols - 1, sampleColStep);
+    const auto sampleRows = GetGridSampleLines(0, heightMapRows - 1, sampleRowStep);
+    const auto sampleColCount = static_cast<int>(sampleCols.size());
+    const auto sampleRowCount = static_cast<int>(sampleRows.size());
+    
+    occluderVertices.clear();
+    occluderIndices.clear();
+    if (sampleColCount < 2 || sampleRowCount < 2)
+    {
+        return;
+    }
+    
+    // Each occluder vertex takes the lowest height of all cells around it, so that
+    // the coarse triangles never rise above the (piecewise linear) height map surface
+    for (auto sampleRow = 0; sampleRow < sampleRowCount; ++sampleRow)
+    {
+        const auto firstRow = sampleRows[math::Max(0, sampleRow - 1)];
+        const auto lastRow = sampleRows[math::Min(sampleRowCount - 1, sampleRow + 1)];
+        
+        for (auto sampleCol = 0; sampleCol < sampleColCount; ++sampleCol)
+        {
+            const auto firstCol = sampleCols[math::Max(0, sampleCol - 1)];
+            const auto lastCol = sampleCols[math::Min(sampleColCount - 1, sampleCol + 1)];
+            
+            auto lowestHeight = vertices[firstRow * heightMapCols + firstCol].y;
+            for (auto row = firstRow; row <= lastRow; ++row)
+            {
+                for (auto col = firstCol; col <= lastCol; ++col)
+                {
+                    lowestHeight = math::Min(lowestHeight, vertices[row * heightMapCols + col].y);
+                }
+            }
+            
+            auto occluderVertex = vertices[sampleRows[sampleRow] * heightMapCols + sampleCols[sampleCol]];
+            occluderVertex.y = lowestHeight;
+            occluderVertices.push_back(occluderVertex);
+        }
+    }
+    
+    for (auto sampleRow = 0; sampleRow < sampleRowCount - 1; ++sampleRow)
+    {
+        for (auto sampleCol = 0; sampleCol < sampleColCount - 1; ++sampleCol)
+        {
+            const auto topLeft = static_cast<unsigned int>(sampleRow * sampleColCount + sampleCol);
+            const auto bottomLeft = topLeft + sampleColCount;
+            
+            occluderIndices.insert(occluderIndices.end(), { topLeft, bottomLeft, bottomLeft + 1 });
+            occluderIndices.insert(occluderIndices.end(), { bottomLeft + 1, topLeft + 1, topLeft });
+        }
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void CreateHeightMapChunks
+(
+    const int heightMapCols,
+    const int heightMapRows,
+    std::vector<glm::vec3>& vertices,
+    std::vector<glm::vec2>& uvs,
+    std::vector<glm::vec3>& normals,
+    std::vector<unsigned int>& indices,
+    std::vector<HeightMapChunk>& chunks
+)
+{
+    const auto chunkBoundaryCols = GetGridSampleLines(0, heightMapCols - 1, HEIGHTMAP_CHUNK_CELLS_PER_SIDE);
+    const auto chunkBoundaryRows = GetGridSampleLines(0, heightMapRows - 1, HEIGHTMAP_CHUNK_CELLS_PER_SIDE);
+    const auto chunkCols = static_cast<int>(chunkBoundaryCols.size()) - 1;
+    const auto chunkRows = static_cast<int>(chunkBoundaryRows.size()) - 1;
+    
+    chunks.clear();
+    indices.clear();
+    if (chunkCols < 1 || chunkRows < 1)
+    {
+        return;
+    }
+    
+    // Calculate the bounds of all chunks, and the geometric error of each of their levels of detail.
+    // Every level doubles the vertex spacing of the previous one, up to the chunk's size
+    auto maxGeometricError = 0.0f;
+    for (auto chunkRow = 0; chunkRow < chunkRows; ++chunkRow)
+    {
+        for (auto chunkCol = 0; chunkCol < chunkCols; ++chunkCol)
+        {
+            const auto firstRow = chunkBoundaryRows[chunkRow];
+            const auto lastRow = chunkBoundaryRows[chunkRow + 1];
+            const auto firstCol = chunkBoundaryCols[chunkCol];
+            const auto lastCol = chunkBoundaryCols[chunkCol + 1];
+            
+            auto minBounds = vertices[firstRow * heightMapCols + firstCol];
+            auto maxBounds = minBounds;
+            for (auto row = firstRow; row <= lastRow; ++row)
+            {
+                for (auto col = firstCol; col <= lastCol; ++col)
+                {
+                    minBounds = glm::min(minBounds, vertices[row * heightMapCols + col]);
+                    maxBounds = glm::max(maxBounds, vertices[row * heightMapCols + col]);
+                }
+            }
+            
+            HeightMapChunk chunk;
+            chunk.mCenter = (minBounds + maxBounds) * 0.5f;
+            chunk.mRadius = glm::length(maxBounds - minBounds) * 0.5f;
+            
+            for (auto step = 1; step <= HEIGHTMAP_CHUNK_CELLS_PER_SIDE; step *= 2)
+            {
+                HeightMapChunkLod chunkLod;
+                chunkLod.mGeometricError = CalculateChunkLodGeometricError(vertices, heightMapCols, GetGridSampleLines(firstRow, lastRow, step), GetGridSampleLines(firstCol, lastCol, step));
+                
+                // Keep errors increasing with every level, for levels to be picked by error alone
+                if (!chunk.mLods.empty())
+                {
+                    chunkLod.mGeometricError = math::Max(chunkLod.mGeometricError, chunk.mLods.back().mGeometricError);
+                }
+                
+                chunk.mLods.push_back(chunkLod);
+            }
+            
+            maxGeometricError = math::Max(maxGeometricError, chunk.mLods.back().mGeometricError);
+            chunks.push_back(chunk);
+        }
+    }
+    
+    // Skirts hang below the chunk edges shared with other chunks, deep enough to cover the cracks
+    // between neighbouring chunks drawn at different levels of detail. Skirt vertices are shared by
+    // all levels of detail of both chunks of an edge
+    const auto skirtDepth = maxGeometricError;
+    std::vector<unsigned int> skirtVertexIndices(heightMapRows * heightMapCols, 0);
+    const auto getSkirtVertexIndex = [&](const int row, const int col)
+    {
+        const auto vertexIndex = row * heightMapCols + col;
+        if (skirtVertexIndices[vertexIndex] == 0)
+        {
+            skirtVertexIndices[vertexIndex] = static_cast<unsigned int>(vertices.size());
+            vertices.push_back(vertices[vertexIndex] - glm::vec3(0.0f, skirtDepth, 0.0f));
+            uvs.push_back(uvs[vertexIndex]);
+            normals.push_back(normals[vertexIndex]);
+        }
+        return skirtVertexIndices[vertexIndex];
+    };
+    const auto addSkirtSegment = [&](const int row0, const int col0, const int row1, const int col1)
+    {
+        const auto edgeVertex0 = static_cast<unsigned int>(row0 * heightMapCols + col0);
+        const auto edgeVertex1 = static_cast<unsigned int>(row1 * heightMapCols + col1);
+        const auto skirtVertex0 = getSkirtVertexIndex(row0, col0);
+        const auto skirtVertex1 = getSkirtVertexIndex(row1, col1);
+        indices.insert(indices.end(), { edgeVertex0, edgeVertex1, skirtVertex1, skirtVertex1, skirtVertex0, edgeVertex0 });
+    };
+    
+    for (auto chunkRow = 0; chunkRow < chunkRows; ++chunkRow)
+    {
+        for (auto chunkCol = 0; chunkCol < chunkCols; ++chunkCol)
+        {
+            const auto firstRow = chunkBoundaryRows[chunkRow];
+            const auto lastRow = chunkBoundaryRows[chunkRow + 1];
+            const auto firstCol = chunkBoundaryCols[chunkCol];
+            const auto lastCol = chunkBoundaryCols[chunkCol + 1];
+            auto& chunk = chunks[chunkRow * chunkCols + chunkCol];
+            
+            auto step = 1;
+            for (auto& chunkLod: chunk.mLods)
+            {
+                const auto lodRows = GetGridSampleLines(firstRow, lastRow, step);
+                const auto lodCols = GetGridSampleLines(firstCol, lastCol, step);
+                chunkLod.mFirstIndex = static_cast<GLuint>(indices.size());
+                
+                for (auto lodRow = 0U; lodRow + 1 < lodRows.size(); ++lodRow)
+                {
+                    for (auto lodCol = 0U; lodCol + 1 < lodCols.size(); ++lodCol)
+                    {
+                        const auto topLeft = static_cast<unsigned int>(lodRows[lodRow] * heightMapCols + lodCols[lodCol]);
+                        const auto topRight = static_cast<unsigned int>(lodRows[lodRow] * heightMapCols + lodCols[lodCol + 1]);
+                        const auto bottomLeft = static_cast<unsigned int>(lodRows[lodRow + 1] * heightMapCols + lodCols[lodCol]);
+                        const auto bottomRight = static_cast<unsigned int>(lodRows[lodRow + 1] * heightMapCols + lodCols[lodCol + 1]);
+                        indices.insert(indices.end(), { topLeft, bottomLeft, bottomRight, bottomRight, topRight, topLeft });
+                    }
+                }
+                
+                // The outer edges of the height map have no neighbours, hence no skirts
+                for (auto lodCol = 0U; lodCol + 1 < lodCols.size(); ++lodCol)
+                {
+                    if (firstRow != 0)
+                    {
+                        addSkirtSegment(firstRow, lodCols[lodCol], firstRow, lodCols[lodCol + 1]);
+                    }
+                    if (lastRow != heightMapRows - 1)
+                    {
+                        addSkirtSegment(lastRow, lodCols[lodCol], lastRow, lodCols[lodCol + 1]);
+                    }
+                }
+                for (auto lodRow = 0U; lodRow + 1 < lodRows.size(); ++lodRow)
+                {
+                    if (firstCol != 0)
+                    {
+                        addSkirtSegment(lodRows[lodRow], firstCol, lodRows[lodRow + 1], firstCol);
+                    }
+                    if (lastCol != heightMapCols - 1)
+                    {
+                        addSkirtSegment(lodRows[lodRow], lastCol, lodRows[lodRow + 1], lastCol);
+                    }
+                }
+                
+                chunkLod.mIndexCount = static_cast<GLuint>(indices.size()) - chunkLod.mFirstIndex;
+                step *= 2;
+            }
+        }
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+float CalculateChunkLodGeometricError
+(
+    const std::vector<glm::vec3>& vertices,
+    const int heightMapCols,
+    const std::vector<int>& lodRows,
+    const std::vector<int>& lodCols
+)
+{
+    // Compare the height of every full resolution vertex against the level's cell triangles above or below it,
+    // which are split along their top left to bottom right diagonal
+    auto geometricError = 0.0f;
+    for (auto lodRow = 0U; lodRow + 1 < lodRows.size(); ++lodRow)
+    {
+        for (auto lodCol = 0U; lodCol + 1 < lodCols.size(); ++lodCol)
+        {
+            const auto firstRow = lodRows[lodRow];
+            const auto lastRow = lodRows[lodRow + 1];
+            const auto firstCol = lodCols[lodCol];
+            const auto lastCol = lodCols[lodCol + 1];
+            
+            const auto topLeftHeight = vertices[firstRow * heightMapCols + firstCol].y;
+            const auto topRightHeight = vertices[firstRow * heightMapCols + lastCol].y;
+            const auto bottomLeftHeight = vertices[lastRow * heightMapCols + firstCol].y;
+            const auto bottomRightHeight = vertices[lastRow * heightMapCols + lastCol].y;
+            
+            for (auto row = firstRow; row <= lastRow; ++row)
+            {
+                for (auto col = firstCol; col <= lastCol; ++col)
+                {
+                    const auto u = static_cast<float>(col - firstCol)/(lastCol - firstCol);
+                    const auto v = static_cast<float>(row - firstRow)/(lastRow - firstRow);
+                    const auto lodHeight = v >= u ?
+                        topLeftHeight + u * (bottomRightHeight - bottomLeftHeight) + v * (bottomLeftHeight - topLeftHeight) :
+                        topLeftHeight + u * (topRightHeight - topLeftHeight) + v * (bottomRightHeight - topRightHeight);
+                    
+                    geometricError = math::Max(geometricError, math::Abs(lodHeight - vertices[row * heightMapCols + col].y));
+                }
+            }
+        }
+    }
+    
+    return geometricError;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+std::vector<int> GetGridSampleLines(const int firstLine, const int lastLine, const int step)
+{
+    std::vector<int> sampleLines;
+    if (lastLine <= firstLine)
+    {
+        return sampleLines;
+    }
+    
+    for (auto line = firstLine; line < lastLine; line += step)
+    {
+        sampleLines.push_back(line);
+    }
+    sampleLines.push_back(lastLine);
+    
+    return sampleLines;
+}
+
+///-----------------------------------------------------------------------------------------------
+
 }
 
 }
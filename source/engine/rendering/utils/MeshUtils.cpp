@@ -36,8 +36,8 @@ namespace
     static const StringId GUI_ANIMATED_MODEL_3D_SHADER_NAME    = StringId("default_gui_skeletal_3d");
     static const StringId DEFAULT_MODEL_SHADER                 = StringId("default_3d");
     static const StringId ATLAS_MODEL_NAME                     = StringId("gui_atlas_quad");
-    static const StringId BONES_UNIFORM_NAME                   = StringId("bones");
-    static const StringId GUI_SHADER_CUSTOM_COLOR_UNIFORM_NAME = StringId("custom_color");
+    static const UniformSlot BONES_UNIFORM_SLOT                   = GetUniformSlot(StringId("bones"));
+    static const UniformSlot GUI_SHADER_CUSTOM_COLOR_UNIFORM_SLOT = GetUniformSlot(StringId("custom_color"));
     static const StringId IDLE_ANIMATION_NAME                  = StringId("idle");
 }
 
@@ -57,6 +57,17 @@ static std::string CreateTexCoordInjectedModelPath
     const std::vector<glm::vec2>& texCoords
 );
 
+template<class EntityCreatorType>
+static ecs::EntityId CreateStaticModelEntity
+(
+    EntityCreatorType& entityCreator,
+    const std::string& modelName,
+    const glm::vec3& initialPosition,
+    const glm::vec3& initialRotation,
+    const glm::vec3& initialScale,
+    const StringId entityName
+);
+
 ///------------------------------------------------------------------------------------------------
 
 ecs::EntityId LoadAndCreateStaticModelByName
@@ -68,33 +79,22 @@ ecs::EntityId LoadAndCreateStaticModelByName
     const StringId entityName /* StringId() */
 )
 {
-    auto& world = ecs::World::GetInstance();
-    const auto modelEntity = world.CreateEntity();
-
-    auto transformComponent = std::make_unique<TransformComponent>();
-    transformComponent->mPosition = initialPosition;
-    transformComponent->mRotation = initialRotation;
-    transformComponent->mScale = initialScale;
-
-    auto renderableComponent = std::make_unique<RenderableComponent>();        
-    renderableComponent->mShaderNameId = DEFAULT_MODEL_SHADER;
-    renderableComponent->mMeshResourceIds.push_back(
-        resources::ResourceLoadingService::GetInstance().
-        LoadResource(resources::ResourceLoadingService::RES_MODELS_ROOT + modelName + ".obj"));
-    renderableComponent->mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource
-    (
-        resources::ResourceLoadingService::RES_TEXTURES_ROOT + modelName + ".png"
-    );
-    
-    world.AddComponent<RenderableComponent>(modelEntity, std::move(renderableComponent));
-    world.AddComponent<TransformComponent>(modelEntity, std::move(transformComponent));
+    return CreateStaticModelEntity(ecs::World::GetInstance(), modelName, initialPosition, initialRotation, initialScale, entityName);
+}
 
-    if (entityName != StringId())
-    {
-        world.AddComponent<NameComponent>(modelEntity, std::make_unique<NameComponent>(entityName));
-    }
+///------------------------------------------------------------------------------------------------
 
-    return modelEntity;
+ecs::EntityId LoadAndCreateStaticModelByName
+(
+    ecs::EntityCommandBuffer& commandBuffer,
+    const std::string& modelName,
+    const glm::vec3& initialPosition /* glm::vec3(0.0f, 0.0f, 0.0f) */,
+    const glm::vec3& initialRotation /* glm::vec3(0.0f, 0.0f, 0.0f) */,
+    const glm::vec3& initialScale /* glm::vec3(1.0f, 1.0f, 1.0f) */,
+    const StringId entityName /* StringId() */
+)
+{
+    return CreateStaticModelEntity(commandBuffer, modelName, initialPosition, initialRotation, initialScale, entityName);
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -142,7 +142,7 @@ ecs::EntityId LoadAndCreateAnimatedModelByName
         
         const auto& meshResource = resources::ResourceLoadingService::GetInstance().GetResource<genesis::resources::MeshResource>(meshResourceId);
         renderableComponent->mBoneTransformMatrices.resize(meshResource.GetBoneOffsetMatrices().size());
-        renderableComponent->mShaderUniforms.mShaderMatrixArrayUniforms[BONES_UNIFORM_NAME].resize(meshResource.GetBoneOffsetMatrices().size());
+        renderableComponent->mShaderUniforms.SetMatrixArray(BONES_UNIFORM_SLOT, renderableComponent->mBoneTransformMatrices);
     }
     
     renderableComponent->mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource
@@ -191,7 +191,7 @@ ecs::EntityId LoadAndCreateGuiSprite
     renderableComponent->mMeshResourceIds.push_back(
         resources::ResourceLoadingService::GetInstance().
         LoadResource(resources::ResourceLoadingService::RES_MODELS_ROOT + modelName + ".obj"));
-    renderableComponent->mShaderUniforms.mShaderFloatVec4Uniforms[GUI_SHADER_CUSTOM_COLOR_UNIFORM_NAME] = genesis::colors::BLACK;
+    renderableComponent->mShaderUniforms.SetFloatVec4(GUI_SHADER_CUSTOM_COLOR_UNIFORM_SLOT, genesis::colors::BLACK);
     renderableComponent->mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource
     (
         resources::ResourceLoadingService::RES_TEXTURES_ROOT + textureName + ".png"
@@ -218,6 +218,24 @@ resources::ResourceId LoadAndCreateMeshFromAtlasTexCoords
     const int atlasRowCount,
     const bool horizontalFlip /* false */
 )
+{
+    const auto texCoords = CalculateAtlasTexCoords(meshAtlasCol, meshAtlasRow, atlasColCount, atlasRowCount, horizontalFlip);
+    const auto meshPath  = CreateTexCoordInjectedModelPath(texCoords);
+
+    const auto loadedMeshResourceId = resources::ResourceLoadingService::GetInstance().LoadResource(meshPath);
+    return loadedMeshResourceId;   
+}
+
+///-----------------------------------------------------------------------------------------------
+
+std::vector<glm::vec2> CalculateAtlasTexCoords
+(
+    const int meshAtlasCol,
+    const int meshAtlasRow,
+    const int atlasColCount,
+    const int atlasRowCount,
+    const bool horizontalFlip /* false */
+)
 {
     auto correctedMeshCol = meshAtlasCol;
     auto correctedMeshRow = meshAtlasRow;
@@ -228,11 +246,7 @@ resources::ResourceId LoadAndCreateMeshFromAtlasTexCoords
         correctedMeshRow++;
     }
 
-    const auto texCoords = CalculateTextureCoordsFromColumnAndRow(correctedMeshCol, correctedMeshRow, atlasColCount, atlasRowCount, horizontalFlip);
-    const auto meshPath  = CreateTexCoordInjectedModelPath(texCoords);
-
-    const auto loadedMeshResourceId = resources::ResourceLoadingService::GetInstance().LoadResource(meshPath);
-    return loadedMeshResourceId;   
+    return CalculateTextureCoordsFromColumnAndRow(correctedMeshCol, correctedMeshRow, atlasColCount, atlasRowCount, horizontalFlip);
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -296,6 +310,47 @@ std::string CreateTexCoordInjectedModelPath
 
 ///-----------------------------------------------------------------------------------------------
 
+template<class EntityCreatorType>
+ecs::EntityId CreateStaticModelEntity
+(
+    EntityCreatorType& entityCreator,
+    const std::string& modelName,
+    const glm::vec3& initialPosition,
+    const glm::vec3& initialRotation,
+    const glm::vec3& initialScale,
+    const StringId entityName
+)
+{
+    const auto modelEntity = entityCreator.CreateEntity();
+
+    auto transformComponent = std::make_unique<TransformComponent>();
+    transformComponent->mPosition = initialPosition;
+    transformComponent->mRotation = initialRotation;
+    transformComponent->mScale = initialScale;
+
+    auto renderableComponent = std::make_unique<RenderableComponent>();        
+    renderableComponent->mShaderNameId = DEFAULT_MODEL_SHADER;
+    renderableComponent->mMeshResourceIds.push_back(
+        resources::ResourceLoadingService::GetInstance().
+        LoadResource(resources::ResourceLoadingService::RES_MODELS_ROOT + modelName + ".obj"));
+    renderableComponent->mTextureResourceId = resources::ResourceLoadingService::GetInstance().LoadResource
+    (
+        resources::ResourceLoadingService::RES_TEXTURES_ROOT + modelName + ".png"
+    );
+    
+    entityCreator.template AddComponent<RenderableComponent>(modelEntity, std::move(renderableComponent));
+    entityCreator.template AddComponent<TransformComponent>(modelEntity, std::move(transformComponent));
+
+    if (entityName != StringId())
+    {
+        entityCreator.template AddComponent<NameComponent>(modelEntity, std::make_unique<NameComponent>(entityName));
+    }
+
+    return modelEntity;
+}
+
+///-----------------------------------------------------------------------------------------------
+
 }
 
 }
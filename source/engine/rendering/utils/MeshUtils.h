@@ -15,6 +15,8 @@
 #include "../../common/utils/StringUtils.h"
 #include "../../resources/ResourceLoadingService.h"
 
+#include <vector>
+
 ///------------------------------------------------------------------------------------------------
 
 namespace genesis
@@ -44,6 +46,28 @@ ecs::EntityId LoadAndCreateStaticModelByName
     const StringId entityName = StringId()
 );
 
+///------------------------------------------------------------------------------------------------
+/// Same as above, but the entity and its components are created through the given command buffer,
+/// so it is safe to call while iterating over a system's entities.
+///
+/// The entity will only exist after the next sync point.
+/// @param[in] commandBuffer the command buffer to record the creation of the entity in.
+/// @param[in] modelName the model with the given name to look for in the resource models folder.
+/// @param[in] initialPosition (optional) an initial position for the loaded model.
+/// @param[in] initialRotation (optional) an initial rotation for the loaded model.
+/// @param[in] initialScale (optional) an initial scale for the loaded model.
+/// @param[in] entityName (optional) a string to name the entity with.
+/// @returns the entity id reserved for the entity to be created.
+ecs::EntityId LoadAndCreateStaticModelByName
+(
+    ecs::EntityCommandBuffer& commandBuffer,
+    const std::string& modelName,
+    const glm::vec3& initialPosition = glm::vec3(0.0f, 0.0f, 0.0f),
+    const glm::vec3& initialRotation = glm::vec3(0.0f, 0.0f, 0.0f),
+    const glm::vec3& initialScale = glm::vec3(1.0f, 1.0f, 1.0f),
+    const StringId entityName = StringId()
+);
+
 ///------------------------------------------------------------------------------------------------
 /// Returns an entity holding the loaded (DAE) skeletally animated model based on the model name supplied.
 ///
@@ -108,6 +132,25 @@ resources::ResourceId LoadAndCreateMeshFromAtlasTexCoords
     const bool horizontalFlip = false
 );
 
+///------------------------------------------------------------------------------------------------
+/// Calculates the texture coords of the corners of an atlas subregion, in the order of the vertices
+/// of the meshes created by LoadAndCreateMeshFromAtlasTexCoords.
+///
+/// @param[in] meshAtlasCol the atlas column occupied by the desired subimage.
+/// @param[in] meshAtlasRow the atlas row occupied by the desired subimage.
+/// @param[in] atlasColCount the number of columns the atlas has.
+/// @param[in] atlasRowCount the number of rows the atlas has.
+/// @param[in] horizontalFlip (optional) whether or not result should be horizontally flipped.
+/// @returns the texture coords of the subregion's corners.
+std::vector<glm::vec2> CalculateAtlasTexCoords
+(
+    const int meshAtlasCol,
+    const int meshAtlasRow,
+    const int atlasColCount,
+    const int atlasRowCount,
+    const bool horizontalFlip = false
+);
+
 ///------------------------------------------------------------------------------------------------
 
 }
@@ -0,0 +1,393 @@
+///------------------------------------------------------------------------------------------------
+///  OcclusionCullingUtils.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "OcclusionCullingUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define GENESIS_SSE_OCCLUSION_CULLING
+#include <xmmintrin.h>
+#endif
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace
+{
+    // Triangles covering less screen area (in pixels squared) than this are skipped
+    static const double MIN_RASTERIZED_TRIANGLE_AREA = 1e-6;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+static void RasterizeClipSpaceTriangle(const glm::vec4& clipVertex0, const glm::vec4& clipVertex1, const glm::vec4& clipVertex2, OcclusionDepthBuffer& occlusionDepthBuffer);
+static bool IsSphereOccluded(const glm::vec3& center, const float radius, const OcclusionDepthBuffer& occlusionDepthBuffer);
+
+///-----------------------------------------------------------------------------------------------
+
+void ClearOcclusionDepthBuffer(const glm::mat4& viewProjectionMatrix, const float nearClipDepth, OcclusionDepthBuffer& occlusionDepthBuffer)
+{
+    auto& hiZLevels = occlusionDepthBuffer.mHiZLevels;
+    if (hiZLevels.empty())
+    {
+        auto levelWidth = OcclusionDepthBuffer::WIDTH;
+        auto levelHeight = OcclusionDepthBuffer::HEIGHT;
+        while (true)
+        {
+            hiZLevels.emplace_back(levelWidth * levelHeight);
+            if (levelWidth == 1 && levelHeight == 1)
+            {
+                break;
+            }
+
+            levelWidth = std::max(1, levelWidth/2);
+            levelHeight = std::max(1, levelHeight/2);
+        }
+    }
+
+    std::fill(hiZLevels[0].begin(), hiZLevels[0].end(), 0.0f);
+    occlusionDepthBuffer.mViewProjectionMatrix = viewProjectionMatrix;
+    occlusionDepthBuffer.mNearClipDepth = nearClipDepth;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RasterizeOccluder(const std::vector<glm::vec3>& vertices, const std::vector<unsigned int>& indices, const glm::mat4& worldMatrix, OcclusionDepthBuffer& occlusionDepthBuffer)
+{
+    const auto worldViewProjectionMatrix = occlusionDepthBuffer.mViewProjectionMatrix * worldMatrix;
+
+    auto& clipSpaceVertices = occlusionDepthBuffer.mClipSpaceVertices;
+    clipSpaceVertices.resize(vertices.size());
+    std::transform(vertices.cbegin(), vertices.cend(), clipSpaceVertices.begin(), [&worldViewProjectionMatrix](const glm::vec3& vertex)
+    {
+        return worldViewProjectionMatrix * glm::vec4(vertex, 1.0f);
+    });
+
+    const auto nearClipDepth = occlusionDepthBuffer.mNearClipDepth;
+    for (auto i = 0U; i + 2 < indices.size(); i += 3)
+    {
+        const glm::vec4 triangle[3] =
+        {
+            clipSpaceVertices[indices[i]],
+            clipSpaceVertices[indices[i + 1]],
+            clipSpaceVertices[indices[i + 2]]
+        };
+
+        // Clip the triangle against the near plane (w being the view depth), leaving a polygon of up to 4 vertices
+        glm::vec4 polygon[4];
+        auto polygonVertexCount = 0U;
+        for (auto j = 0U; j < 3U; ++j)
+        {
+            const auto& currentVertex = triangle[j];
+            const auto& nextVertex = triangle[(j + 1) % 3];
+            const auto isCurrentVertexInside = currentVertex.w >= nearClipDepth;
+            const auto isNextVertexInside = nextVertex.w >= nearClipDepth;
+
+            if (isCurrentVertexInside)
+            {
+                polygon[polygonVertexCount++] = currentVertex;
+            }
+
+            if (isCurrentVertexInside != isNextVertexInside)
+            {
+                const auto t = (nearClipDepth - currentVertex.w)/(nextVertex.w - currentVertex.w);
+                polygon[polygonVertexCount++] = currentVertex + (nextVertex - currentVertex) * t;
+            }
+        }
+
+        for (auto j = 1U; j + 1 < polygonVertexCount; ++j)
+        {
+            RasterizeClipSpaceTriangle(polygon[0], polygon[j], polygon[j + 1], occlusionDepthBuffer);
+        }
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void BuildHiZPyramid(OcclusionDepthBuffer& occlusionDepthBuffer)
+{
+    auto& hiZLevels = occlusionDepthBuffer.mHiZLevels;
+
+    auto childLevelWidth = OcclusionDepthBuffer::WIDTH;
+    auto childLevelHeight = OcclusionDepthBuffer::HEIGHT;
+    for (auto level = 1U; level < hiZLevels.size(); ++level)
+    {
+        const auto levelWidth = std::max(1, childLevelWidth/2);
+        const auto levelHeight = std::max(1, childLevelHeight/2);
+        const auto& childLevel = hiZLevels[level - 1];
+        auto& currentLevel = hiZLevels[level];
+
+        for (auto y = 0; y < levelHeight; ++y)
+        {
+            const auto childRow0 = 2 * y;
+            const auto childRow1 = std::min(2 * y + 1, childLevelHeight - 1);
+            for (auto x = 0; x < levelWidth; ++x)
+            {
+                const auto childCol0 = 2 * x;
+                const auto childCol1 = std::min(2 * x + 1, childLevelWidth - 1);
+
+                // Keep the furthest (i.e. smallest reciprocal) depth of the block
+                currentLevel[y * levelWidth + x] = std::min
+                (
+                    std::min(childLevel[childRow0 * childLevelWidth + childCol0], childLevel[childRow0 * childLevelWidth + childCol1]),
+                    std::min(childLevel[childRow1 * childLevelWidth + childCol0], childLevel[childRow1 * childLevelWidth + childCol1])
+                );
+            }
+        }
+
+        childLevelWidth = levelWidth;
+        childLevelHeight = levelHeight;
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void CullSpheresAgainstOcclusionDepthBuffer
+(
+    const CullingSpheres& cullingSpheres,
+    const std::vector<std::uint8_t>& frustumVisibilityResults,
+    const OcclusionDepthBuffer& occlusionDepthBuffer,
+    std::vector<std::uint8_t>& occlusionResults
+)
+{
+    const auto sphereCount = cullingSpheres.mRadius.size();
+    occlusionResults.resize(sphereCount);
+
+    for (auto i = 0U; i < sphereCount; ++i)
+    {
+        occlusionResults[i] = !frustumVisibilityResults[i] || !IsSphereOccluded
+        (
+            glm::vec3(cullingSpheres.mCenterX[i], cullingSpheres.mCenterY[i], cullingSpheres.mCenterZ[i]),
+            cullingSpheres.mRadius[i],
+            occlusionDepthBuffer
+        );
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RasterizeClipSpaceTriangle(const glm::vec4& clipVertex0, const glm::vec4& clipVertex1, const glm::vec4& clipVertex2, OcclusionDepthBuffer& occlusionDepthBuffer)
+{
+    // Triangle setup happens in double precision, as vertices clipped close to
+    // the near plane can project way outside of the buffer
+    struct ScreenVertex { double mX, mY, mReciprocalDepth; };
+    const auto toScreenVertex = [](const glm::vec4& clipVertex)
+    {
+        const auto reciprocalDepth = 1.0/clipVertex.w;
+        return ScreenVertex
+        {
+            (clipVertex.x * reciprocalDepth * 0.5 + 0.5) * OcclusionDepthBuffer::WIDTH,
+            (clipVertex.y * reciprocalDepth * 0.5 + 0.5) * OcclusionDepthBuffer::HEIGHT,
+            reciprocalDepth
+        };
+    };
+
+    ScreenVertex v0 = toScreenVertex(clipVertex0);
+    ScreenVertex v1 = toScreenVertex(clipVertex1);
+    ScreenVertex v2 = toScreenVertex(clipVertex2);
+
+    // Occluders are not back face culled, so make all triangles counter clockwise
+    auto area = (v1.mX - v0.mX) * (v2.mY - v0.mY) - (v2.mX - v0.mX) * (v1.mY - v0.mY);
+    if (std::abs(area) < MIN_RASTERIZED_TRIANGLE_AREA)
+    {
+        return;
+    }
+
+    if (area < 0.0)
+    {
+        std::swap(v1, v2);
+        area = -area;
+    }
+
+    // Pixels whose centers lie inside the triangle's bounds
+    const auto minX = std::max(0.0, std::ceil(std::min({ v0.mX, v1.mX, v2.mX }) - 0.5));
+    const auto maxX = std::min(OcclusionDepthBuffer::WIDTH - 1.0, std::floor(std::max({ v0.mX, v1.mX, v2.mX }) - 0.5));
+    const auto minY = std::max(0.0, std::ceil(std::min({ v0.mY, v1.mY, v2.mY }) - 0.5));
+    const auto maxY = std::min(OcclusionDepthBuffer::HEIGHT - 1.0, std::floor(std::max({ v0.mY, v1.mY, v2.mY }) - 0.5));
+    if (minX > maxX || minY > maxY)
+    {
+        return;
+    }
+
+    // Each edge function is positive on the inside of its edge, and equals the triangle's area at the opposite
+    // vertex. The depth at a pixel is then the sum of the vertex depths weighted by the edge functions over the area
+    const ScreenVertex* edgeStartVertices[3] = { &v1, &v2, &v0 };
+    const ScreenVertex* edgeEndVertices[3]   = { &v2, &v0, &v1 };
+    const ScreenVertex* oppositeVertices[3]  = { &v0, &v1, &v2 };
+
+    float edgeStepsX[3];
+    double edgeStepsY[3];
+    float depthWeights[3];
+    for (auto i = 0U; i < 3U; ++i)
+    {
+        edgeStepsX[i] = static_cast<float>(edgeStartVertices[i]->mY - edgeEndVertices[i]->mY);
+        edgeStepsY[i] = edgeEndVertices[i]->mX - edgeStartVertices[i]->mX;
+        depthWeights[i] = static_cast<float>(oppositeVertices[i]->mReciprocalDepth/area);
+    }
+
+    // Rows are walked in groups of 4 pixels, starting from a 4 pixel aligned column
+    // (the buffer's width being a multiple of 4, the last group never exceeds the row)
+    const auto startX = static_cast<int>(minX) & ~3;
+    const auto endX = static_cast<int>(maxX);
+    auto& depths = occlusionDepthBuffer.mHiZLevels[0];
+
+    for (auto y = static_cast<int>(minY); y <= static_cast<int>(maxY); ++y)
+    {
+        float rowStartEdgeValues[3];
+        for (auto i = 0U; i < 3U; ++i)
+        {
+            const auto pixelCenterX = startX + 0.5 - edgeStartVertices[i]->mX;
+            const auto pixelCenterY = y + 0.5 - edgeStartVertices[i]->mY;
+            rowStartEdgeValues[i] = static_cast<float>(edgeStepsX[i] * pixelCenterX + edgeStepsY[i] * pixelCenterY);
+        }
+
+        float* rowDepths = &depths[y * OcclusionDepthBuffer::WIDTH];
+        auto x = startX;
+
+#if defined(GENESIS_SSE_OCCLUSION_CULLING)
+        const auto zero = _mm_setzero_ps();
+        const auto pixelOffsets = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+        for (; x <= endX; x += 4)
+        {
+            const auto offsetsX = _mm_add_ps(pixelOffsets, _mm_set1_ps(static_cast<float>(x - startX)));
+            const auto edgeValue0 = _mm_add_ps(_mm_set1_ps(rowStartEdgeValues[0]), _mm_mul_ps(_mm_set1_ps(edgeStepsX[0]), offsetsX));
+            const auto edgeValue1 = _mm_add_ps(_mm_set1_ps(rowStartEdgeValues[1]), _mm_mul_ps(_mm_set1_ps(edgeStepsX[1]), offsetsX));
+            const auto edgeValue2 = _mm_add_ps(_mm_set1_ps(rowStartEdgeValues[2]), _mm_mul_ps(_mm_set1_ps(edgeStepsX[2]), offsetsX));
+
+            const auto insideMask = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(edgeValue0, zero), _mm_cmpge_ps(edgeValue1, zero)), _mm_cmpge_ps(edgeValue2, zero));
+            if (_mm_movemask_ps(insideMask) == 0)
+            {
+                continue;
+            }
+
+            auto depth = _mm_mul_ps(edgeValue0, _mm_set1_ps(depthWeights[0]));
+            depth = _mm_add_ps(depth, _mm_mul_ps(edgeValue1, _mm_set1_ps(depthWeights[1])));
+            depth = _mm_add_ps(depth, _mm_mul_ps(edgeValue2, _mm_set1_ps(depthWeights[2])));
+
+            // Keep the nearest (i.e. greatest reciprocal) depth of the pixels inside the triangle
+            const auto previousDepth = _mm_loadu_ps(rowDepths + x);
+            const auto nearestDepth = _mm_max_ps(previousDepth, depth);
+            _mm_storeu_ps(rowDepths + x, _mm_or_ps(_mm_and_ps(insideMask, nearestDepth), _mm_andnot_ps(insideMask, previousDepth)));
+        }
+#endif
+
+        // Scalar path for the whole row when SSE is unavailable
+        for (; x <= endX; ++x)
+        {
+            const auto offsetX = static_cast<float>(x - startX);
+            const auto edgeValue0 = rowStartEdgeValues[0] + edgeStepsX[0] * offsetX;
+            const auto edgeValue1 = rowStartEdgeValues[1] + edgeStepsX[1] * offsetX;
+            const auto edgeValue2 = rowStartEdgeValues[2] + edgeStepsX[2] * offsetX;
+
+            if (edgeValue0 >= 0.0f && edgeValue1 >= 0.0f && edgeValue2 >= 0.0f)
+            {
+                const auto depth = edgeValue0 * depthWeights[0] + edgeValue1 * depthWeights[1] + edgeValue2 * depthWeights[2];
+                rowDepths[x] = std::max(rowDepths[x], depth);
+            }
+        }
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+bool IsSphereOccluded(const glm::vec3& center, const float radius, const OcclusionDepthBuffer& occlusionDepthBuffer)
+{
+    const auto& viewProjectionMatrix = occlusionDepthBuffer.mViewProjectionMatrix;
+    const auto clipSpaceCenter = viewProjectionMatrix * glm::vec4(center, 1.0f);
+
+    // Spheres reaching the near plane are never occluded
+    const auto nearestDepth = clipSpaceCenter.w - radius;
+    if (nearestDepth <= occlusionDepthBuffer.mNearClipDepth)
+    {
+        return false;
+    }
+
+    // Project the corners of the sphere's bounding box to get conservative screen space bounds
+    const glm::vec4 clipSpaceAxes[3] =
+    {
+        viewProjectionMatrix[0] * radius,
+        viewProjectionMatrix[1] * radius,
+        viewProjectionMatrix[2] * radius
+    };
+
+    auto minNdc = glm::vec2(std::numeric_limits<float>::max());
+    auto maxNdc = glm::vec2(-std::numeric_limits<float>::max());
+    for (auto corner = 0U; corner < 8U; ++corner)
+    {
+        const auto clipSpaceCorner =
+            clipSpaceCenter +
+            ((corner & 0x1) ? clipSpaceAxes[0] : -clipSpaceAxes[0]) +
+            ((corner & 0x2) ? clipSpaceAxes[1] : -clipSpaceAxes[1]) +
+            ((corner & 0x4) ? clipSpaceAxes[2] : -clipSpaceAxes[2]);
+
+        if (clipSpaceCorner.w <= occlusionDepthBuffer.mNearClipDepth)
+        {
+            return false;
+        }
+
+        const auto ndcCorner = glm::vec2(clipSpaceCorner.x, clipSpaceCorner.y)/clipSpaceCorner.w;
+        minNdc = glm::min(minNdc, ndcCorner);
+        maxNdc = glm::max(maxNdc, ndcCorner);
+    }
+
+    const auto minX = (minNdc.x * 0.5f + 0.5f) * OcclusionDepthBuffer::WIDTH;
+    const auto maxX = (maxNdc.x * 0.5f + 0.5f) * OcclusionDepthBuffer::WIDTH;
+    const auto minY = (minNdc.y * 0.5f + 0.5f) * OcclusionDepthBuffer::HEIGHT;
+    const auto maxY = (maxNdc.y * 0.5f + 0.5f) * OcclusionDepthBuffer::HEIGHT;
+    if (maxX < 0.0f || maxY < 0.0f || minX >= OcclusionDepthBuffer::WIDTH || minY >= OcclusionDepthBuffer::HEIGHT)
+    {
+        return false;
+    }
+
+    const auto minCol = std::max(0, static_cast<int>(minX));
+    const auto maxCol = std::min(OcclusionDepthBuffer::WIDTH - 1, static_cast<int>(maxX));
+    const auto minRow = std::max(0, static_cast<int>(minY));
+    const auto maxRow = std::min(OcclusionDepthBuffer::HEIGHT - 1, static_cast<int>(maxY));
+
+    // Find the finest level at which the bounds span at most 2x2 texels
+    const auto& hiZLevels = occlusionDepthBuffer.mHiZLevels;
+    auto level = 0U;
+    while (level + 1 < hiZLevels.size() && ((maxCol >> level) - (minCol >> level) > 1 || (maxRow >> level) - (minRow >> level) > 1))
+    {
+        level++;
+    }
+
+    const auto levelWidth = std::max(1, OcclusionDepthBuffer::WIDTH >> level);
+    const auto levelHeight = std::max(1, OcclusionDepthBuffer::HEIGHT >> level);
+    const auto& levelDepths = hiZLevels[level];
+
+    auto furthestOccluderDepth = std::numeric_limits<float>::max();
+    for (auto row = std::min(minRow >> level, levelHeight - 1); row <= std::min(maxRow >> level, levelHeight - 1); ++row)
+    {
+        for (auto col = std::min(minCol >> level, levelWidth - 1); col <= std::min(maxCol >> level, levelWidth - 1); ++col)
+        {
+            furthestOccluderDepth = std::min(furthestOccluderDepth, levelDepths[row * levelWidth + col]);
+        }
+    }
+
+    return 1.0f/nearestDepth < furthestOccluderDepth;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
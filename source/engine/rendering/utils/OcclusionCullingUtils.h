@@ -0,0 +1,103 @@
+///------------------------------------------------------------------------------------------------
+///  OcclusionCullingUtils.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef OcclusionCullingUtils_h
+#define OcclusionCullingUtils_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "FrustumCullingUtils.h"
+#include "../../common/utils/MathUtils.h"
+
+#include <cstdint>
+#include <vector>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+/// A low resolution, CPU side depth buffer that occluders are rasterised into, along with its
+/// hierarchical depth (Hi-Z) pyramid.
+///
+/// Depths are stored as reciprocal view depths (1/w), which interpolate linearly in screen space
+/// and keep their precision over the camera's whole depth range. Greater values are therefore
+/// nearer to the camera, with 0 standing for no occluder at all.
+struct OcclusionDepthBuffer final
+{
+    static constexpr int WIDTH  = 256;
+    static constexpr int HEIGHT = 128;
+
+    // Level 0 is the full resolution buffer. Each further level halves its dimensions, keeping the
+    // furthest depth of the 2x2 texels below it, down to a single texel
+    std::vector<std::vector<float>> mHiZLevels;
+    
+    // Scratch storage for the clip space vertices of the occluder being rasterised
+    std::vector<glm::vec4> mClipSpaceVertices;
+    
+    glm::mat4 mViewProjectionMatrix = glm::mat4(1.0f);
+    float mNearClipDepth            = 0.0f;
+};
+
+///-----------------------------------------------------------------------------------------------
+/// Clears the given depth buffer (allocating its levels on first use), and sets the camera that
+/// the next occluders will be rasterised from.
+/// @param[in] viewProjectionMatrix the view projection matrix of the camera.
+/// @param[in] nearClipDepth the view depth of the camera's near plane. Occluder parts nearer than it are clipped.
+/// @param[in] occlusionDepthBuffer the depth buffer to clear.
+void ClearOcclusionDepthBuffer(const glm::mat4& viewProjectionMatrix, const float nearClipDepth, OcclusionDepthBuffer& occlusionDepthBuffer);
+
+///-----------------------------------------------------------------------------------------------
+/// Rasterises the triangles of an occluder into level 0 of the given depth buffer, keeping the
+/// nearest depth per pixel. Pixels are processed 4 at a time where SSE is available.
+///
+/// Note: occluders need to lie fully inside the geometry they stand for, as everything behind them
+/// is considered hidden.
+/// @param[in] vertices the occluder's vertices, in model space.
+/// @param[in] indices the vertex indices of the occluder's triangles (3 per triangle).
+/// @param[in] worldMatrix the world matrix of the occluder.
+/// @param[in] occlusionDepthBuffer the depth buffer to rasterise the occluder into.
+void RasterizeOccluder(const std::vector<glm::vec3>& vertices, const std::vector<unsigned int>& indices, const glm::mat4& worldMatrix, OcclusionDepthBuffer& occlusionDepthBuffer);
+
+///-----------------------------------------------------------------------------------------------
+/// Builds the Hi-Z pyramid of the given depth buffer from its level 0. Needs to be called once all
+/// occluders of the frame have been rasterised.
+/// @param[in] occlusionDepthBuffer the depth buffer to build the pyramid of.
+void BuildHiZPyramid(OcclusionDepthBuffer& occlusionDepthBuffer);
+
+///-----------------------------------------------------------------------------------------------
+/// Tests the screen space bounds of the given spheres against the Hi-Z pyramid of the given depth
+/// buffer. Each sphere is tested against the finest pyramid level at which its bounds span at most
+/// 2x2 texels, and is occluded when even its nearest point lies behind the furthest occluder depth
+/// of these texels.
+/// @param[in] cullingSpheres the spheres to test.
+/// @param[in] frustumVisibilityResults the frustum test results of the spheres. Only spheres inside the frustum are tested.
+/// @param[in] occlusionDepthBuffer the depth buffer to test the spheres against, with its pyramid built.
+/// @param[out] occlusionResults receives 0 for each tested sphere that is fully occluded and 1 otherwise.
+void CullSpheresAgainstOcclusionDepthBuffer
+(
+    const CullingSpheres& cullingSpheres,
+    const std::vector<std::uint8_t>& frustumVisibilityResults,
+    const OcclusionDepthBuffer& occlusionDepthBuffer,
+    std::vector<std::uint8_t>& occlusionResults
+);
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* OcclusionCullingUtils_h */
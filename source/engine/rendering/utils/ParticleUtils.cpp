@@ -7,7 +7,6 @@
 
 #include "ParticleUtils.h"
 #include "../components/RenderableComponent.h"
-#include "../opengl/Context.h"
 #include "../../common/components/TransformComponent.h"
 #include "../../resources/ResourceLoadingService.h"
 
@@ -28,32 +27,6 @@ namespace rendering
 namespace
 {
 
-    static const std::vector<std::vector<float>> PARTICLE_VERTEX_POSITIONS =
-    {
-        {
-            0.0f, 0.0f, 0.0f,
-            1.0f, 0.0f, 0.0f,
-            0.0f, 0.0f, 1.0f,
-            1.0f, 0.0f, 1.0f
-        },
-        
-        {
-            0.0f, 0.0f, 0.0f,
-            1.0f, 0.0f, 0.0f,
-            0.0f, 1.0f, 0.0f,
-            1.0f, 1.0f, 0.0f
-        }
-    };
-    
-
-    static const std::vector<float> PARTICLE_UVS =
-    {
-        0.0f, 0.0f,
-        1.0f, 0.0f,
-        0.0f, 1.0f,
-        1.0f, 1.0f
-    };
-
     static const tsl::robin_map<ParticleEmitterType, StringId> PARTICLE_TYPE_TO_SHADER_NAME =
     {
         { ParticleEmitterType::SMOKE, StringId("particle_smoke") },
@@ -67,13 +40,6 @@ namespace
         { ParticleEmitterType::BLOOD_DROP, StringId("blood_drop") },
         { ParticleEmitterType::SMOKE_REVEAL, StringId("smoke") }
     };
-
-    static const tsl::robin_map<ParticleEmitterType, size_t> PARTICLE_TYPE_TO_VERTEX_POSITIONS =
-    {
-        { ParticleEmitterType::SMOKE, 0U },
-        { ParticleEmitterType::BLOOD_DROP, 0U },
-        { ParticleEmitterType::SMOKE_REVEAL, 1U }
-    };
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -168,32 +134,6 @@ genesis::ecs::EntityId AddParticleEmitter
         }
     }
  
-    GL_CHECK(glGenVertexArrays(1, &emitterComponent->mParticleVertexArrayObject));
-    GL_CHECK(glGenBuffers(1, &emitterComponent->mParticleVertexBuffer));
-    GL_CHECK(glGenBuffers(1, &emitterComponent->mParticleUVBuffer));
-    GL_CHECK(glGenBuffers(1, &emitterComponent->mParticlePositionsBuffer));
-    GL_CHECK(glGenBuffers(1, &emitterComponent->mParticleLifetimesBuffer));
-    GL_CHECK(glGenBuffers(1, &emitterComponent->mParticleSizesBuffer));
-    
-    GL_CHECK(glBindVertexArray(emitterComponent->mParticleVertexArrayObject));
-    
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, emitterComponent->mParticleVertexBuffer));
-    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, PARTICLE_VERTEX_POSITIONS[PARTICLE_TYPE_TO_VERTEX_POSITIONS.at(emitterType)].size() * sizeof(float) , PARTICLE_VERTEX_POSITIONS[PARTICLE_TYPE_TO_VERTEX_POSITIONS.at(emitterType)].data(), GL_STATIC_DRAW));
-    
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, emitterComponent->mParticleUVBuffer));
-    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, PARTICLE_UVS.size() * sizeof(float) , PARTICLE_UVS.data(), GL_STATIC_DRAW));
-
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, emitterComponent->mParticlePositionsBuffer));
-    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, particleCount * sizeof(glm::vec3), emitterComponent->mParticlePositions.data(), GL_DYNAMIC_DRAW));
-    
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, emitterComponent->mParticleLifetimesBuffer));
-    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, particleCount * sizeof(float), emitterComponent->mParticleLifetimes.data(), GL_DYNAMIC_DRAW));
-    
-    GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, emitterComponent->mParticleSizesBuffer));
-    GL_CHECK(glBufferData(GL_ARRAY_BUFFER, particleCount * sizeof(float), emitterComponent->mParticleSizes.data(), GL_DYNAMIC_DRAW));
-    
-    GL_CHECK(glBindVertexArray(emitterComponent->mParticleVertexArrayObject));
-    
     auto entity = parentEntityIdToAttachTo;
     if (entity == genesis::ecs::NULL_ENTITY_ID)
     {
@@ -0,0 +1,147 @@
+///------------------------------------------------------------------------------------------------
+///  RenderQueueUtils.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "RenderQueueUtils.h"
+#include "../components/RenderableComponent.h"
+#include "../../common/components/TransformComponent.h"
+
+#include <array>
+#include <cstring> // memcpy
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const int LAYER_BITS        = 2;
+    static const int TRANSLUCENCY_BITS = 1;
+    static const int DEPTH_BUCKET_BITS = 24;
+    static const int SHADER_BITS       = 12;
+    static const int TEXTURE_BITS      = 12;
+    static const int MESH_BITS         = 13;
+    
+    static const int RADIX_BITS        = 8;
+    static const int RADIX_BUCKET_COUNT = 1 << RADIX_BITS;
+    static const int RADIX_PASS_COUNT  = 64 / RADIX_BITS;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+static std::uint64_t CalculateDepthBucket(const float depth);
+static std::uint64_t CalculateDrawStateBits(const RenderableComponent& renderableComponent);
+
+///-----------------------------------------------------------------------------------------------
+
+std::uint64_t CalculateRenderQueueSortKey(const TransformComponent& transformComponent, const RenderableComponent& renderableComponent)
+{
+    static_assert(LAYER_BITS + TRANSLUCENCY_BITS + DEPTH_BUCKET_BITS + SHADER_BITS + TEXTURE_BITS + MESH_BITS == 64, "Sort key bits need to add up to 64");
+    
+    const auto layer = static_cast<std::uint64_t>(renderableComponent.mRenderableType);
+    const auto isTranslucent = renderableComponent.mRenderableType != RenderableType::NORMAL_MODEL;
+    const auto depthBucket = CalculateDepthBucket(transformComponent.mPosition.z);
+    const auto drawStateBits = CalculateDrawStateBits(renderableComponent);
+    
+    auto sortKey = layer << (64 - LAYER_BITS);
+    if (isTranslucent)
+    {
+        sortKey |= std::uint64_t(1) << (64 - LAYER_BITS - TRANSLUCENCY_BITS);
+        sortKey |= depthBucket << (SHADER_BITS + TEXTURE_BITS + MESH_BITS);
+        sortKey |= drawStateBits;
+    }
+    else
+    {
+        sortKey |= drawStateBits << DEPTH_BUCKET_BITS;
+        sortKey |= depthBucket;
+    }
+    
+    return sortKey;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void SortRenderQueue(std::vector<RenderQueueItem>& renderQueue, std::vector<RenderQueueItem>& scratchRenderQueue)
+{
+    // Histograms of all passes are gathered in a single sweep
+    std::array<std::array<std::size_t, RADIX_BUCKET_COUNT>, RADIX_PASS_COUNT> bucketCounts = {};
+    for (const auto& renderQueueItem: renderQueue)
+    {
+        for (auto pass = 0; pass < RADIX_PASS_COUNT; ++pass)
+        {
+            bucketCounts[pass][(renderQueueItem.mSortKey >> (pass * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1)]++;
+        }
+    }
+    
+    scratchRenderQueue.resize(renderQueue.size());
+    for (auto pass = 0; pass < RADIX_PASS_COUNT; ++pass)
+    {
+        auto& passBucketCounts = bucketCounts[pass];
+        
+        // All keys share this byte (e.g. unused layers or equal draw state), so the pass would not reorder anything
+        if (renderQueue.empty() || passBucketCounts[(renderQueue.front().mSortKey >> (pass * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1)] == renderQueue.size())
+        {
+            continue;
+        }
+        
+        auto bucketOffset = std::size_t(0);
+        for (auto& bucketCount: passBucketCounts)
+        {
+            const auto count = bucketCount;
+            bucketCount = bucketOffset;
+            bucketOffset += count;
+        }
+        
+        for (const auto& renderQueueItem: renderQueue)
+        {
+            scratchRenderQueue[passBucketCounts[(renderQueueItem.mSortKey >> (pass * RADIX_BITS)) & (RADIX_BUCKET_COUNT - 1)]++] = renderQueueItem;
+        }
+        
+        renderQueue.swap(scratchRenderQueue);
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+std::uint64_t CalculateDepthBucket(const float depth)
+{
+    // Maps the float's bits to an unsigned integer of the same ordering, keeping the most significant ones
+    std::uint32_t depthBits;
+    std::memcpy(&depthBits, &depth, sizeof(float));
+    depthBits = (depthBits & 0x80000000U) ? ~depthBits : (depthBits | 0x80000000U);
+    
+    // Inverted so that entities further along z come first, same as the previous depth sorting
+    const auto depthBucket = static_cast<std::uint64_t>(depthBits >> (32 - DEPTH_BUCKET_BITS));
+    return ((std::uint64_t(1) << DEPTH_BUCKET_BITS) - 1) - depthBucket;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+std::uint64_t CalculateDrawStateBits(const RenderableComponent& renderableComponent)
+{
+    // Only the low bits of the shader and resource ids are kept. Colliding ids merely interleave their draws
+    const auto shaderBits = static_cast<std::uint64_t>(renderableComponent.mShaderNameId.GetStringId()) & ((std::uint64_t(1) << SHADER_BITS) - 1);
+    const auto textureBits = static_cast<std::uint64_t>(renderableComponent.mTextureResourceId) & ((std::uint64_t(1) << TEXTURE_BITS) - 1);
+    const auto meshBits = renderableComponent.mMeshResourceIds.empty() ? std::uint64_t(0) : static_cast<std::uint64_t>(renderableComponent.mMeshResourceIds[renderableComponent.mCurrentMeshResourceIndex]) & ((std::uint64_t(1) << MESH_BITS) - 1);
+    
+    return (shaderBits << (TEXTURE_BITS + MESH_BITS)) | (textureBits << MESH_BITS) | meshBits;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
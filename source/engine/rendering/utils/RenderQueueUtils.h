@@ -0,0 +1,71 @@
+///------------------------------------------------------------------------------------------------
+///  RenderQueueUtils.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef RenderQueueUtils_h
+#define RenderQueueUtils_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../ECS.h"
+
+#include <cstdint>
+#include <vector>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+class TransformComponent;
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+class RenderableComponent;
+
+///-----------------------------------------------------------------------------------------------
+/// An entity to be rendered this frame, along with the key that orders it in the render queue.
+struct RenderQueueItem final
+{
+    std::uint64_t mSortKey;
+    ecs::EntityId mEntityId;
+};
+
+///-----------------------------------------------------------------------------------------------
+/// Packs the draw state of an entity into a 64-bit render queue sort key.
+///
+/// The most significant bits hold the renderable type layer, followed by a translucency bit.
+/// Opaque (NORMAL_MODEL) entities are then ordered by shader, texture and mesh to minimize state
+/// changes, with their depth bucket last. Translucent (GUI and text) entities have their depth bucket
+/// ahead of their draw state instead, so that they keep being drawn back-to-front.
+/// @param[in] transformComponent the transform component of the entity.
+/// @param[in] renderableComponent the renderable component of the entity.
+/// @returns the calculated sort key.
+std::uint64_t CalculateRenderQueueSortKey(const TransformComponent& transformComponent, const RenderableComponent& renderableComponent);
+
+///-----------------------------------------------------------------------------------------------
+/// Sorts the given render queue by ascending sort key with an LSD radix sort. The sort is stable,
+/// and byte passes over which all keys agree are skipped.
+/// @param[in] renderQueue the render queue to sort.
+/// @param[in] scratchRenderQueue scratch storage for the sort, kept around to avoid per frame allocations.
+void SortRenderQueue(std::vector<RenderQueueItem>& renderQueue, std::vector<RenderQueueItem>& scratchRenderQueue);
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* RenderQueueUtils_h */
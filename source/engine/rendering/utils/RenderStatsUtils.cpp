@@ -0,0 +1,169 @@
+///------------------------------------------------------------------------------------------------
+///  RenderStatsUtils.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "RenderStatsUtils.h"
+#include "../../common/utils/Logging.h"
+
+#include <fstream>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const std::array<std::string, static_cast<std::size_t>(RenderPass::COUNT)> RENDER_PASS_NAMES =
+    {
+        "Depth",
+        "Final",
+        "Particles",
+        "Text"
+    };
+
+    static const std::string CSV_HEADER = "frame,pass,draw_calls,primitives,program_switches,texture_binds,uploaded_buffer_bytes,visible_entities,culled_entities,occluded_entities";
+}
+
+///-----------------------------------------------------------------------------------------------
+
+static void WriteRenderStatsCsvFile(const RenderStatsSingletonComponent& renderStatsComponent);
+
+///-----------------------------------------------------------------------------------------------
+
+const std::string& GetRenderPassName(const RenderPass renderPass)
+{
+    return RENDER_PASS_NAMES[static_cast<std::size_t>(renderPass)];
+}
+
+///-----------------------------------------------------------------------------------------------
+
+RenderPassStats& GetRenderPassStats(RenderStatsSingletonComponent& renderStatsComponent, const RenderPass renderPass)
+{
+    return renderStatsComponent.mCurrentFrameStats[static_cast<std::size_t>(renderPass)];
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void BeginRenderStatsFrame(RenderStatsSingletonComponent& renderStatsComponent, const GLStateCache& glStateCache)
+{
+    renderStatsComponent.mCurrentFrameStats = RenderFrameStats();
+    renderStatsComponent.mActivePass = RenderPass::FINAL;
+    renderStatsComponent.mActivePassStartGLStateCacheStats = glStateCache.GetCurrentFrameStats();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void EndRenderStatsFrame(RenderStatsSingletonComponent& renderStatsComponent, const GLStateCache& glStateCache)
+{
+    // Attribute the state changes of the still active pass
+    SetActiveRenderPass(renderStatsComponent, glStateCache, renderStatsComponent.mActivePass);
+    renderStatsComponent.mLastFrameStats = renderStatsComponent.mCurrentFrameStats;
+
+    if (renderStatsComponent.mCsvRequestedFrameCount > 0)
+    {
+        renderStatsComponent.mCsvCapturedFrames.push_back(renderStatsComponent.mCurrentFrameStats);
+        if (static_cast<int>(renderStatsComponent.mCsvCapturedFrames.size()) == renderStatsComponent.mCsvRequestedFrameCount)
+        {
+            WriteRenderStatsCsvFile(renderStatsComponent);
+            renderStatsComponent.mCsvCapturedFrames.clear();
+            renderStatsComponent.mCsvRequestedFrameCount = 0;
+        }
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void SetActiveRenderPass(RenderStatsSingletonComponent& renderStatsComponent, const GLStateCache& glStateCache, const RenderPass renderPass)
+{
+    const auto& glStateCacheStats = glStateCache.GetCurrentFrameStats();
+    auto& activePassStats = GetRenderPassStats(renderStatsComponent, renderStatsComponent.mActivePass);
+    activePassStats.mProgramSwitchCount += glStateCacheStats.mProgramSwitchCount - renderStatsComponent.mActivePassStartGLStateCacheStats.mProgramSwitchCount;
+    activePassStats.mTextureBindCount   += glStateCacheStats.mTextureBindCount - renderStatsComponent.mActivePassStartGLStateCacheStats.mTextureBindCount;
+
+    renderStatsComponent.mActivePass = renderPass;
+    renderStatsComponent.mActivePassStartGLStateCacheStats = glStateCacheStats;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void RecordDrawCall(RenderPassStats& renderPassStats, const std::size_t primitiveCount)
+{
+    renderPassStats.mDrawCallCount++;
+    renderPassStats.mPrimitiveCount += primitiveCount;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void CaptureRenderStatsToCsv(RenderStatsSingletonComponent& renderStatsComponent, const int frameCount, const std::string& csvFilePath)
+{
+    assert(frameCount > 0 && "Render stats need to be captured for at least one frame");
+
+    renderStatsComponent.mCsvCapturedFrames.clear();
+    renderStatsComponent.mCsvCapturedFrames.reserve(frameCount);
+    renderStatsComponent.mCsvFilePath = csvFilePath;
+    renderStatsComponent.mCsvRequestedFrameCount = frameCount;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+std::string GetRenderPassStatsSummary(const RenderPassStats& renderPassStats)
+{
+    return
+        std::to_string(renderPassStats.mDrawCallCount) + " draws, " +
+        std::to_string(renderPassStats.mPrimitiveCount) + " prims, " +
+        std::to_string(renderPassStats.mProgramSwitchCount) + " programs, " +
+        std::to_string(renderPassStats.mTextureBindCount) + " textures, " +
+        std::to_string(renderPassStats.mUploadedBufferBytes / 1024) + " KB uploaded, " +
+        std::to_string(renderPassStats.mVisibleEntityCount) + " visible, " +
+        std::to_string(renderPassStats.mCulledEntityCount) + " culled, " +
+        std::to_string(renderPassStats.mOccludedEntityCount) + " occluded";
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void WriteRenderStatsCsvFile(const RenderStatsSingletonComponent& renderStatsComponent)
+{
+    std::ofstream csvFile(renderStatsComponent.mCsvFilePath);
+    if (!csvFile)
+    {
+        Log(LogType::ERROR, "Could not write render stats to %s", renderStatsComponent.mCsvFilePath.c_str());
+        return;
+    }
+
+    csvFile << CSV_HEADER << '\n';
+    for (auto frameIndex = 0U; frameIndex < renderStatsComponent.mCsvCapturedFrames.size(); ++frameIndex)
+    {
+        const auto& frameStats = renderStatsComponent.mCsvCapturedFrames[frameIndex];
+        for (auto passIndex = 0U; passIndex < frameStats.size(); ++passIndex)
+        {
+            const auto& passStats = frameStats[passIndex];
+            csvFile << frameIndex << ',' << RENDER_PASS_NAMES[passIndex] << ','
+                << passStats.mDrawCallCount << ',' << passStats.mPrimitiveCount << ','
+                << passStats.mProgramSwitchCount << ',' << passStats.mTextureBindCount << ','
+                << passStats.mUploadedBufferBytes << ','
+                << passStats.mVisibleEntityCount << ',' << passStats.mCulledEntityCount << ','
+                << passStats.mOccludedEntityCount << '\n';
+        }
+    }
+
+    Log(LogType::INFO, "Render stats of %d frames written to %s", static_cast<int>(renderStatsComponent.mCsvCapturedFrames.size()), renderStatsComponent.mCsvFilePath.c_str());
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
@@ -0,0 +1,112 @@
+///------------------------------------------------------------------------------------------------
+///  RenderStatsUtils.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef RenderStatsUtils_h
+#define RenderStatsUtils_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../components/RenderStatsSingletonComponent.h"
+
+#include <string>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+/// @param[in] renderPass the render pass to get the name of.
+/// @returns the display name of the given render pass.
+const std::string& GetRenderPassName(const RenderPass renderPass);
+
+///-----------------------------------------------------------------------------------------------
+/// @param[in] renderStatsComponent the render stats singleton component.
+/// @param[in] renderPass the render pass to get the stats of.
+/// @returns the stats accumulated by the given render pass in the current frame so far.
+RenderPassStats& GetRenderPassStats(RenderStatsSingletonComponent& renderStatsComponent, const RenderPass renderPass);
+
+///-----------------------------------------------------------------------------------------------
+/// Resets the current frame's stats, and makes the final pass the active one.
+/// @param[in] renderStatsComponent the render stats singleton component.
+/// @param[in] glStateCache the state cache the frame's GL state changes go through. Needs to have begun its frame already.
+void BeginRenderStatsFrame(RenderStatsSingletonComponent& renderStatsComponent, const GLStateCache& glStateCache);
+
+///-----------------------------------------------------------------------------------------------
+/// Publishes the current frame's stats as the last frame's ones, and logs them to an in progress
+/// CSV capture (writing the CSV file once all requested frames have been captured).
+/// @param[in] renderStatsComponent the render stats singleton component.
+/// @param[in] glStateCache the state cache the frame's GL state changes went through.
+void EndRenderStatsFrame(RenderStatsSingletonComponent& renderStatsComponent, const GLStateCache& glStateCache);
+
+///-----------------------------------------------------------------------------------------------
+/// Attributes the program switches and texture binds made since the active pass became active to it,
+/// and makes the given pass the active one.
+/// @param[in] renderStatsComponent the render stats singleton component.
+/// @param[in] glStateCache the state cache the frame's GL state changes go through.
+/// @param[in] renderPass the pass to make active.
+void SetActiveRenderPass(RenderStatsSingletonComponent& renderStatsComponent, const GLStateCache& glStateCache, const RenderPass renderPass);
+
+///-----------------------------------------------------------------------------------------------
+/// Records a single draw call of the given number of primitives.
+/// @param[in] renderPassStats the stats of the pass that issued the draw call.
+/// @param[in] primitiveCount the number of primitives (across all instances) drawn.
+void RecordDrawCall(RenderPassStats& renderPassStats, const std::size_t primitiveCount);
+
+///-----------------------------------------------------------------------------------------------
+/// Starts logging the stats of the given number of frames, to be written as a CSV file once done.
+/// @param[in] renderStatsComponent the render stats singleton component.
+/// @param[in] frameCount the number of frames to log.
+/// @param[in] csvFilePath the path of the CSV file to write.
+void CaptureRenderStatsToCsv(RenderStatsSingletonComponent& renderStatsComponent, const int frameCount, const std::string& csvFilePath);
+
+///-----------------------------------------------------------------------------------------------
+/// @param[in] renderPassStats the stats of a render pass.
+/// @returns a single line, human readable summary of the given stats.
+std::string GetRenderPassStatsSummary(const RenderPassStats& renderPassStats);
+
+///-----------------------------------------------------------------------------------------------
+/// Makes a pass the active one for the lifetime of its scope, restoring the previously active pass afterwards.
+class RenderPassStatsScope final
+{
+public:
+    RenderPassStatsScope(RenderStatsSingletonComponent& renderStatsComponent, const GLStateCache& glStateCache, const RenderPass renderPass)
+        : mRenderStatsComponent(renderStatsComponent)
+        , mGLStateCache(glStateCache)
+        , mPreviousRenderPass(renderStatsComponent.mActivePass)
+    {
+        SetActiveRenderPass(mRenderStatsComponent, mGLStateCache, renderPass);
+    }
+
+    ~RenderPassStatsScope()
+    {
+        SetActiveRenderPass(mRenderStatsComponent, mGLStateCache, mPreviousRenderPass);
+    }
+
+    RenderPassStatsScope(const RenderPassStatsScope&) = delete;
+    const RenderPassStatsScope& operator = (const RenderPassStatsScope&) = delete;
+
+private:
+    RenderStatsSingletonComponent& mRenderStatsComponent;
+    const GLStateCache& mGLStateCache;
+    const RenderPass mPreviousRenderPass;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* RenderStatsUtils_h */
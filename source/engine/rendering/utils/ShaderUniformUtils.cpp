@@ -0,0 +1,204 @@
+///------------------------------------------------------------------------------------------------
+///  ShaderUniformUtils.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "ShaderUniformUtils.h"
+
+#include <algorithm> // find_if
+#include <cstring>   // memcpy
+#include <mutex>
+#include <tsl/robin_map.h>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+static std::size_t GetUniformTypeSize(const UniformType uniformType);
+
+///-----------------------------------------------------------------------------------------------
+
+void ShaderUniforms::SetMatrix(const UniformSlot uniformSlot, const glm::mat4& value)
+{
+    SetValues(uniformSlot, UniformType::MATRIX, &value, 1);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ShaderUniforms::SetMatrixArray(const UniformSlot uniformSlot, const std::vector<glm::mat4>& values)
+{
+    SetValues(uniformSlot, UniformType::MATRIX, values.data(), values.size());
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ShaderUniforms::SetFloatVec4(const UniformSlot uniformSlot, const glm::vec4& value)
+{
+    SetValues(uniformSlot, UniformType::FLOAT_VEC4, &value, 1);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ShaderUniforms::SetFloatVec4Array(const UniformSlot uniformSlot, const std::vector<glm::vec4>& values)
+{
+    SetValues(uniformSlot, UniformType::FLOAT_VEC4, values.data(), values.size());
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ShaderUniforms::SetFloatVec3(const UniformSlot uniformSlot, const glm::vec3& value)
+{
+    SetValues(uniformSlot, UniformType::FLOAT_VEC3, &value, 1);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ShaderUniforms::SetFloatVec3Array(const UniformSlot uniformSlot, const std::vector<glm::vec3>& values)
+{
+    SetValues(uniformSlot, UniformType::FLOAT_VEC3, values.data(), values.size());
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ShaderUniforms::SetFloat(const UniformSlot uniformSlot, const float value)
+{
+    SetValues(uniformSlot, UniformType::FLOAT, &value, 1);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ShaderUniforms::SetInt(const UniformSlot uniformSlot, const int value)
+{
+    const auto intValue = static_cast<std::int32_t>(value);
+    SetValues(uniformSlot, UniformType::INT, &intValue, 1);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ShaderUniforms::SetBool(const UniformSlot uniformSlot, const bool value)
+{
+    // Bools are uploaded as ints
+    const auto intValue = static_cast<std::int32_t>(value ? 1 : 0);
+    SetValues(uniformSlot, UniformType::BOOL, &intValue, 1);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+bool ShaderUniforms::IsEmpty() const
+{
+    return mEntries.empty();
+}
+
+///-----------------------------------------------------------------------------------------------
+
+const std::vector<ShaderUniformEntry>& ShaderUniforms::GetEntries() const
+{
+    return mEntries;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+const std::uint8_t* ShaderUniforms::GetEntryValues(const ShaderUniformEntry& entry) const
+{
+    return mValues.data() + entry.mByteOffset;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void ShaderUniforms::SetValues(const UniformSlot uniformSlot, const UniformType uniformType, const void* values, const std::size_t count)
+{
+    const auto byteCount = GetUniformTypeSize(uniformType) * count;
+    
+    // Blocks hold a handful of uniforms, so a linear scan beats any lookup structure here
+    auto entryIter = std::find_if(mEntries.begin(), mEntries.end(), [uniformSlot](const ShaderUniformEntry& entry)
+    {
+        return entry.mSlot == uniformSlot;
+    });
+    
+    if (entryIter != mEntries.end())
+    {
+        // Same layout, so values are overwritten in place. This is the common per frame path
+        if (entryIter->mType == uniformType && entryIter->mCount == count)
+        {
+            std::memcpy(mValues.data() + entryIter->mByteOffset, values, byteCount);
+            return;
+        }
+        
+        // Otherwise the old values are removed and the entry is re-added at the end of the block
+        const auto removedByteOffset = entryIter->mByteOffset;
+        const auto removedByteCount  = GetUniformTypeSize(entryIter->mType) * entryIter->mCount;
+        mValues.erase(mValues.begin() + removedByteOffset, mValues.begin() + removedByteOffset + removedByteCount);
+        mEntries.erase(entryIter);
+        
+        for (auto& entry: mEntries)
+        {
+            if (entry.mByteOffset > removedByteOffset)
+            {
+                entry.mByteOffset -= static_cast<std::uint32_t>(removedByteCount);
+            }
+        }
+    }
+    
+    ShaderUniformEntry entry;
+    entry.mSlot       = uniformSlot;
+    entry.mType       = uniformType;
+    entry.mCount      = static_cast<std::uint32_t>(count);
+    entry.mByteOffset = static_cast<std::uint32_t>(mValues.size());
+    
+    mValues.resize(mValues.size() + byteCount);
+    if (byteCount > 0)
+    {
+        std::memcpy(mValues.data() + entry.mByteOffset, values, byteCount);
+    }
+    
+    mEntries.push_back(entry);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+UniformSlot GetUniformSlot(const StringId& uniformName)
+{
+    // Names are only resolved at shader link time and when caching uniform slot constants,
+    // never per draw, so a single lock is enough
+    static std::mutex uniformSlotsMutex;
+    static tsl::robin_map<StringId, UniformSlot, StringIdHasher> uniformNamesToSlots;
+    
+    std::lock_guard<std::mutex> uniformSlotsLock(uniformSlotsMutex);
+    const auto insertionResult = uniformNamesToSlots.insert(std::make_pair(uniformName, static_cast<UniformSlot>(uniformNamesToSlots.size())));
+    return insertionResult.first->second;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+std::size_t GetUniformTypeSize(const UniformType uniformType)
+{
+    switch (uniformType)
+    {
+        case UniformType::MATRIX:     return sizeof(glm::mat4);
+        case UniformType::FLOAT_VEC4: return sizeof(glm::vec4);
+        case UniformType::FLOAT_VEC3: return sizeof(glm::vec3);
+        case UniformType::FLOAT:      return sizeof(float);
+        case UniformType::INT:        return sizeof(std::int32_t);
+        case UniformType::BOOL:       return sizeof(std::int32_t);
+    }
+    
+    return 0;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
@@ -0,0 +1,100 @@
+///------------------------------------------------------------------------------------------------
+///  ShaderUniformUtils.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef ShaderUniformUtils_h
+#define ShaderUniformUtils_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../common/utils/MathUtils.h"
+#include "../../common/utils/StringUtils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+/// Process wide integer handle of a uniform name. Shaders resolve the location of each of their
+/// uniforms per slot when linked, so that uniforms can be set and uploaded without hashing names.
+using UniformSlot = std::uint32_t;
+
+///-----------------------------------------------------------------------------------------------
+
+enum class UniformType : std::uint8_t
+{
+    MATRIX,
+    FLOAT_VEC4,
+    FLOAT_VEC3,
+    FLOAT,
+    INT,
+    BOOL
+};
+
+///-----------------------------------------------------------------------------------------------
+/// A single (possibly array) uniform value stored in a ShaderUniforms block.
+struct ShaderUniformEntry final
+{
+    UniformSlot mSlot;
+    UniformType mType;
+    std::uint32_t mCount;
+    std::uint32_t mByteOffset;
+};
+
+///-----------------------------------------------------------------------------------------------
+/// A compact block of typed uniform values. All values live in a single flat byte buffer, described
+/// by a small table of entries that can be walked in order when uploading them to a shader.
+class ShaderUniforms final
+{
+public:
+    void SetMatrix(const UniformSlot uniformSlot, const glm::mat4& value);
+    void SetMatrixArray(const UniformSlot uniformSlot, const std::vector<glm::mat4>& values);
+    void SetFloatVec4(const UniformSlot uniformSlot, const glm::vec4& value);
+    void SetFloatVec4Array(const UniformSlot uniformSlot, const std::vector<glm::vec4>& values);
+    void SetFloatVec3(const UniformSlot uniformSlot, const glm::vec3& value);
+    void SetFloatVec3Array(const UniformSlot uniformSlot, const std::vector<glm::vec3>& values);
+    void SetFloat(const UniformSlot uniformSlot, const float value);
+    void SetInt(const UniformSlot uniformSlot, const int value);
+    void SetBool(const UniformSlot uniformSlot, const bool value);
+    
+    bool IsEmpty() const;
+    const std::vector<ShaderUniformEntry>& GetEntries() const;
+    const std::uint8_t* GetEntryValues(const ShaderUniformEntry& entry) const;
+
+private:
+    void SetValues(const UniformSlot uniformSlot, const UniformType uniformType, const void* values, const std::size_t count);
+    
+private:
+    std::vector<ShaderUniformEntry> mEntries;
+    std::vector<std::uint8_t> mValues;
+};
+
+///-----------------------------------------------------------------------------------------------
+/// Gets the slot of the given uniform name, assigning a new one the first time a name is seen.
+/// Array uniforms are assigned a single slot under their name without the subscript.
+/// @param[in] uniformName the name of the uniform.
+/// @returns the slot of the uniform.
+UniformSlot GetUniformSlot(const StringId& uniformName);
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* ShaderUniformUtils_h */
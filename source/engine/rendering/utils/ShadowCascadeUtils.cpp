@@ -0,0 +1,145 @@
+///------------------------------------------------------------------------------------------------
+///  ShadowCascadeUtils.cpp
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "ShadowCascadeUtils.h"
+#include "CameraUtils.h"
+#include "../components/CameraSingletonComponent.h"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace
+{
+    // 0 yields uniform splits and 1 logarithmic ones
+    static const float SHADOW_CASCADE_LOGARITHMIC_SPLIT_WEIGHT = 0.75f;
+    
+    // Extends each light projection towards the light, so that casters outside of a slice can still shade it
+    static const float SHADOW_CASCADE_CASTER_EXTRUSION = 2.0f;
+    
+    // Slice radii are rounded up to this granularity, to keep them stable against floating point noise
+    static const float SHADOW_CASCADE_RADIUS_GRANULARITY = 1.0f/64.0f;
+}
+
+///-----------------------------------------------------------------------------------------------
+
+static void FitShadowCascadeToFrustumSlice
+(
+    const glm::mat4& sliceInverseViewProjectionMatrix,
+    const glm::mat4& lightRotationMatrix,
+    ShadowCascade& shadowCascade
+);
+
+///-----------------------------------------------------------------------------------------------
+
+void UpdateShadowCascades
+(
+    const CameraSingletonComponent& cameraComponent,
+    const float renderableWidth,
+    const float renderableHeight,
+    const glm::vec3& lightPosition,
+    const float shadowDistance,
+    std::vector<ShadowCascade>& shadowCascades
+)
+{
+    assert(!shadowCascades.empty() && shadowCascades.size() <= MAX_SHADOW_CASCADE_COUNT && "Invalid shadow cascade count");
+    
+    // Orientation of the light looking at the origin, without any translation
+    const auto lightDirection = glm::normalize(-lightPosition);
+    const auto lightUpVector = math::Abs(glm::dot(lightDirection, math::Y_AXIS)) > 0.99f ? math::Z_AXIS : math::Y_AXIS;
+    const auto lightRotationMatrix = glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), lightDirection, lightUpVector);
+    
+    const auto zNear = cameraComponent.mZNear;
+    const auto zFar  = math::Min(cameraComponent.mZFar, shadowDistance);
+    const auto cascadeCount = static_cast<float>(shadowCascades.size());
+    
+    auto sliceNear = zNear;
+    for (auto i = 0U; i < shadowCascades.size(); ++i)
+    {
+        const auto splitProportion = (i + 1) / cascadeCount;
+        const auto logarithmicSplit = zNear * std::pow(zFar/zNear, splitProportion);
+        const auto uniformSplit = zNear + (zFar - zNear) * splitProportion;
+        const auto sliceFar = math::Lerp(uniformSplit, logarithmicSplit, SHADOW_CASCADE_LOGARITHMIC_SPLIT_WEIGHT);
+        
+        const auto sliceProjectionMatrix = glm::perspectiveFovLH(cameraComponent.mFieldOfView, renderableWidth, renderableHeight, sliceNear, sliceFar);
+        FitShadowCascadeToFrustumSlice(glm::inverse(sliceProjectionMatrix * cameraComponent.mViewMatrix), lightRotationMatrix, shadowCascades[i]);
+        
+        shadowCascades[i].mSplitDepth = sliceFar;
+        sliceNear = sliceFar;
+    }
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void FitShadowCascadeToFrustumSlice
+(
+    const glm::mat4& sliceInverseViewProjectionMatrix,
+    const glm::mat4& lightRotationMatrix,
+    ShadowCascade& shadowCascade
+)
+{
+    // Unproject the corners of the slice to world space
+    std::array<glm::vec3, 8> sliceCorners;
+    auto sliceCenter = glm::vec3(0.0f, 0.0f, 0.0f);
+    for (auto i = 0U; i < sliceCorners.size(); ++i)
+    {
+        const auto ndcCorner = glm::vec4((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, (i & 4) ? 1.0f : -1.0f, 1.0f);
+        const auto worldCorner = sliceInverseViewProjectionMatrix * ndcCorner;
+        sliceCorners[i] = glm::vec3(worldCorner) / worldCorner.w;
+        sliceCenter += sliceCorners[i];
+    }
+    sliceCenter /= static_cast<float>(sliceCorners.size());
+    
+    // The bounding sphere of the slice doesn't change size as the camera rotates
+    auto sliceRadius = 0.0f;
+    for (const auto& sliceCorner: sliceCorners)
+    {
+        sliceRadius = math::Max(sliceRadius, glm::length(sliceCorner - sliceCenter));
+    }
+    sliceRadius = std::ceil(sliceRadius / SHADOW_CASCADE_RADIUS_GRANULARITY) * SHADOW_CASCADE_RADIUS_GRANULARITY;
+    
+    // Snap the slice center, in light space, to whole texels of the cascade's depth map
+    const auto texelWorldSize = 2.0f * sliceRadius / shadowCascade.mResolution;
+    auto lightSpaceSliceCenter = glm::vec3(lightRotationMatrix * glm::vec4(sliceCenter, 1.0f));
+    lightSpaceSliceCenter.x = std::floor(lightSpaceSliceCenter.x / texelWorldSize) * texelWorldSize;
+    lightSpaceSliceCenter.y = std::floor(lightSpaceSliceCenter.y / texelWorldSize) * texelWorldSize;
+    
+    // The light looks down its negative z axis, hence the negated depths
+    const auto lightProjectionMatrix = glm::ortho
+    (
+        lightSpaceSliceCenter.x - sliceRadius,
+        lightSpaceSliceCenter.x + sliceRadius,
+        lightSpaceSliceCenter.y - sliceRadius,
+        lightSpaceSliceCenter.y + sliceRadius,
+        -lightSpaceSliceCenter.z - sliceRadius - SHADOW_CASCADE_CASTER_EXTRUSION,
+        -lightSpaceSliceCenter.z + sliceRadius
+    );
+    
+    shadowCascade.mTexelWorldSize   = texelWorldSize;
+    shadowCascade.mLightSpaceMatrix = lightProjectionMatrix * lightRotationMatrix;
+    shadowCascade.mLightFrustum     = CalculateCameraFrustum(lightRotationMatrix, lightProjectionMatrix);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
@@ -0,0 +1,89 @@
+///------------------------------------------------------------------------------------------------
+///  ShadowCascadeUtils.h
+///  Genesis
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef ShadowCascadeUtils_h
+#define ShadowCascadeUtils_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../common/utils/MathUtils.h"
+
+#include <cstddef>
+#include <vector>
+
+///-----------------------------------------------------------------------------------------------
+
+namespace genesis
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace rendering
+{
+
+///-----------------------------------------------------------------------------------------------
+
+class CameraSingletonComponent;
+
+///-----------------------------------------------------------------------------------------------
+
+using GLuint = unsigned int;
+
+///-----------------------------------------------------------------------------------------------
+
+static constexpr std::size_t MAX_SHADOW_CASCADE_COUNT = 4;
+
+///-----------------------------------------------------------------------------------------------
+/// A slice of the camera frustum rendering its shadow casters into its own depth map.
+///
+/// The resolution and the minimum caster size (in texels of the cascade's depth map) are configured
+/// per cascade, so that distant cascades can use smaller depth maps and skip casters too small to matter.
+struct ShadowCascade final
+{
+    unsigned int mResolution;
+    float mMinCasterSizeInTexels;
+    
+    float mSplitDepth              = 0.0f;
+    float mTexelWorldSize          = 0.0f;
+    glm::mat4 mLightSpaceMatrix    = glm::mat4(1.0f);
+    math::Frustum mLightFrustum    = {};
+    GLuint mDepthTexture           = 0;
+    GLuint mFrameBufferObject      = 0;
+};
+
+///-----------------------------------------------------------------------------------------------
+/// Splits the camera frustum, up to the given shadow distance, into one slice per cascade and fits
+/// an orthographic light projection around each slice.
+///
+/// Split depths blend logarithmic and uniform splits. Each light projection is sized to the bounding
+/// sphere of its slice and its origin is snapped to the cascade's texel grid, so that shadow edges don't
+/// shimmer while the camera moves.
+/// @param[in] cameraComponent the camera the cascades are fitted to.
+/// @param[in] renderableWidth the width of the window's renderable area.
+/// @param[in] renderableHeight the height of the window's renderable area.
+/// @param[in] lightPosition the position of the main shadow casting light, which is assumed to be pointing towards the origin.
+/// @param[in] shadowDistance the distance from the camera up to which shadows are rendered.
+/// @param[out] shadowCascades the cascades to update, ordered from the closest to the camera to the furthest away.
+void UpdateShadowCascades
+(
+    const CameraSingletonComponent& cameraComponent,
+    const float renderableWidth,
+    const float renderableHeight,
+    const glm::vec3& lightPosition,
+    const float shadowDistance,
+    std::vector<ShadowCascade>& shadowCascades
+);
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* ShadowCascadeUtils_h */
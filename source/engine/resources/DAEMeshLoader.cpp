@@ -243,7 +243,10 @@ std::unique_ptr<IResource> DAEMeshLoader::VCreateAndLoadResource(const std::stri
         animationInfo.mBoneNameToAnimInfo[nodeName].mScalingKeys = std::move(scalingKeys);
     }
     
-    GLuint vertexArrayObject;
+    GLuint vertexArrayObject = 0;
+
+    // Headless builds keep the CPU side mesh data only
+#if !defined(GENESIS_HEADLESS)
     GLuint vertexBufferObject;
     GLuint uvCoordsBufferObject;
     GLuint normalsBufferObject;
@@ -302,11 +305,9 @@ std::unique_ptr<IResource> DAEMeshLoader::VCreateAndLoadResource(const std::stri
     GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, totalIndexCount * sizeof(unsigned short), &indices[0], GL_STATIC_DRAW));
     
     GL_CHECK(glBindVertexArray(0));
+#endif
     
-    // Calculate dimensions
-    glm::vec3 meshDimensions(math::Abs(minX - maxX), math::Abs(minY - maxY), math::Abs(minZ - maxZ));
-    
-    std::unique_ptr<MeshResource> meshResource(new MeshResource(animationInfo, boneOffsetMatrices, boneNameToIdMap, sceneTransform, scene->mRootNode, vertexArrayObject, indexCountPerMesh, baseIndexPerMesh, baseVertexPerMesh, meshDimensions));
+    std::unique_ptr<MeshResource> meshResource(new MeshResource(animationInfo, boneOffsetMatrices, boneNameToIdMap, sceneTransform, scene->mRootNode, vertexArrayObject, indexCountPerMesh, baseIndexPerMesh, baseVertexPerMesh, glm::vec3(minX, minY, minZ), glm::vec3(maxX, maxY, maxZ)));
     
     importer.FreeScene();
     
@@ -54,6 +54,34 @@ const glm::vec3& MeshResource::GetDimensions() const
 
 ///------------------------------------------------------------------------------------------------
 
+const glm::vec3& MeshResource::GetBoundingBoxMin() const
+{
+    return mBoundingBoxMin;
+}
+
+///------------------------------------------------------------------------------------------------
+
+const glm::vec3& MeshResource::GetBoundingBoxMax() const
+{
+    return mBoundingBoxMax;
+}
+
+///------------------------------------------------------------------------------------------------
+
+glm::vec3 MeshResource::GetBoundingBoxCenter() const
+{
+    return (mBoundingBoxMin + mBoundingBoxMax) * 0.5f;
+}
+
+///------------------------------------------------------------------------------------------------
+
+float MeshResource::GetBoundingSphereRadius() const
+{
+    return mBoundingSphereRadius;
+}
+
+///------------------------------------------------------------------------------------------------
+
 bool MeshResource::HasSkeleton() const
 {
     return mRootSkeletonNode != nullptr;
@@ -96,7 +124,7 @@ const std::vector<glm::mat4>& MeshResource::GetBoneOffsetMatrices() const
 
 ///------------------------------------------------------------------------------------------------
 
-MeshResource::MeshResource(const AnimationInfo& animationInfo, const std::vector<glm::mat4>& boneOffsetMatrices, const tsl::robin_map<StringId, unsigned int, StringIdHasher>& boneMapping, const glm::mat4& sceneTransform, const aiNode* rootAssimpNode, const GLuint vertexArrayObject, const std::vector<GLuint>& indexCountPerMesh, const std::vector<GLuint>& baseIndexPerMesh, const std::vector<GLuint>& baseVertexPerMesh, const glm::vec3& meshDimensions)
+MeshResource::MeshResource(const AnimationInfo& animationInfo, const std::vector<glm::mat4>& boneOffsetMatrices, const tsl::robin_map<StringId, unsigned int, StringIdHasher>& boneMapping, const glm::mat4& sceneTransform, const aiNode* rootAssimpNode, const GLuint vertexArrayObject, const std::vector<GLuint>& indexCountPerMesh, const std::vector<GLuint>& baseIndexPerMesh, const std::vector<GLuint>& baseVertexPerMesh, const glm::vec3& boundingBoxMin, const glm::vec3& boundingBoxMax)
     : mAnimationInfo(animationInfo)
     , mBoneOffsetMatrices(boneOffsetMatrices)
     , mBoneNameToIdMap(boneMapping)
@@ -105,20 +133,28 @@ MeshResource::MeshResource(const AnimationInfo& animationInfo, const std::vector
     , mIndexCountPerMesh(indexCountPerMesh)
     , mBaseIndexPerMesh(baseIndexPerMesh)
     , mBaseVertexPerMesh(baseVertexPerMesh)
-    , mDimensions(meshDimensions)
+    , mBoundingBoxMin(boundingBoxMin)
+    , mBoundingBoxMax(boundingBoxMax)
+    , mDimensions(boundingBoxMax - boundingBoxMin)
+    // Animated poses can reach well outside of the bind pose bounds, hence the doubled culling sphere
+    , mBoundingSphereRadius(glm::length(boundingBoxMax - boundingBoxMin))
 {
     mRootSkeletonNode = new SkeletonNode;
     CreateSkeleton(rootAssimpNode, mRootSkeletonNode);
 }
 
-MeshResource::MeshResource(const GLuint vertexArrayObject, const GLuint elementCount, const glm::vec3& meshDimensions)
+MeshResource::MeshResource(const GLuint vertexArrayObject, const GLuint elementCount, const glm::vec3& boundingBoxMin, const glm::vec3& boundingBoxMax)
     : mAnimationInfo()
     , mSceneTransform()
     , mVertexArrayObject(vertexArrayObject)
     , mIndexCountPerMesh({elementCount})
     , mBaseIndexPerMesh({0})
     , mBaseVertexPerMesh({0})
-    , mDimensions(meshDimensions)
+    , mBoundingBoxMin(boundingBoxMin)
+    , mBoundingBoxMax(boundingBoxMax)
+    , mDimensions(boundingBoxMax - boundingBoxMin)
+    // Half the bounding box diagonal, so that the sphere centred on the box encloses all of it
+    , mBoundingSphereRadius(glm::length(boundingBoxMax - boundingBoxMin) * 0.5f)
     , mRootSkeletonNode(nullptr)
 {
 }
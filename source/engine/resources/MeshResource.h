@@ -99,6 +99,10 @@ public:
     const std::vector<GLuint>& GetBaseIndexPerMesh() const;
     const std::vector<GLuint>& GetBaseVertexPerMesh() const;
     const glm::vec3& GetDimensions() const;
+    const glm::vec3& GetBoundingBoxMin() const;
+    const glm::vec3& GetBoundingBoxMax() const;
+    glm::vec3 GetBoundingBoxCenter() const;
+    float GetBoundingSphereRadius() const;
     bool HasSkeleton() const;
     const SkeletonNode* GetRootSkeletonNode() const;
     const AnimationInfo& GetAnimationInfo() const;
@@ -108,10 +112,10 @@ public:
     
 private:
     // Animated model (DAE) constructor
-    MeshResource(const AnimationInfo& animationInfo, const std::vector<glm::mat4>& boneOffsetMatrices, const tsl::robin_map<StringId, unsigned int, StringIdHasher>& boneMapping, const glm::mat4& sceneTransform, const aiNode* rootAssimpNode, const GLuint vertexArrayObject, const std::vector<GLuint>& indexCountPerMesh, const std::vector<GLuint>& baseIndexPerMesh, const std::vector<GLuint>& baseVertexPerMesh, const glm::vec3& meshDimensions);
+    MeshResource(const AnimationInfo& animationInfo, const std::vector<glm::mat4>& boneOffsetMatrices, const tsl::robin_map<StringId, unsigned int, StringIdHasher>& boneMapping, const glm::mat4& sceneTransform, const aiNode* rootAssimpNode, const GLuint vertexArrayObject, const std::vector<GLuint>& indexCountPerMesh, const std::vector<GLuint>& baseIndexPerMesh, const std::vector<GLuint>& baseVertexPerMesh, const glm::vec3& boundingBoxMin, const glm::vec3& boundingBoxMax);
     
     // Static model (OBJ) constructor
-    MeshResource(const GLuint vertexArrayObject, const GLuint elementCount, const glm::vec3& meshDimensions);
+    MeshResource(const GLuint vertexArrayObject, const GLuint elementCount, const glm::vec3& boundingBoxMin, const glm::vec3& boundingBoxMax);
     
 private:
     void CreateSkeleton(const aiNode* rootAssimpNode, SkeletonNode* skeletonNode);
@@ -126,7 +130,10 @@ private:
     const std::vector<GLuint> mIndexCountPerMesh;
     const std::vector<GLuint> mBaseIndexPerMesh;
     const std::vector<GLuint> mBaseVertexPerMesh;
+    const glm::vec3 mBoundingBoxMin;
+    const glm::vec3 mBoundingBoxMax;
     const glm::vec3 mDimensions;
+    const float mBoundingSphereRadius;
     SkeletonNode* mRootSkeletonNode;
     
 };
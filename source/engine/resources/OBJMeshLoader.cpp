@@ -157,7 +157,10 @@ std::unique_ptr<IResource> OBJMeshLoader::VCreateAndLoadResource(const std::stri
     
     std::fclose(file);
     
-    GLuint vertexArrayObject;
+    GLuint vertexArrayObject = 0;
+
+    // Headless builds keep the CPU side mesh data only
+#if !defined(GENESIS_HEADLESS)
     GLuint vertexBufferObject;
     GLuint uvCoordsBufferObject;
     GLuint normalsBufferObject;
@@ -202,10 +205,9 @@ std::unique_ptr<IResource> OBJMeshLoader::VCreateAndLoadResource(const std::stri
     GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, final_indices.size() * sizeof(unsigned short), &final_indices[0], GL_STATIC_DRAW));
     
     GL_CHECK(glBindVertexArray(0));
+#endif
     
-    // Calculate dimensions
-    glm::vec3 meshDimensions(math::Abs(minX - maxX), math::Abs(minY - maxY), math::Abs(minZ - maxZ));
-    return std::unique_ptr<MeshResource>(new MeshResource(vertexArrayObject, final_indices.size(), meshDimensions));
+    return std::unique_ptr<MeshResource>(new MeshResource(vertexArrayObject, final_indices.size(), glm::vec3(minX, minY, minZ), glm::vec3(maxX, maxY, maxZ)));
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 #include "../common/utils/OSMessageBox.h"
 #include "../common/utils/StringUtils.h"
 #include "../common/utils/TypeTraits.h"
+#include "../debug/Profiler.h"
 
 #include <fstream>
 #include <cassert>
@@ -48,6 +49,7 @@ const std::string ResourceLoadingService::RES_MUSIC_ROOT         = RES_ROOT + "m
 const std::string ResourceLoadingService::RES_SFX_ROOT           = RES_ROOT + "sfx/";
 const std::string ResourceLoadingService::RES_XML_ROOT           = RES_ROOT + "xml/";
 const std::string ResourceLoadingService::RES_SHADERS_ROOT       = RES_ROOT + "shaders/";
+const std::string ResourceLoadingService::RES_SHADER_CACHE_ROOT  = RES_ROOT + "shader_cache/";
 const std::string ResourceLoadingService::RES_TEXTURES_ROOT      = RES_ROOT + "textures/";
 const std::string ResourceLoadingService::RES_ATLASES_ROOT       = RES_TEXTURES_ROOT + "atlases/";
 const std::string ResourceLoadingService::RES_FONT_MAP_DATA_ROOT = RES_DATA_ROOT + "font_maps/";
@@ -195,6 +197,8 @@ IResource& ResourceLoadingService::GetResource(const ResourceId resourceId)
 
 void ResourceLoadingService::LoadResourceInternal(const std::string& resourcePath, const ResourceId resourceId)
 {
+    const debug::ProfilerZone resourceLoadZone("LoadResource", &resourcePath);
+    
     // Get resource extension
     const auto resourceFileExtension = GetFileExtension(resourcePath);
     
@@ -20,6 +20,13 @@
 
 ///------------------------------------------------------------------------------------------------
 
+namespace bench
+{
+    class HeadlessSimulationRunner;
+}
+
+///------------------------------------------------------------------------------------------------
+
 namespace genesis
 { 
 
@@ -49,6 +56,7 @@ struct ResourceIdHasher
 class ResourceLoadingService final
 {
     friend class genesis::GenesisEngine;
+    friend class bench::HeadlessSimulationRunner;
     
 public:
     static const std::string RES_ROOT;    
@@ -59,6 +67,7 @@ public:
     static const std::string RES_SFX_ROOT;
     static const std::string RES_XML_ROOT;
     static const std::string RES_SHADERS_ROOT;
+    static const std::string RES_SHADER_CACHE_ROOT;
     static const std::string RES_TEXTURES_ROOT;     
     static const std::string RES_ATLASES_ROOT;
     static const std::string RES_FONT_MAP_DATA_ROOT;
@@ -7,13 +7,16 @@
 
 #include "ShaderLoader.h"
 #include "ResourceLoadingService.h"
+#include "../common/utils/FileUtils.h"
 #include "../common/utils/Logging.h"
 #include "../common/utils/OSMessageBox.h"
 #include "../common/utils/StringUtils.h"
 #include "../resources/ShaderResource.h"
 #include "../rendering/opengl/Context.h"
 
-#include <fstream>   // ifstream
+#include <cstdint>   // uint64_t
+#include <fstream>   // ifstream, ofstream
+#include <iomanip>   // setw, setfill
 #include <streambuf> // istreambuf_iterator
 
 ///------------------------------------------------------------------------------------------------
@@ -30,15 +33,77 @@ namespace resources
 
 const std::string ShaderLoader::VERTEX_SHADER_FILE_EXTENSION = ".vs";
 const std::string ShaderLoader::FRAGMENT_SHADER_FILE_EXTENSION = ".fs";
+const std::string ShaderLoader::PROGRAM_BINARY_FILE_EXTENSION = ".bin";
 
 ///------------------------------------------------------------------------------------------------
 
-static void ExtractUniformFromLine(const std::string& line, const std::string& shaderName, const GLuint programId, tsl::robin_map<StringId, GLuint, StringIdHasher>& outUniformNamesToLocations);
+namespace
+{
+    static const std::uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+    static const std::uint64_t FNV_PRIME        = 0x100000001B3ULL;
+}
+
+///------------------------------------------------------------------------------------------------
+
+static void ExtractUniformFromLine(const std::string& line, const std::string& shaderName, const GLuint programId, std::vector<GLint>& outUniformSlotLocations)
+{
+    const auto uniformLineSplitBySpace = StringSplit(line, ' ');
+    
+    // Uniform names will always be the third components in the line
+    // e.g. uniform bool foo
+    auto uniformName = uniformLineSplitBySpace[2].substr(0, uniformLineSplitBySpace[2].size() - 1);
+    auto uniformLocationName = uniformName;
+    
+    // Check for uniform array. Array elements have consecutive locations, so only the location
+    // of the first element is needed to upload the whole array in one call
+    if (uniformName.at(uniformName.size() - 1) == ']')
+    {
+        uniformName = uniformName.substr(0, uniformName.size() - 1);
+        const auto uniformNameSplitByLeftSquareBracket = StringSplit(uniformName, '[');
+        
+        uniformName = uniformNameSplitByLeftSquareBracket[0];
+        
+        if (StringIsInt(uniformNameSplitByLeftSquareBracket[1]) == false)
+        {
+            ShowMessageBox(MessageBoxType::ERROR, "Error Extracting Uniform", "Could not parse array element count for uniform: " + uniformName);
+        }
+        
+        uniformLocationName = uniformName + "[0]";
+    }
+    
+    const auto uniformLocation = GL_NO_CHECK(glGetUniformLocation(programId, uniformLocationName.c_str()));
+    const auto uniformSlot = rendering::GetUniformSlot(StringId(uniformName));
+    
+    if (uniformSlot >= outUniformSlotLocations.size())
+    {
+        outUniformSlotLocations.resize(uniformSlot + 1, -1);
+    }
+    outUniformSlotLocations[uniformSlot] = uniformLocation;
+    
+    if (uniformLocation == -1)
+    {
+        Log(LogType::WARNING, "At %s, Unused uniform at location -1: %s", shaderName.c_str(), uniformLocationName.c_str());
+    }
+}
 
 ///------------------------------------------------------------------------------------------------
 
 void ShaderLoader::VInitialize()
 {
+    // Program binaries are only valid for the driver that produced them
+    const auto* vendor   = GL_NO_CHECK(glGetString(GL_VENDOR));
+    const auto* renderer = GL_NO_CHECK(glGetString(GL_RENDERER));
+    const auto* version  = GL_NO_CHECK(glGetString(GL_VERSION));
+    
+    mGLDriverDescription.clear();
+    for (const auto* driverString: { vendor, renderer, version })
+    {
+        if (driverString != nullptr)
+        {
+            mGLDriverDescription += reinterpret_cast<const char*>(driverString);
+        }
+        mGLDriverDescription += '\n';
+    }
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -49,12 +114,108 @@ std::unique_ptr<IResource> ShaderLoader::VCreateAndLoadResource(const std::strin
     // being added by the ResourceLoadingService prior to this call
     const auto resourcePath = resourcePathWithExtension.substr(0, resourcePathWithExtension.size() - 3);
 
-    // Generate vertex shader id
-    const auto vertexShaderId = GL_NO_CHECK(glCreateShader(GL_VERTEX_SHADER));
-    
-    // Read vertex shader source
+    // Read vertex and fragment shader sources
     auto vertexShaderFileContents = ReadFileContents(resourcePath + VERTEX_SHADER_FILE_EXTENSION);
     ReplaceIncludeDirectives(vertexShaderFileContents);
+    auto fragmentShaderFileContents = ReadFileContents(resourcePath + FRAGMENT_SHADER_FILE_EXTENSION);
+    ReplaceIncludeDirectives(fragmentShaderFileContents);
+    
+    // Reuse the program binary of a previous run when available, and compile it otherwise
+    const auto programBinaryFilePath = GetProgramBinaryFilePath(vertexShaderFileContents, fragmentShaderFileContents);
+    auto programId = LoadProgramBinary(programBinaryFilePath);
+    if (programId == 0)
+    {
+        programId = CompileAndLinkProgram(resourcePath, vertexShaderFileContents, fragmentShaderFileContents);
+        SaveProgramBinary(programId, programBinaryFilePath);
+    }
+    
+    // Point the shared per frame uniform block, if used by the shader, at its binding point
+    const auto frameDataUniformBlockIndex = GL_NO_CHECK(glGetUniformBlockIndex(programId, ShaderResource::FRAME_DATA_UNIFORM_BLOCK_NAME.c_str()));
+    if (frameDataUniformBlockIndex != GL_INVALID_INDEX)
+    {
+        GL_CHECK(glUniformBlockBinding(programId, frameDataUniformBlockIndex, ShaderResource::FRAME_DATA_UNIFORM_BLOCK_BINDING_POINT));
+    }
+    
+    GL_CHECK(glValidateProgram(programId));
+    
+#ifndef _WIN32
+    GLint status = 0;
+    std::string validateInfoLog;
+    GLint validateInfoLogLength = 0;
+    
+    GL_CHECK(glGetProgramiv(programId, GL_VALIDATE_STATUS, &status));
+    GL_NO_CHECK(glGetProgramiv(programId, GL_INFO_LOG_LENGTH, &validateInfoLogLength));
+    if (validateInfoLogLength > 0)
+    {
+        validateInfoLog.clear();
+        validateInfoLog.reserve(validateInfoLogLength);
+        GL_CHECK(glGetProgramInfoLog(programId, validateInfoLogLength, NULL, &validateInfoLog[0]));
+        Log(LogType::WARNING, "While validating shader %s:\n%s", resourcePath.c_str(), validateInfoLog.c_str());
+    }
+#endif
+    
+    const auto uniformSlotLocations = GetUniformSlotLocations(programId, resourcePath,  vertexShaderFileContents, fragmentShaderFileContents);
+    
+    return std::make_unique<ShaderResource>(uniformSlotLocations, programId);
+}
+
+///------------------------------------------------------------------------------------------------
+
+std::string ShaderLoader::ReadFileContents(const std::string& filePath) const
+{
+    std::ifstream file(filePath);
+    
+    if (!file.good())
+    {
+        ShowMessageBox(MessageBoxType::ERROR, "File could not be found", filePath.c_str());
+        return nullptr;
+    }
+    
+    std::string contents;
+    
+    file.seekg(0, std::ios::end);
+    contents.reserve(static_cast<size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    
+    contents.assign((std::istreambuf_iterator<char>(file)),
+               std::istreambuf_iterator<char>());
+    
+    return contents;
+}
+
+///------------------------------------------------------------------------------------------------
+
+void ShaderLoader::ReplaceIncludeDirectives(std::string& shaderSource) const
+{
+    std::stringstream reconstructedSourceBuilder;
+    auto shaderSourceSplitByLine = StringSplit(shaderSource, '\n');
+    for (const auto& line: shaderSourceSplitByLine)
+    {
+        if (StringStartsWith(line, "#include"))
+        {
+            const auto fileSplitByQuotes = StringSplit(line, '"');
+            reconstructedSourceBuilder << '\n' <<  ReadFileContents(ResourceLoadingService::RES_SHADERS_ROOT +  fileSplitByQuotes[fileSplitByQuotes.size() - 1]);
+        }
+        else
+        {
+            reconstructedSourceBuilder << '\n' << line;
+        }
+    }
+        
+    shaderSource = reconstructedSourceBuilder.str();
+}
+
+///------------------------------------------------------------------------------------------------
+
+GLuint ShaderLoader::CompileAndLinkProgram
+(
+    const std::string& shaderName,
+    const std::string& vertexShaderFileContents,
+    const std::string& fragmentShaderFileContents
+) const
+{
+    // Generate vertex shader id
+    const auto vertexShaderId = GL_NO_CHECK(glCreateShader(GL_VERTEX_SHADER));
     const char* vertexShaderFileContentsPtr = vertexShaderFileContents.c_str();
 
     // Compile vertex shader
@@ -63,73 +224,52 @@ std::unique_ptr<IResource> ShaderLoader::VCreateAndLoadResource(const std::strin
     
     // Check vertex shader compilation
     std::string vertexShaderInfoLog;
-    GLint vertexShaderInfoLogLength;
+    GLint vertexShaderInfoLogLength = 0;
     GL_CHECK(glGetShaderiv(vertexShaderId, GL_INFO_LOG_LENGTH, &vertexShaderInfoLogLength));
     if (vertexShaderInfoLogLength > 0)
     {
         vertexShaderInfoLog.clear();
         vertexShaderInfoLog.reserve(vertexShaderInfoLogLength);
         GL_CHECK(glGetShaderInfoLog(vertexShaderId, vertexShaderInfoLogLength, nullptr, &vertexShaderInfoLog[0]));
-        Log(LogType::WARNING, "While compiling vertex shader %s%s:\n%s", resourcePath.c_str(), ".vs", vertexShaderInfoLog.c_str());
+        Log(LogType::WARNING, "While compiling vertex shader %s%s:\n%s", shaderName.c_str(), ".vs", vertexShaderInfoLog.c_str());
     }
     
     // Generate fragment shader id
     const auto fragmentShaderId = GL_NO_CHECK(glCreateShader(GL_FRAGMENT_SHADER));
-    
-    // Read vertex shader source
-    auto fragmentShaderFileContents = ReadFileContents(resourcePath + FRAGMENT_SHADER_FILE_EXTENSION);
-    ReplaceIncludeDirectives(fragmentShaderFileContents);
     const char* fragmentShaderFileContentsPtr = fragmentShaderFileContents.c_str();
     
     GL_CHECK(glShaderSource(fragmentShaderId, 1, &fragmentShaderFileContentsPtr, nullptr));
     GL_CHECK(glCompileShader(fragmentShaderId));
     
     std::string fragmentShaderInfoLog;
-    GLint fragmentShaderInfoLogLength;
+    GLint fragmentShaderInfoLogLength = 0;
     GL_CHECK(glGetShaderiv(fragmentShaderId, GL_INFO_LOG_LENGTH, &fragmentShaderInfoLogLength));
     if (fragmentShaderInfoLogLength > 0)
     {
         fragmentShaderInfoLog.clear();
         fragmentShaderInfoLog.reserve(fragmentShaderInfoLogLength);
         GL_CHECK(glGetShaderInfoLog(fragmentShaderId, fragmentShaderInfoLogLength, nullptr, &fragmentShaderInfoLog[0]));
-        Log(LogType::WARNING, "While compiling fragment shader %s%s:\n%s", resourcePath.c_str(), ".fs", fragmentShaderInfoLog.c_str());
+        Log(LogType::WARNING, "While compiling fragment shader %s%s:\n%s", shaderName.c_str(), ".fs", fragmentShaderInfoLog.c_str());
     }
 
-    // Link shader program
+    // Link shader program, keeping its binary retrievable for the program binary cache
     const auto programId = GL_NO_CHECK(glCreateProgram());
     GL_CHECK(glAttachShader(programId, vertexShaderId));
     GL_CHECK(glAttachShader(programId, fragmentShaderId));
+    GL_CHECK(glProgramParameteri(programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
     GL_CHECK(glLinkProgram(programId));
     
 #ifndef _WIN32
     std::string linkingInfoLog;
-    GLint linkingInfoLogLength;
+    GLint linkingInfoLogLength = 0;
     
-    glGetProgramiv(programId, GL_INFO_LOG_LENGTH, &linkingInfoLogLength);
+    GL_NO_CHECK(glGetProgramiv(programId, GL_INFO_LOG_LENGTH, &linkingInfoLogLength));
     if (linkingInfoLogLength > 0)
     {
         linkingInfoLog.clear();
         linkingInfoLog.reserve(linkingInfoLogLength);
         GL_CHECK(glGetProgramInfoLog(programId, linkingInfoLogLength, NULL, &linkingInfoLog[0]));
-        Log(LogType::WARNING, "While linking shader %s:\n%s", resourcePath.c_str(), linkingInfoLog.c_str());
-    }
-#endif
-    
-    GL_CHECK(glValidateProgram(programId));
-    
-#ifndef _WIN32
-    GLint status;
-    std::string validateInfoLog;
-    GLint validateInfoLogLength;
-    
-    GL_CHECK(glGetProgramiv(programId, GL_VALIDATE_STATUS, &status));
-    glGetProgramiv(programId, GL_INFO_LOG_LENGTH, &validateInfoLogLength);
-    if (validateInfoLogLength > 0)
-    {
-        validateInfoLog.clear();
-        validateInfoLog.reserve(validateInfoLogLength);
-        GL_CHECK(glGetProgramInfoLog(programId, validateInfoLogLength, NULL, &validateInfoLog[0]));
-        Log(LogType::WARNING, "While validating shader %s:\n%s", resourcePath.c_str(), validateInfoLog.c_str());
+        Log(LogType::WARNING, "While linking shader %s:\n%s", shaderName.c_str(), linkingInfoLog.c_str());
     }
 #endif
     
@@ -139,60 +279,110 @@ std::unique_ptr<IResource> ShaderLoader::VCreateAndLoadResource(const std::strin
     GL_CHECK(glDeleteShader(vertexShaderId));
     GL_CHECK(glDeleteShader(fragmentShaderId));
     
-    const auto uniformNamesToLocations = GetUniformNamesToLocationsMap(programId, resourcePath,  vertexShaderFileContents, fragmentShaderFileContents);
-    
-    return std::make_unique<ShaderResource>(uniformNamesToLocations, programId);
+    return programId;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-std::string ShaderLoader::ReadFileContents(const std::string& filePath) const
+std::string ShaderLoader::GetProgramBinaryFilePath(const std::string& vertexShaderFileContents, const std::string& fragmentShaderFileContents) const
 {
-    std::ifstream file(filePath);
+    // 64 bit FNV-1a, as the hash needs to stay the same across runs and builds
+    std::uint64_t hash = FNV_OFFSET_BASIS;
+    for (const auto* hashedString: { &vertexShaderFileContents, &fragmentShaderFileContents, &mGLDriverDescription })
+    {
+        for (const auto character: *hashedString)
+        {
+            hash = (hash ^ static_cast<unsigned char>(character)) * FNV_PRIME;
+        }
+        
+        // Separate the hashed strings, so that moving text from one to the other changes the hash
+        hash = (hash ^ 0xFF) * FNV_PRIME;
+    }
     
-    if (!file.good())
+    std::stringstream programBinaryFilePathBuilder;
+    programBinaryFilePathBuilder << ResourceLoadingService::RES_SHADER_CACHE_ROOT << std::hex << std::setw(16) << std::setfill('0') << hash << PROGRAM_BINARY_FILE_EXTENSION;
+    return programBinaryFilePathBuilder.str();
+}
+
+///------------------------------------------------------------------------------------------------
+
+GLuint ShaderLoader::LoadProgramBinary(const std::string& programBinaryFilePath) const
+{
+    std::ifstream programBinaryFile(programBinaryFilePath, std::ios::binary);
+    if (!programBinaryFile.good())
     {
-        ShowMessageBox(MessageBoxType::ERROR, "File could not be found", filePath.c_str());
-        return nullptr;
+        return 0;
     }
     
-    std::string contents;
+    // Program binary files hold the driver's binary format followed by the binary itself
+    GLenum programBinaryFormat = 0;
+    programBinaryFile.read(reinterpret_cast<char*>(&programBinaryFormat), sizeof(programBinaryFormat));
+    const auto hasProgramBinaryFormat = programBinaryFile.good();
+    const std::vector<char> programBinary((std::istreambuf_iterator<char>(programBinaryFile)), std::istreambuf_iterator<char>());
+    if (!hasProgramBinaryFormat || programBinary.empty())
+    {
+        Log(LogType::WARNING, "Ignoring malformed program binary %s", programBinaryFilePath.c_str());
+        return 0;
+    }
     
-    file.seekg(0, std::ios::end);
-    contents.reserve(static_cast<size_t>(file.tellg()));
-    file.seekg(0, std::ios::beg);
+    // Drivers reject binaries they can no longer use (e.g. after an update), in which case the
+    // program is compiled from source again
+    const auto programId = GL_NO_CHECK(glCreateProgram());
+    GL_NO_CHECK(glProgramBinary(programId, programBinaryFormat, programBinary.data(), static_cast<GLsizei>(programBinary.size())));
     
-    contents.assign((std::istreambuf_iterator<char>(file)),
-               std::istreambuf_iterator<char>());
+    GLint linkStatus = GL_FALSE;
+    GL_NO_CHECK(glGetProgramiv(programId, GL_LINK_STATUS, &linkStatus));
+    if (linkStatus != GL_TRUE)
+    {
+        Log(LogType::WARNING, "Program binary %s was rejected by the driver, recompiling", programBinaryFilePath.c_str());
+        
+        // Unknown binary formats also raise an error, which is not to trip the checks of later calls
+        static_cast<void>(GL_NO_CHECK(glGetError()));
+        GL_CHECK(glDeleteProgram(programId));
+        return 0;
+    }
     
-    return contents;
+    return programId;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-void ShaderLoader::ReplaceIncludeDirectives(std::string& shaderSource) const
+void ShaderLoader::SaveProgramBinary(const GLuint programId, const std::string& programBinaryFilePath) const
 {
-    std::stringstream reconstructedSourceBuilder;
-    auto shaderSourceSplitByLine = StringSplit(shaderSource, '\n');
-    for (const auto& line: shaderSourceSplitByLine)
+    GLint programBinaryFormatCount = 0;
+    GL_CHECK(glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &programBinaryFormatCount));
+    
+    GLint programBinaryLength = 0;
+    GL_CHECK(glGetProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &programBinaryLength));
+    
+    // Drivers without program binary support only ever compile from source
+    if (programBinaryFormatCount <= 0 || programBinaryLength <= 0)
     {
-        if (StringStartsWith(line, "#include"))
-        {
-            const auto fileSplitByQuotes = StringSplit(line, '"');
-            reconstructedSourceBuilder << '\n' <<  ReadFileContents(ResourceLoadingService::RES_SHADERS_ROOT +  fileSplitByQuotes[fileSplitByQuotes.size() - 1]);
-        }
-        else
-        {
-            reconstructedSourceBuilder << '\n' << line;
-        }
+        return;
+    }
+    
+    std::vector<char> programBinary(programBinaryLength);
+    GLenum programBinaryFormat = 0;
+    GL_CHECK(glGetProgramBinary(programId, programBinaryLength, nullptr, &programBinaryFormat, programBinary.data()));
+    
+    if (!MakeDirectory(ResourceLoadingService::RES_SHADER_CACHE_ROOT))
+    {
+        Log(LogType::WARNING, "Could not create shader cache directory %s", ResourceLoadingService::RES_SHADER_CACHE_ROOT.c_str());
+        return;
+    }
+    
+    std::ofstream programBinaryFile(programBinaryFilePath, std::ios::binary);
+    programBinaryFile.write(reinterpret_cast<const char*>(&programBinaryFormat), sizeof(programBinaryFormat));
+    programBinaryFile.write(programBinary.data(), programBinary.size());
+    if (!programBinaryFile.good())
+    {
+        Log(LogType::WARNING, "Could not write program binary %s", programBinaryFilePath.c_str());
     }
-        
-    shaderSource = reconstructedSourceBuilder.str();
 }
 
 ///------------------------------------------------------------------------------------------------
 
-tsl::robin_map<StringId, GLuint, StringIdHasher> ShaderLoader::GetUniformNamesToLocationsMap
+std::vector<GLint> ShaderLoader::GetUniformSlotLocations
 (
     const GLuint programId,
     const std::string& shaderName,
@@ -200,14 +390,14 @@ tsl::robin_map<StringId, GLuint, StringIdHasher> ShaderLoader::GetUniformNamesTo
     const std::string& fragmentShaderFileContents
 ) const
 {
-    tsl::robin_map<StringId, GLuint, StringIdHasher> uniformNamesToLocationsMap;
+    std::vector<GLint> uniformSlotLocations;
     
     const auto vertexShaderContentSplitByNewline = StringSplit(vertexShaderFileContents, '\n');
     for (const auto& vertexShaderLine: vertexShaderContentSplitByNewline)
     {
         if (StringStartsWith(vertexShaderLine, "uniform"))
         {
-            ExtractUniformFromLine(vertexShaderLine, shaderName, programId, uniformNamesToLocationsMap);
+            ExtractUniformFromLine(vertexShaderLine, shaderName, programId, uniformSlotLocations);
         }
     }
     
@@ -216,11 +406,11 @@ tsl::robin_map<StringId, GLuint, StringIdHasher> ShaderLoader::GetUniformNamesTo
     {
         if (StringStartsWith(fragmentShaderLine, "uniform"))
         {
-            ExtractUniformFromLine(fragmentShaderLine, shaderName, programId, uniformNamesToLocationsMap);
+            ExtractUniformFromLine(fragmentShaderLine, shaderName, programId, uniformSlotLocations);
         }
     }
     
-    return uniformNamesToLocationsMap;
+    return uniformSlotLocations;
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -15,7 +15,7 @@
 
 #include <memory>
 #include <string>
-#include <tsl/robin_map.h>
+#include <vector>
 
 ///------------------------------------------------------------------------------------------------
 
@@ -29,6 +29,8 @@ namespace resources
 
 ///------------------------------------------------------------------------------------------------
 
+using GLenum = unsigned int;
+using GLint  = int;
 using GLuint = unsigned int;
 
 ///------------------------------------------------------------------------------------------------
@@ -44,18 +46,34 @@ public:
 private:
     static const std::string VERTEX_SHADER_FILE_EXTENSION;
     static const std::string FRAGMENT_SHADER_FILE_EXTENSION;
+    static const std::string PROGRAM_BINARY_FILE_EXTENSION;
     
     ShaderLoader() = default;
     
     std::string ReadFileContents(const std::string& filePath) const;
     void ReplaceIncludeDirectives(std::string& shaderSource) const;
-    tsl::robin_map<StringId, GLuint, StringIdHasher> GetUniformNamesToLocationsMap
+    GLuint CompileAndLinkProgram
+    (
+        const std::string& shaderName,
+        const std::string& vertexShaderFileContents,
+        const std::string& fragmentShaderFileContents
+    ) const;
+    
+    // Linked programs are cached on disk as driver specific program binaries, keyed by the hash of
+    // their include expanded sources and the GL driver, so that only new or changed shaders are compiled
+    std::string GetProgramBinaryFilePath(const std::string& vertexShaderFileContents, const std::string& fragmentShaderFileContents) const;
+    GLuint LoadProgramBinary(const std::string& programBinaryFilePath) const;
+    void SaveProgramBinary(const GLuint programId, const std::string& programBinaryFilePath) const;
+    std::vector<GLint> GetUniformSlotLocations
     (
         const GLuint programId,
         const std::string& shaderName, 
         const std::string& vertexShaderFileContents,
         const std::string& fragmentShaderFileContents
     ) const;
+    
+private:
+    std::string mGLDriverDescription;
 };
 
 ///------------------------------------------------------------------------------------------------
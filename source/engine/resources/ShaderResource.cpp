@@ -6,7 +6,6 @@
 ///------------------------------------------------------------------------------------------------
 
 #include "ShaderResource.h"
-#include "../rendering/opengl/Context.h"
 #include "../common/utils/Logging.h"
 
 ///------------------------------------------------------------------------------------------------
@@ -21,12 +20,17 @@ namespace resources
 
 ///------------------------------------------------------------------------------------------------
 
+const std::string ShaderResource::FRAME_DATA_UNIFORM_BLOCK_NAME = "FrameData";
+const GLuint ShaderResource::FRAME_DATA_UNIFORM_BLOCK_BINDING_POINT = 0;
+
+///------------------------------------------------------------------------------------------------
+
 ShaderResource::ShaderResource
 (
-    const tsl::robin_map<StringId, GLuint, StringIdHasher>& uniformNamesToLocations,
+    const std::vector<GLint>& uniformSlotLocations,
     const GLuint programId
 )
-    : mShaderUniformNamesToLocations(uniformNamesToLocations) 
+    : mUniformSlotLocations(uniformSlotLocations) 
     , mProgramId(programId)
 {
     
@@ -51,15 +55,16 @@ ShaderResource::ShaderResource(const ShaderResource& rhs)
 
 bool ShaderResource::SetMatrix4fv
 (
-    const StringId& uniformName, 
+    rendering::IRenderDevice& renderDevice,
+    const rendering::UniformSlot uniformSlot, 
     const glm::mat4& matrix, 
-    const GLuint count /* 1 */,
-    const bool transpose /* false */
+    const GLuint count /* 1 */
 ) const
 {
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
+    const auto uniformLocation = GetUniformSlotLocation(uniformSlot);
+    if (uniformLocation != -1)
     {
-        GL_CHECK(glUniformMatrix4fv(mShaderUniformNamesToLocations.at(uniformName), count, transpose, (GLfloat*)&matrix));
+        renderDevice.VSetUniformMatrix4(uniformLocation, count, &matrix[0][0]);
         return true;
     }    
     return false;
@@ -67,59 +72,38 @@ bool ShaderResource::SetMatrix4fv
 
 ///------------------------------------------------------------------------------------------------
 
-bool ShaderResource::SetMatrix4Array(const StringId& uniformName, const std::vector<glm::mat4>& values) const
-{
-    for (auto i = 0U; i < values.size(); ++i)
-    {
-        auto setUniformResult = SetMatrix4fv(StringId(uniformName.GetString() + "[" + std::to_string(i) + "]"), values[i]);
-        if (!setUniformResult)
-        {
-            return false;
-        }
-    }
-    
-    return true;
-}
-
-///------------------------------------------------------------------------------------------------
-
-bool ShaderResource::SetFloatVec4Array(const StringId& uniformName, const std::vector<glm::vec4>& values) const
+bool ShaderResource::SetFloatVec4(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const glm::vec4& vec) const
 {
-    for (auto i = 0U; i < values.size(); ++i)
+    const auto uniformLocation = GetUniformSlotLocation(uniformSlot);
+    if (uniformLocation != -1)
     {
-        auto setUniformResult = SetFloatVec4(StringId(uniformName.GetString() + "[" + std::to_string(i) + "]"), values[i]);
-        if (!setUniformResult)
-        {
-            return false;
-        }
+        renderDevice.VSetUniformVec4(uniformLocation, 1, &vec.x);
+        return true;
     }
-    
-    return true;
+    return false;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-bool ShaderResource::SetFloatVec3Array(const StringId& uniformName, const std::vector<glm::vec3>& values) const
+bool ShaderResource::SetFloatVec3(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const glm::vec3& vec) const
 {
-    for (auto i = 0U; i < values.size(); ++i)
+    const auto uniformLocation = GetUniformSlotLocation(uniformSlot);
+    if (uniformLocation != -1)
     {
-        auto setUniformResult = SetFloatVec3(StringId(uniformName.GetString() + "[" + std::to_string(i) + "]"), values[i]);
-        if (!setUniformResult)
-        {
-            return false;
-        }
+        renderDevice.VSetUniformVec3(uniformLocation, 1, &vec.x);
+        return true;
     }
-    
-    return true;
+    return false;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-bool ShaderResource::SetFloatVec4(const StringId& uniformName, const glm::vec4& vec) const
+bool ShaderResource::SetFloat(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const float value) const
 {
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
+    const auto uniformLocation = GetUniformSlotLocation(uniformSlot);
+    if (uniformLocation != -1)
     {
-        GL_CHECK(glUniform4f(mShaderUniformNamesToLocations.at(uniformName), vec.x, vec.y, vec.z, vec.w));
+        renderDevice.VSetUniformFloat(uniformLocation, 1, &value);
         return true;
     }
     return false;
@@ -127,11 +111,12 @@ bool ShaderResource::SetFloatVec4(const StringId& uniformName, const glm::vec4&
 
 ///------------------------------------------------------------------------------------------------
 
-bool ShaderResource::SetFloatVec3(const StringId& uniformName, const glm::vec3& vec) const
+bool ShaderResource::SetInt(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const int value) const
 {
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
+    const auto uniformLocation = GetUniformSlotLocation(uniformSlot);
+    if (uniformLocation != -1)
     {
-        GL_CHECK(glUniform3f(mShaderUniformNamesToLocations.at(uniformName), vec.x, vec.y, vec.z));
+        renderDevice.VSetUniformInt(uniformLocation, 1, &value);
         return true;
     }
     return false;
@@ -139,11 +124,13 @@ bool ShaderResource::SetFloatVec3(const StringId& uniformName, const glm::vec3&
 
 ///------------------------------------------------------------------------------------------------
 
-bool ShaderResource::SetFloat(const StringId& uniformName, const float value) const
+bool ShaderResource::SetBool(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const bool value) const
 {
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
+    const auto uniformLocation = GetUniformSlotLocation(uniformSlot);
+    if (uniformLocation != -1)
     {
-        GL_CHECK(glUniform1f(mShaderUniformNamesToLocations.at(uniformName), value));
+        const GLint intValue = value ? 1 : 0;
+        renderDevice.VSetUniformInt(uniformLocation, 1, &intValue);
         return true;
     }
     return false;
@@ -151,56 +138,51 @@ bool ShaderResource::SetFloat(const StringId& uniformName, const float value) co
 
 ///------------------------------------------------------------------------------------------------
 
-bool ShaderResource::SetFloatArray(const StringId& uniformName, const std::vector<float>& values) const
+void ShaderResource::SetUniforms(rendering::IRenderDevice& renderDevice, const rendering::ShaderUniforms& shaderUniforms) const
 {
-    for (auto i = 0U; i < values.size(); ++i)
+    for (const auto& entry: shaderUniforms.GetEntries())
     {
-        auto setUniformResult = SetFloat(StringId(uniformName.GetString() + "[" + std::to_string(i) + "]"), values[i]);
-        if (!setUniformResult)
+        const auto uniformLocation = GetUniformSlotLocation(entry.mSlot);
+        if (uniformLocation == -1)
         {
-            return false;
+            continue;
+        }
+        
+        // Arrays are uploaded with a single call, starting from the location of their first element
+        const auto count = static_cast<rendering::GLsizei>(entry.mCount);
+        const auto values = shaderUniforms.GetEntryValues(entry);
+        switch (entry.mType)
+        {
+            case rendering::UniformType::MATRIX:     renderDevice.VSetUniformMatrix4(uniformLocation, count, reinterpret_cast<const float*>(values)); break;
+            case rendering::UniformType::FLOAT_VEC4: renderDevice.VSetUniformVec4(uniformLocation, count, reinterpret_cast<const float*>(values)); break;
+            case rendering::UniformType::FLOAT_VEC3: renderDevice.VSetUniformVec3(uniformLocation, count, reinterpret_cast<const float*>(values)); break;
+            case rendering::UniformType::FLOAT:      renderDevice.VSetUniformFloat(uniformLocation, count, reinterpret_cast<const float*>(values)); break;
+            case rendering::UniformType::INT:
+            case rendering::UniformType::BOOL:       renderDevice.VSetUniformInt(uniformLocation, count, reinterpret_cast<const GLint*>(values)); break;
         }
     }
-    
-    return true;
-}
-
-///------------------------------------------------------------------------------------------------
-
-bool ShaderResource::SetInt(const StringId& uniformName, const int value) const
-{
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
-    {
-        GL_CHECK(glUniform1i(mShaderUniformNamesToLocations.at(uniformName), value));
-        return true;
-    }
-    return false;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-bool ShaderResource::SetBool(const StringId& uniformName, const bool value) const
+GLuint ShaderResource::GetProgramId() const
 {
-    if (mShaderUniformNamesToLocations.count(uniformName) > 0)
-    {
-        GL_CHECK(glUniform1i(mShaderUniformNamesToLocations.at(uniformName), value ? 1 : 0));
-        return true;
-    }
-    return false;
+    return mProgramId;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-GLuint ShaderResource::GetProgramId() const
+GLint ShaderResource::GetUniformSlotLocation(const rendering::UniformSlot uniformSlot) const
 {
-    return mProgramId;
+    // Slots registered after this shader was linked can't belong to it
+    return uniformSlot < mUniformSlotLocations.size() ? mUniformSlotLocations[uniformSlot] : -1;
 }
 
 ///------------------------------------------------------------------------------------------------
 
-const tsl::robin_map<StringId, GLuint, StringIdHasher>& ShaderResource::GetUniformNamesToLocations() const
+const std::vector<GLint>& ShaderResource::GetUniformSlotLocations() const
 {
-    return mShaderUniformNamesToLocations;
+    return mUniformSlotLocations;
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -208,7 +190,7 @@ const tsl::robin_map<StringId, GLuint, StringIdHasher>& ShaderResource::GetUnifo
 void ShaderResource::CopyConstruction(const ShaderResource& rhs)
 {
     mProgramId = rhs.GetProgramId();
-    mShaderUniformNamesToLocations = rhs.GetUniformNamesToLocations();
+    mUniformSlotLocations = rhs.GetUniformSlotLocations();
 }
 
 ///------------------------------------------------------------------------------------------------
@@ -13,10 +13,12 @@
 #include "IResource.h"
 #include "../common/utils/MathUtils.h"
 #include "../common/utils/StringUtils.h"
+#include "../rendering/opengl/IRenderDevice.h"
 #include "../rendering/systems/RenderingSystem.h"
+#include "../rendering/utils/ShaderUniformUtils.h"
 
 #include <string>
-#include <tsl/robin_map.h>
+#include <vector>
 
 ///------------------------------------------------------------------------------------------------
 
@@ -30,6 +32,7 @@ namespace resources
 
 ///------------------------------------------------------------------------------------------------
 
+using GLint  = int;
 using GLuint = unsigned int;
 
 ///------------------------------------------------------------------------------------------------
@@ -42,32 +45,37 @@ public:
     ShaderResource() = default;
     ShaderResource
     (
-        const tsl::robin_map<StringId, GLuint, StringIdHasher>& uniformNamesToLocations,
+        const std::vector<GLint>& uniformSlotLocations,
         const GLuint programId
     );
     ShaderResource& operator = (const ShaderResource&);
     ShaderResource(const ShaderResource&);
     
+    // Shared uniform block holding the per frame camera and light data
+    static const std::string FRAME_DATA_UNIFORM_BLOCK_NAME;
+    static const GLuint FRAME_DATA_UNIFORM_BLOCK_BINDING_POINT;
+    
+    /// Uploads the values of the given uniform block to this shader, skipping the ones it does not use.
+    /// The shader's program needs to be bound on the render device.
+    void SetUniforms(rendering::IRenderDevice& renderDevice, const rendering::ShaderUniforms& shaderUniforms) const;
+    
 private:
-    bool SetMatrix4fv(const StringId& uniformName, const glm::mat4& matrix, const GLuint count = 1, const bool transpose = false) const;
-    bool SetMatrix4Array(const StringId& uniformName, const std::vector<glm::mat4>& values) const;
-    bool SetFloatVec4Array(const StringId& uniformName, const std::vector<glm::vec4>& values) const;
-    bool SetFloatVec3Array(const StringId& uniformName, const std::vector<glm::vec3>& values) const;
-    bool SetFloatVec4(const StringId& uniformName, const glm::vec4& vec) const;
-    bool SetFloatVec3(const StringId& uniformName, const glm::vec3& vec) const;
-    bool SetFloat(const StringId& uniformName, const float value) const;
-    bool SetFloatArray(const StringId& uniformName, const std::vector<float>& values) const;
-    bool SetInt(const StringId& uniformName, const int value) const;
-    bool SetBool(const StringId& uniformName, const bool value) const;
+    bool SetMatrix4fv(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const glm::mat4& matrix, const GLuint count = 1) const;
+    bool SetFloatVec4(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const glm::vec4& vec) const;
+    bool SetFloatVec3(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const glm::vec3& vec) const;
+    bool SetFloat(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const float value) const;
+    bool SetInt(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const int value) const;
+    bool SetBool(rendering::IRenderDevice& renderDevice, const rendering::UniformSlot uniformSlot, const bool value) const;
 
     GLuint GetProgramId() const;    
 
-    const tsl::robin_map<StringId, GLuint, StringIdHasher>& GetUniformNamesToLocations() const;
+    GLint GetUniformSlotLocation(const rendering::UniformSlot uniformSlot) const;
+    const std::vector<GLint>& GetUniformSlotLocations() const;
 
     void CopyConstruction(const ShaderResource&);
     
 private:
-    tsl::robin_map<StringId, GLuint, StringIdHasher> mShaderUniformNamesToLocations;
+    std::vector<GLint> mUniformSlotLocations;
     GLuint mProgramId;    
 };
 
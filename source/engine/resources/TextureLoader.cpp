@@ -72,7 +72,7 @@ std::unique_ptr<IResource> TextureLoader::VCreateAndLoadResource(const std::stri
         return nullptr;
     }
 
-    GLuint glTextureId;
+    GLuint glTextureId = 0;
     GL_CHECK(glGenTextures(1, &glTextureId));
     GL_CHECK(glBindTexture(GL_TEXTURE_2D, glTextureId));
     
@@ -24,6 +24,10 @@ namespace scripting
 
 ///------------------------------------------------------------------------------------------------
 
+static bool TryGetEntityIdArgument(const LuaScriptingService& luaScriptingService, const std::string& functionName, ecs::EntityId& outEntityId);
+
+///------------------------------------------------------------------------------------------------
+
 void BindDefaultEngineFunctionsToLua()
 {
     using scripting::LuaScriptingService;
@@ -73,14 +77,14 @@ void BindDefaultEngineFunctionsToLua()
         const auto& luaScriptingService = LuaScriptingService::GetInstance();
         const auto stackSize = luaScriptingService.LuaGetIndexOfTopElement();
 
-        if (stackSize == 1)
+        auto entityId = ecs::NULL_ENTITY_ID;
+        if (stackSize != 1)
         {
-            const auto entityId = luaScriptingService.LuaToIntegral(1);
-            ecs::World::GetInstance().DestroyEntity(entityId);
+            luaScriptingService.ReportLuaScriptError("Illegal argument count (expected 1) when calling DestroyEntity");
         }
-        else
+        else if (TryGetEntityIdArgument(luaScriptingService, "DestroyEntity", entityId))
         {
-            luaScriptingService.ReportLuaScriptError("Illegal argument count (expected 1) when calling DestroyEntity");
+            ecs::World::GetInstance().DestroyEntity(entityId);
         }
 
         return 0;
@@ -91,18 +95,18 @@ void BindDefaultEngineFunctionsToLua()
         const auto& luaScriptingService = LuaScriptingService::GetInstance();
         const auto stackSize = luaScriptingService.LuaGetIndexOfTopElement();
 
-        if (stackSize == 1)
+        auto entityId = ecs::NULL_ENTITY_ID;
+        if (stackSize != 1)
+        {
+            luaScriptingService.ReportLuaScriptError("Illegal argument count (expected 1) when calling GetEntityPosition");
+        }
+        else if (TryGetEntityIdArgument(luaScriptingService, "GetEntityPosition", entityId))
         {
-            const auto entityId = luaScriptingService.LuaToIntegral(1);
             const auto& transformComponent = ecs::World::GetInstance().GetComponent<TransformComponent>(entityId);
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mPosition.x));
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mPosition.y));
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mPosition.z));
         }
-        else
-        {
-            luaScriptingService.ReportLuaScriptError("Illegal argument count (expected 1) when calling GetEntityPosition");
-        }
 
         return 3;
     });
@@ -112,9 +116,13 @@ void BindDefaultEngineFunctionsToLua()
         const auto& luaScriptingService = LuaScriptingService::GetInstance();
         const auto stackSize = luaScriptingService.LuaGetIndexOfTopElement();
 
-        if (stackSize == 4)
+        auto entityId = ecs::NULL_ENTITY_ID;
+        if (stackSize != 4)
+        {
+            luaScriptingService.ReportLuaScriptError("Illegal argument count (expected 4) when calling SetEntityPosition");
+        }
+        else if (TryGetEntityIdArgument(luaScriptingService, "SetEntityPosition", entityId))
         {
-            const auto entityId = luaScriptingService.LuaToIntegral(1);
             const auto positionX = luaScriptingService.LuaToDouble(2);
             const auto positionY = luaScriptingService.LuaToDouble(3);
             const auto positionZ = luaScriptingService.LuaToDouble(4);
@@ -122,10 +130,6 @@ void BindDefaultEngineFunctionsToLua()
             auto& transformComponent = ecs::World::GetInstance().GetComponent<TransformComponent>(entityId);
             transformComponent.mPosition = glm::vec3(positionX, positionY, positionZ);
         }
-        else
-        {
-            luaScriptingService.ReportLuaScriptError("Illegal argument count (expected 4) when calling SetEntityPosition");
-        }
 
         return 0;
     });
@@ -135,18 +139,18 @@ void BindDefaultEngineFunctionsToLua()
         const auto& luaScriptingService = LuaScriptingService::GetInstance();
         const auto stackSize = luaScriptingService.LuaGetIndexOfTopElement();
 
-        if (stackSize == 1)
+        auto entityId = ecs::NULL_ENTITY_ID;
+        if (stackSize != 1)
+        {
+            luaScriptingService.ReportLuaScriptError("Illegal argument count (expected 1) when calling GetEntityRotation");
+        }
+        else if (TryGetEntityIdArgument(luaScriptingService, "GetEntityRotation", entityId))
         {
-            const auto entityId = luaScriptingService.LuaToIntegral(1);
             const auto& transformComponent = ecs::World::GetInstance().GetComponent<TransformComponent>(entityId);
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mRotation.x));
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mRotation.y));
             luaScriptingService.LuaPushDouble(static_cast<double>(transformComponent.mRotation.z));
         }
-        else
-        {
-            luaScriptingService.ReportLuaScriptError("Illegal argument count (expected 1) when calling GetEntityPosition");
-        }
 
         return 3;
     });
@@ -156,9 +160,13 @@ void BindDefaultEngineFunctionsToLua()
         const auto& luaScriptingService = LuaScriptingService::GetInstance();
         const auto stackSize = luaScriptingService.LuaGetIndexOfTopElement();
 
-        if (stackSize == 4)
+        auto entityId = ecs::NULL_ENTITY_ID;
+        if (stackSize != 4)
+        {
+            luaScriptingService.ReportLuaScriptError("Illegal argument count (expected 4) when calling SetEntityRotation");
+        }
+        else if (TryGetEntityIdArgument(luaScriptingService, "SetEntityRotation", entityId))
         {
-            const auto entityId  = luaScriptingService.LuaToIntegral(1);
             const auto rotationX = luaScriptingService.LuaToDouble(2);
             const auto rotationY = luaScriptingService.LuaToDouble(3);
             const auto rotationZ = luaScriptingService.LuaToDouble(4);
@@ -166,10 +174,6 @@ void BindDefaultEngineFunctionsToLua()
             auto& transformComponent = ecs::World::GetInstance().GetComponent<TransformComponent>(entityId);
             transformComponent.mRotation = glm::vec3(rotationX, rotationY, rotationZ);
         }
-        else
-        {
-            luaScriptingService.ReportLuaScriptError("Illegal argument count (expected 4) when calling SetEntityPosition");
-        }
 
         return 0;
     });
@@ -177,6 +181,21 @@ void BindDefaultEngineFunctionsToLua()
 
 ///------------------------------------------------------------------------------------------------
 
+bool TryGetEntityIdArgument(const LuaScriptingService& luaScriptingService, const std::string& functionName, ecs::EntityId& outEntityId)
+{
+    // Scripts can hold on to the ids of entities that have since been destroyed
+    outEntityId = luaScriptingService.LuaToIntegral(1);
+    if (!ecs::World::GetInstance().HasEntity(outEntityId))
+    {
+        luaScriptingService.ReportLuaScriptError("Stale or unknown entity id passed to " + functionName);
+        return false;
+    }
+    
+    return true;
+}
+
+///------------------------------------------------------------------------------------------------
+
 }
 }
 
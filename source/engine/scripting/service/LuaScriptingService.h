@@ -26,6 +26,13 @@ typedef int(*lua_CFunction) (lua_State *L);
 
 ///------------------------------------------------------------------------------------------------
 
+namespace bench
+{
+    class HeadlessSimulationRunner;
+}
+
+///------------------------------------------------------------------------------------------------
+
 namespace genesis
 {
 
@@ -39,6 +46,7 @@ namespace scripting
 class LuaScriptingService final
 {        
     friend class genesis::GenesisEngine;
+    friend class bench::HeadlessSimulationRunner;
 
 public:   
     /// The default method of getting a hold of this singleton.
@@ -21,6 +21,7 @@
 #include "overworld/components/OverworldTargetComponent.h"
 #include "overworld/systems/OverworldBattleProcessingSystem.h"
 #include "overworld/systems/OverworldCameraControllerSystem.h"
+#include "overworld/systems/OverworldDayTimeDisplaySystem.h"
 #include "overworld/systems/OverworldDayTimeUpdaterSystem.h"
 #include "overworld/systems/OverworldHighlightingSystem.h"
 #include "overworld/systems/OverworldMapPickingInfoSystem.h"
@@ -42,6 +43,7 @@
 #include "../engine/ECS.h"
 #include "../engine/animation/systems/ModelAnimationSystem.h"
 #include "../engine/common/components/TransformComponent.h"
+#include "../engine/common/systems/TransformUpdaterSystem.h"
 #include "../engine/common/utils/Logging.h"
 #include "../engine/common/utils/MathUtils.h"
 #include "../engine/debug/components/DebugViewStateSingletonComponent.h"
@@ -94,7 +96,9 @@ void Game::VOnSystemsInit()
     world.AddSystem(std::make_unique<genesis::debug::DebugViewManagementSystem>());
 #endif
     
+    // Systems declaring their component access are updated concurrently with the neighbouring ones they don't conflict with
     world.AddSystem(std::make_unique<ModelAnimationTogglingSystem>());
+    world.AddSystem(std::make_unique<overworld::OverworldDayTimeUpdaterSystem>(), MAP_CONTEXT);
     world.AddSystem(std::make_unique<view::ViewManagementSystem>());
     
     world.AddSystem(std::make_unique<battle::BattleEndHandlingSystem>(), BATTLE_CONTEXT);
@@ -108,7 +112,7 @@ void Game::VOnSystemsInit()
     
     world.AddSystem(std::make_unique<overworld::OverworldHighlightingSystem>(), 0);
     
-    world.AddSystem(std::make_unique<overworld::OverworldDayTimeUpdaterSystem>(), MAP_CONTEXT);
+    world.AddSystem(std::make_unique<overworld::OverworldDayTimeDisplaySystem>(), MAP_CONTEXT);
     world.AddSystem(std::make_unique<overworld::ai::OverworldUnitAiUpdaterSystem>(), MAP_CONTEXT);
     world.AddSystem(std::make_unique<overworld::OverworldMapPickingInfoSystem>(), MAP_CONTEXT);
     world.AddSystem(std::make_unique<overworld::OverworldPlayerTargetSelectionSystem>(), MAP_CONTEXT);
@@ -119,8 +123,9 @@ void Game::VOnSystemsInit()
     world.AddSystem(std::make_unique<overworld::OverworldCameraControllerSystem>(), MAP_CONTEXT);
     
     world.AddSystem(std::make_unique<scene::SceneUpdaterSystem>());
-    world.AddSystem(std::make_unique<genesis::animation::ModelAnimationSystem>(), 0, genesis::ecs::SystemOperationMode::MULTI_THREADED);
+    world.AddSystem(std::make_unique<genesis::animation::ModelAnimationSystem>());
     world.AddSystem(std::make_unique<genesis::rendering::ParticleUpdaterSystem>());
+    world.AddSystem(std::make_unique<genesis::TransformUpdaterSystem>(), 0, genesis::ecs::SystemOperationMode::MULTI_THREADED);
     world.AddSystem(std::make_unique<genesis::rendering::RenderingSystem>());
 }
 
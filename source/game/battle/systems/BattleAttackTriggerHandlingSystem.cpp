@@ -30,7 +30,7 @@ namespace battle
 
 namespace
 {
-    static const StringId DAMAGED_EFFECT_UNIFORM_NAME = StringId("damaged_effect");
+    static const genesis::rendering::UniformSlot DAMAGED_EFFECT_UNIFORM_SLOT = genesis::rendering::GetUniformSlot(StringId("damaged_effect"));
     static const std::string PROJECTILE_MODEL_NAME = "arrow";
     static const glm::vec3 PROJECTILE_SCALE = glm::vec3(0.002f, 0.002f, 0.002f);
 }
@@ -49,10 +49,11 @@ void BattleAttackTriggerHandlingSystem::VUpdate(const float dt, const std::vecto
     if (IsBattleFinished()) return;
     
     auto& world = genesis::ecs::World::GetInstance();
+    auto& commandBuffer = world.GetCommandBuffer();
     for (const auto& entityId: entitiesToProcess)
     {
         auto& renderableComponent = world.GetComponent<genesis::rendering::RenderableComponent>(entityId);
-        renderableComponent.mShaderUniforms.mShaderBoolUniforms[DAMAGED_EFFECT_UNIFORM_NAME] = false;
+        renderableComponent.mShaderUniforms.SetBool(DAMAGED_EFFECT_UNIFORM_SLOT, false);
         
         if (genesis::animation::GetCurrentAnimationName(entityId) != StringId("attacking"))
         {
@@ -69,7 +70,7 @@ void BattleAttackTriggerHandlingSystem::VUpdate(const float dt, const std::vecto
             attackCooldownComponent.mAttackCooldown -= dt;
             if (attackCooldownComponent.mAttackCooldown < 0.0f)
             {
-                world.RemoveComponent<BattleAttackCooldownComponent>(entityId);
+                commandBuffer.RemoveComponent<BattleAttackCooldownComponent>(entityId);
             }
         }
         else
@@ -81,7 +82,7 @@ void BattleAttackTriggerHandlingSystem::VUpdate(const float dt, const std::vecto
             {
                 auto attackCooldownComponent = std::make_unique<BattleAttackCooldownComponent>();
                 attackCooldownComponent->mAttackCooldown = renderableComponent.mAnimationSpeed;
-                world.AddComponent<BattleAttackCooldownComponent>(entityId, std::move(attackCooldownComponent));
+                commandBuffer.AddComponent<BattleAttackCooldownComponent>(entityId, std::move(attackCooldownComponent));
                 
                 if (unitStatsComponent.mStats.mIsRangedUnit)
                 {
@@ -101,6 +102,7 @@ void BattleAttackTriggerHandlingSystem::VUpdate(const float dt, const std::vecto
 void BattleAttackTriggerHandlingSystem::CreateProjectile(const genesis::ecs::EntityId sourceEntityId) const
 {
     auto& world = genesis::ecs::World::GetInstance();
+    auto& commandBuffer = world.GetCommandBuffer();
     const auto& transformComponent = world.GetComponent<genesis::TransformComponent>(sourceEntityId);
     const auto& battleSideComponent = world.GetComponent<BattleSideComponent>(sourceEntityId);
     const auto& battleTargetComponent = world.GetComponent<BattleTargetComponent>(sourceEntityId);
@@ -120,24 +122,25 @@ void BattleAttackTriggerHandlingSystem::CreateProjectile(const genesis::ecs::Ent
     
     const auto projectileRotation = CalculateProjectileRotation(vecToTarget);
     
-    auto arrowEntity = genesis::rendering::LoadAndCreateStaticModelByName(PROJECTILE_MODEL_NAME, originPosition, projectileRotation, PROJECTILE_SCALE, GetProjectileEntityName());
+    auto arrowEntity = genesis::rendering::LoadAndCreateStaticModelByName(commandBuffer, PROJECTILE_MODEL_NAME, originPosition, projectileRotation, PROJECTILE_SCALE, GetProjectileEntityName());
+    const auto& arrowMesh = genesis::resources::ResourceLoadingService::GetInstance().GetResource<genesis::resources::MeshResource>(genesis::resources::ResourceLoadingService::RES_MODELS_ROOT + PROJECTILE_MODEL_NAME + ".obj");
     
     auto arrowBattleSideComponent = std::make_unique<BattleSideComponent>();
     arrowBattleSideComponent->mBattleSideLeaderUnitName = battleSideComponent.mBattleSideLeaderUnitName;
-    world.AddComponent<BattleSideComponent>(arrowEntity, std::move(arrowBattleSideComponent));
+    commandBuffer.AddComponent<BattleSideComponent>(arrowEntity, std::move(arrowBattleSideComponent));
     
     auto arrowProjectileComponent = std::make_unique<BattleProjectileComponent>();
     arrowProjectileComponent->mDamage = unitStatsComponent.mStats.mDamage;
     arrowProjectileComponent->mState = ProjectileState::SEEKING_TARGET;
     arrowProjectileComponent->mOffsetTargetPosition = offsetTargetPosition;
     
-    world.AddComponent<BattleProjectileComponent>(arrowEntity, std::move(arrowProjectileComponent));
+    commandBuffer.AddComponent<BattleProjectileComponent>(arrowEntity, std::move(arrowProjectileComponent));
     
     auto arrowBattleTargetComponent = std::make_unique<BattleTargetComponent>();
     arrowBattleTargetComponent->mTargetEntity = battleTargetComponent.mTargetEntity;
-    world.AddComponent<BattleTargetComponent>(arrowEntity, std::move(arrowBattleTargetComponent));
+    commandBuffer.AddComponent<BattleTargetComponent>(arrowEntity, std::move(arrowBattleTargetComponent));
     
-    AddCollidableDataToArrow(arrowEntity);
+    AddCollidableDataToArrow(arrowEntity, arrowMesh.GetDimensions() * PROJECTILE_SCALE);
 }
 
 ///-----------------------------------------------------------------------------------------------
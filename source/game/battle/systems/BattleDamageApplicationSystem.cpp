@@ -42,11 +42,11 @@ BattleDamageApplicationSystem::BattleDamageApplicationSystem()
 
 ///-----------------------------------------------------------------------------------------------
 
-void BattleDamageApplicationSystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>& entities) const
+void BattleDamageApplicationSystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const
 {
     auto& world = genesis::ecs::World::GetInstance();
+    auto& commandBuffer = world.GetCommandBuffer();
     
-    const auto entitiesToProcess = entities;
     for (const auto& entityId: entitiesToProcess)
     {
         const auto& damageComponent = world.GetComponent<BattleDamageComponent>(entityId);
@@ -66,13 +66,13 @@ void BattleDamageApplicationSystem::VUpdate(const float, const std::vector<genes
             genesis::animation::ChangeAnimation(entityId, StringId("dying"), false);
             auto destructionTimerComponent = std::make_unique<BattleDestructionTimerComponent>();
             destructionTimerComponent->mDestructionTimer = DEAD_UNIT_TTL;
-            world.AddComponent<BattleDestructionTimerComponent>(entityId, std::move(destructionTimerComponent));
-            world.RemoveComponent<CollidableComponent>(entityId);
+            commandBuffer.AddComponent<BattleDestructionTimerComponent>(entityId, std::move(destructionTimerComponent));
+            commandBuffer.RemoveComponent<CollidableComponent>(entityId);
         }
         
         AddBloodDropsToUnit(entityId);
         
-        world.RemoveComponent<BattleDamageComponent>(entityId);
+        commandBuffer.RemoveComponent<BattleDamageComponent>(entityId);
     }
 }
 
@@ -35,32 +35,13 @@ void BattleTargetAcquisitionSystem::VUpdate(const float, const std::vector<genes
     {
         if (IsUnitDead(entityId)) continue;
         
-        ValidateCurrentTargetComponent(entityId);
         PickOptimalTargetForEntity(entityId, entitiesToProcess);
     }
 }
 
 ///-----------------------------------------------------------------------------------------------
 
-void BattleTargetAcquisitionSystem::ValidateCurrentTargetComponent(const genesis::ecs::EntityId entityId) const
-{
-    auto& world = genesis::ecs::World::GetInstance();
-    if (world.HasComponent<BattleTargetComponent>(entityId))
-    {
-        auto& battleTargetComponent = world.GetComponent<BattleTargetComponent>(entityId);
-        
-        // If current unit has a target and target is still alive continue
-        if (!world.HasEntity(battleTargetComponent.mTargetEntity) || IsUnitDead(battleTargetComponent.mTargetEntity))
-        {
-            // Else erase this units target and recalculate
-            world.RemoveComponent<BattleTargetComponent>(entityId);
-        }
-    }
-}
-
-///-----------------------------------------------------------------------------------------------
-
-void BattleTargetAcquisitionSystem::PickOptimalTargetForEntity(const genesis::ecs::EntityId entityId, const std::vector<genesis::ecs::EntityId> entities) const
+void BattleTargetAcquisitionSystem::PickOptimalTargetForEntity(const genesis::ecs::EntityId entityId, const std::vector<genesis::ecs::EntityId>& entities) const
 {
     auto& world = genesis::ecs::World::GetInstance();
     const auto& transformComponent = world.GetComponent<genesis::TransformComponent>(entityId);
@@ -73,10 +54,11 @@ void BattleTargetAcquisitionSystem::PickOptimalTargetForEntity(const genesis::ec
         auto battleTargetComponent = std::make_unique<BattleTargetComponent>();
         battleTargetComponent->mTargetEntity = targetUnitEntity;
         assert(battleTargetComponent->mTargetEntity != genesis::ecs::NULL_ENTITY_ID && "Can't find target for unit");
-        world.AddComponent<BattleTargetComponent>(entityId, std::move(battleTargetComponent));
+        world.GetCommandBuffer().AddComponent<BattleTargetComponent>(entityId, std::move(battleTargetComponent));
     }
     else
     {
+        // Dead or destroyed targets are replaced here as well, as the closest target found is always alive
         auto& battleTargetComponent = world.GetComponent<BattleTargetComponent>(entityId);
         battleTargetComponent.mTargetEntity = targetUnitEntity;
         assert(battleTargetComponent.mTargetEntity != genesis::ecs::NULL_ENTITY_ID && "Can't find target for unit");
@@ -85,7 +67,7 @@ void BattleTargetAcquisitionSystem::PickOptimalTargetForEntity(const genesis::ec
 
 ///-----------------------------------------------------------------------------------------------
 
-genesis::ecs::EntityId BattleTargetAcquisitionSystem::FindClosestTargetUnit(const StringId& currentEntityBattleLeaderUnitName, const genesis::TransformComponent& currentEntityTransformComponent, const std::vector<genesis::ecs::EntityId> entities) const
+genesis::ecs::EntityId BattleTargetAcquisitionSystem::FindClosestTargetUnit(const StringId& currentEntityBattleLeaderUnitName, const genesis::TransformComponent& currentEntityTransformComponent, const std::vector<genesis::ecs::EntityId>& entities) const
 {
     const auto& world = genesis::ecs::World::GetInstance();
     auto closestTargetUnitEntity = genesis::ecs::NULL_ENTITY_ID;
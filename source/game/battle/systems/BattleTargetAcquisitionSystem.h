@@ -41,9 +41,8 @@ public:
     void VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>&) const override;
 
 private:
-    void ValidateCurrentTargetComponent(const genesis::ecs::EntityId entityId) const;
-    void PickOptimalTargetForEntity(const genesis::ecs::EntityId entityId, const std::vector<genesis::ecs::EntityId> entities) const;
-    genesis::ecs::EntityId FindClosestTargetUnit(const StringId& currentEntityBattleLeaderUnitName, const genesis::TransformComponent& currentEntityTransformComponent, const std::vector<genesis::ecs::EntityId> entities) const;
+    void PickOptimalTargetForEntity(const genesis::ecs::EntityId entityId, const std::vector<genesis::ecs::EntityId>& entities) const;
+    genesis::ecs::EntityId FindClosestTargetUnit(const StringId& currentEntityBattleLeaderUnitName, const genesis::TransformComponent& currentEntityTransformComponent, const std::vector<genesis::ecs::EntityId>& entities) const;
 };
 
 ///-----------------------------------------------------------------------------------------------
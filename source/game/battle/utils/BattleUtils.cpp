@@ -182,20 +182,15 @@ void AddBattleCasualty(const StringId unitType, const StringId leaderName)
 
 ///------------------------------------------------------------------------------------------------
 
-void AddCollidableDataToArrow(const genesis::ecs::EntityId arrowEntity)
+void AddCollidableDataToArrow(const genesis::ecs::EntityId arrowEntity, const glm::vec3& arrowScaledDimensions)
 {
-    auto& world = genesis::ecs::World::GetInstance();
-    const auto& entityTransformComponent =
-    world.GetComponent<genesis::TransformComponent>(arrowEntity);
-    const auto& entityRenderableComponent = world.GetComponent<genesis::rendering::RenderableComponent>(arrowEntity);
-    const auto& entityMeshResource = genesis::resources::ResourceLoadingService::GetInstance().GetResource<genesis::resources::MeshResource>( entityRenderableComponent.mMeshResourceIds[entityRenderableComponent.mCurrentMeshResourceIndex]);
-    const auto entityScaledDimensions = entityMeshResource.GetDimensions() * entityTransformComponent.mScale;
-    const auto entitySphereRadius = (entityScaledDimensions.x + entityScaledDimensions.y + entityScaledDimensions.z) * ENTITY_SPHERE_COLLISION_MULTIPLIER;
+    const auto entitySphereRadius = (arrowScaledDimensions.x + arrowScaledDimensions.y + arrowScaledDimensions.z) * ENTITY_SPHERE_COLLISION_MULTIPLIER;
     
     auto collidableComponent = std::make_unique<CollidableComponent>();
     collidableComponent->mCollidableDimensions.x = collidableComponent->mCollidableDimensions.y = collidableComponent->mCollidableDimensions.z = entitySphereRadius;
     
-    world.AddComponent<CollidableComponent>(arrowEntity, std::move(collidableComponent));
+    // Arrows are created mid-battle, while the battle systems iterate over their entities
+    genesis::ecs::World::GetInstance().GetCommandBuffer().AddComponent<CollidableComponent>(arrowEntity, std::move(collidableComponent));
 }
 
 ///-----------------------------------------------------------------------------------------------
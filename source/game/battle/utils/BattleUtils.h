@@ -12,6 +12,7 @@
 
 #include "../../engine/ECS.h"
 #include "../components/BattleStateSingletonComponent.h"
+#include "../../../engine/common/utils/MathUtils.h"
 
 ///------------------------------------------------------------------------------------------------
 
@@ -58,7 +59,7 @@ void AddBattleCasualty(const StringId unitType, const StringId leaderName);
 
 ///------------------------------------------------------------------------------------------------
 
-void AddCollidableDataToArrow(const genesis::ecs::EntityId arrowEntity);
+void AddCollidableDataToArrow(const genesis::ecs::EntityId arrowEntity, const glm::vec3& arrowScaledDimensions);
 
 ///------------------------------------------------------------------------------------------------
 
@@ -84,7 +84,7 @@ ActionStatus PatrolAroundRulingTownAction::VUpdateForEntity(const float, const g
         auto targetComponent = std::make_unique<OverworldTargetComponent>();
         targetComponent->mTargetPosition = unitAiComponent.mPathPositions.front();
         unitAiComponent.mPathPositions.pop_front();
-        world.AddComponent<OverworldTargetComponent>(entityId, std::move(targetComponent));
+        world.GetCommandBuffer().AddComponent<OverworldTargetComponent>(entityId, std::move(targetComponent));
     }
     // No target component and no other path positions
     else if (!world.HasComponent<OverworldTargetComponent>(entityId))
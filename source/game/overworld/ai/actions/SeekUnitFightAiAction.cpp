@@ -76,11 +76,12 @@ void SeekUnitFightAiAction::VStartForEntity(const genesis::ecs::EntityId entityI
         auto targetComponent = std::make_unique<OverworldTargetComponent>();
         targetComponent->mEntityTargetToFollow = targetEntity;
         
+        auto& commandBuffer = world.GetCommandBuffer();
         if (world.HasComponent<OverworldTargetComponent>(entityId))
         {
-            world.RemoveComponent<OverworldTargetComponent>(entityId);
+            commandBuffer.RemoveComponent<OverworldTargetComponent>(entityId);
         }
-        world.AddComponent<OverworldTargetComponent>(entityId, std::move(targetComponent));
+        commandBuffer.AddComponent<OverworldTargetComponent>(entityId, std::move(targetComponent));
         
         const auto currentTimeStamp = GetCurrentTimestamp();
         Log(LogType::INFO, "Unit %s started seeking unit %s at time (%d, %d, %.6f)",
@@ -48,7 +48,7 @@ void VisitRandomCityStateAiAction::VStartForEntity(const genesis::ecs::EntityId
         {
             auto targetComponent = std::make_unique<OverworldTargetComponent>();
             targetComponent->mEntityTargetToFollow = GetCityStateEntity(cityStateEntry.first);
-            world.AddComponent<OverworldTargetComponent>(entityId, std::move(targetComponent));
+            world.GetCommandBuffer().AddComponent<OverworldTargetComponent>(entityId, std::move(targetComponent));
             
             auto& unitStatsComponent = world.GetComponent<UnitStatsComponent>(entityId);
             unitStatsComponent.mStats.mUnitEventTimestamps[LAST_CITY_STATE_VISIT_EVENT_TIMESTAMP] = GetCurrentTimestamp();
@@ -82,7 +82,7 @@ ActionStatus VisitRandomCityStateAiAction::VUpdateForEntity(const float, const g
     if (AreEntitiesColliding(entityId, entityTargetComponent.mEntityTargetToFollow))
     {
         const auto currentTimeStamp = GetCurrentTimestamp();
-        Log(LogType::INFO, "Unit %s finished moving to city state %s at time (%d, %d, %.6f)", unitStatsComponent.mStats.mUnitName.GetString().c_str(), targetNameComponent.mName.GetString().c_str(),
+        Log(LogType::INFO, "Unit %s finished moving to city state %s at time (%d, %d, %.6f)", unitStatsComponent.mStats.mUnitName.GetString().c_str(), targetNameComponent.GetName().GetString().c_str(),
             currentTimeStamp.mYearBc, currentTimeStamp.mDay, currentTimeStamp.mTimeDtAccum);
         return ActionStatus::FINISHED;
     }
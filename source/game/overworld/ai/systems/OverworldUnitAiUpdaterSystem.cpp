@@ -46,10 +46,9 @@ OverworldUnitAiUpdaterSystem::OverworldUnitAiUpdaterSystem()
 
 ///-----------------------------------------------------------------------------------------------
 
-void OverworldUnitAiUpdaterSystem::VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entities) const
+void OverworldUnitAiUpdaterSystem::VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const
 {
     auto& world = genesis::ecs::World::GetInstance();
-    const auto entitiesToProcess = entities;
     const auto& registeredActionsComponent = world.GetSingletonComponent<OverworldUnitAiRegisteredActionsSingletonComponent>();
     
     for (const auto& entityId: entitiesToProcess)
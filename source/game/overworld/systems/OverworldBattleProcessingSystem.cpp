@@ -48,11 +48,11 @@ void OverworldBattleProcessingSystem::VUpdate(const float dt, const std::vector<
 
 ///-----------------------------------------------------------------------------------------------
 
-void OverworldBattleProcessingSystem::UpdateOverworldBattles(const float dt, const std::vector<genesis::ecs::EntityId>& entities) const
+void OverworldBattleProcessingSystem::UpdateOverworldBattles(const float dt, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const
 {
     auto& world = genesis::ecs::World::GetInstance();
+    auto& commandBuffer = world.GetCommandBuffer();
     
-    const auto entitiesToProcess = entities;
     for (const auto& entityId: entitiesToProcess)
     {
         auto& battleStateComponent = world.GetComponent<OverworldBattleStateComponent>(entityId);
@@ -74,7 +74,7 @@ void OverworldBattleProcessingSystem::UpdateOverworldBattles(const float dt, con
         {
             attackingUnitStatsComponent.mStats.mCurrentBattleDuration = 0.0f;
             defendingUnitStatsComponent.mStats.mCurrentBattleDuration = 0.0f;
-            world.DestroyEntity(entityId);
+            commandBuffer.DestroyEntity(entityId);
             continue;
         }
         else
@@ -87,7 +87,7 @@ void OverworldBattleProcessingSystem::UpdateOverworldBattles(const float dt, con
                     attackingUnitStatsComponent.mParty[0] = attackingUnitStatsComponent.mStats;
                     attackingUnitStatsComponent.mStats.mCurrentBattleDuration = 0.0f;
                     defendingUnitStatsComponent.mStats.mCurrentBattleDuration = 0.0f;
-                    world.DestroyEntity(entityId);
+                    commandBuffer.DestroyEntity(entityId);
                     continue;
                 }
                 else if (defendingUnitStatsComponent.mParty.size() == 1)
@@ -95,7 +95,7 @@ void OverworldBattleProcessingSystem::UpdateOverworldBattles(const float dt, con
                     defendingUnitStatsComponent.mParty[0] = defendingUnitStatsComponent.mStats;
                     attackingUnitStatsComponent.mStats.mCurrentBattleDuration = 0.0f;
                     defendingUnitStatsComponent.mStats.mCurrentBattleDuration = 0.0f;
-                    world.DestroyEntity(entityId);
+                    commandBuffer.DestroyEntity(entityId);
                     continue;
                 }
                 
@@ -136,8 +136,11 @@ void OverworldBattleProcessingSystem::CheckForLiveBattle() const
         auto attackerEntityId = lastInteraction.mInstigatorEntityId;
         auto defenderEntityId = lastInteraction.mOtherEntityId;
         
-        auto liveBattleEntity = FindBattleStateEntityThatInvolvesUnit(world.GetComponent<UnitStatsComponent>(defenderEntityId).mStats.mUnitName);
-        if (liveBattleEntity != genesis::ecs::NULL_ENTITY_ID)
+        // Battles that finished this frame are only destroyed at the next sync point, so the
+        // defender's battle duration is what tells whether it is still fighting
+        const auto& defenderUnitStatsComponent = world.GetComponent<UnitStatsComponent>(defenderEntityId);
+        auto liveBattleEntity = FindBattleStateEntityThatInvolvesUnit(defenderUnitStatsComponent.mStats.mUnitName);
+        if (liveBattleEntity != genesis::ecs::NULL_ENTITY_ID && defenderUnitStatsComponent.mStats.mCurrentBattleDuration > 0.0f)
         {
             auto& liveBattleState = world.GetComponent<OverworldBattleStateComponent>(liveBattleEntity);
             attackerEntityId = GetOverworldUnitEntityByName(liveBattleState.mAttackingUnitName);
@@ -0,0 +1,82 @@
+///------------------------------------------------------------------------------------------------
+///  OverworldDayTimeDisplaySystem.cpp
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#include "OverworldDayTimeDisplaySystem.h"
+#include "../components/OverworldDayTimeSingletonComponent.h"
+#include "../../../engine/common/utils/ColorUtils.h"
+#include "../../../engine/rendering/utils/FontUtils.h"
+#include "../../../engine/rendering/utils/MeshUtils.h"
+
+///-----------------------------------------------------------------------------------------------
+
+namespace overworld
+{
+
+///-----------------------------------------------------------------------------------------------
+
+namespace
+{
+    static const float TIME_STRING_SIZE        = 0.1f;
+    static const float CURRENT_PERIOD_Y_OFFSET = -0.94f;
+    
+    static const std::string TIME_DISPLAY_BACKGROUND_SPRITE_MODEL   = "gui_base";
+    static const std::string TIME_DISPLAY_BACKGROUND_SPRITE_TEXTURE = "horizontal_parchment";
+
+    static const StringId GAME_FONT_NAME           = StringId("game_font");
+    static const StringId TIME_DISPLAY_ENTITY_NAME = StringId("time_display");
+    static const StringId TIME_DISPLAY_SHADER_NAME = StringId("default_gui");
+
+    static const glm::vec3 TIME_DISPLAY_BACKGROUND_POSITION = glm::vec3(-0.69f, -0.89f, 0.01f);
+    static const glm::vec3 TIME_DISPLAY_BACKGROUND_SCALE    = glm::vec3(1.1f, 0.3f, 1.0f);
+    static const glm::vec3 DAY_STRING_POSITION              = glm::vec3(-0.91f, -0.84f, 0.0f);
+    static const glm::vec3 YEAR_STRING_POSITION             = glm::vec3(-0.63f, -0.84f, 0.0f);
+
+    static const tsl::robin_map<StringId, float, StringIdHasher> PERIOD_NAME_TO_X_OFFSET =
+    {
+        { StringId("Dawn"), -0.75f },
+        { StringId("Early Morning"), -0.89f },
+        { StringId("Morning"), -0.79f },
+        { StringId("Midday"), -0.79f },
+        { StringId("Afternoon"), -0.83f },
+        { StringId("Dusk"), -0.75f },
+        { StringId("Night"), -0.76f },
+        { StringId("Midnight"), -0.80f }
+    };
+}
+
+///-----------------------------------------------------------------------------------------------
+
+OverworldDayTimeDisplaySystem::OverworldDayTimeDisplaySystem()
+    : BaseSystem()
+{
+}
+
+///-----------------------------------------------------------------------------------------------
+
+void OverworldDayTimeDisplaySystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>&) const
+{
+    auto& world = genesis::ecs::World::GetInstance();
+    const auto& dayTimeComponent = world.GetSingletonComponent<OverworldDayTimeSingletonComponent>();
+    
+    world.DestroyEntities(world.FindAllEntitiesWithName(TIME_DISPLAY_ENTITY_NAME));
+    
+    // Background Sprite
+    genesis::rendering::LoadAndCreateGuiSprite(TIME_DISPLAY_BACKGROUND_SPRITE_MODEL, TIME_DISPLAY_BACKGROUND_SPRITE_TEXTURE, TIME_DISPLAY_SHADER_NAME,  TIME_DISPLAY_BACKGROUND_POSITION, glm::vec3(), TIME_DISPLAY_BACKGROUND_SCALE, false, TIME_DISPLAY_ENTITY_NAME);
+    
+    // Day Display
+    genesis::rendering::RenderText("Day " + std::to_string(dayTimeComponent.mCurrentDay), GAME_FONT_NAME, TIME_STRING_SIZE, DAY_STRING_POSITION, genesis::colors::BLACK, false, TIME_DISPLAY_ENTITY_NAME);
+    
+    // Year Display
+    genesis::rendering::RenderText(std::to_string(dayTimeComponent.mCurrentYearBc) + "bc", GAME_FONT_NAME, TIME_STRING_SIZE, YEAR_STRING_POSITION, genesis::colors::BLACK, false, TIME_DISPLAY_ENTITY_NAME);
+    
+    // Current period Display
+    genesis::rendering::RenderText(dayTimeComponent.mCurrentPeriod.GetString(), GAME_FONT_NAME, TIME_STRING_SIZE, glm::vec3(PERIOD_NAME_TO_X_OFFSET.at(dayTimeComponent.mCurrentPeriod), CURRENT_PERIOD_Y_OFFSET, 0.0f), genesis::colors::BLACK, false, TIME_DISPLAY_ENTITY_NAME);
+}
+
+///-----------------------------------------------------------------------------------------------
+
+}
@@ -0,0 +1,36 @@
+///------------------------------------------------------------------------------------------------
+///  OverworldDayTimeDisplaySystem.h
+///  AncientGreece
+///
+///  Created by Alex Koukoulas on 17/10/2026.
+///-----------------------------------------------------------------------------------------------
+
+#ifndef OverworldDayTimeDisplaySystem_h
+#define OverworldDayTimeDisplaySystem_h
+
+///-----------------------------------------------------------------------------------------------
+
+#include "../../../engine/ECS.h"
+
+///-----------------------------------------------------------------------------------------------
+
+namespace overworld
+{
+
+///-----------------------------------------------------------------------------------------------
+/// Rebuilds the on-screen day, year and day period display from the current overworld day time.
+class OverworldDayTimeDisplaySystem final : public genesis::ecs::BaseSystem<genesis::ecs::NullComponent>
+{
+public:
+    OverworldDayTimeDisplaySystem();
+
+    void VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>&) const override;
+};
+
+///-----------------------------------------------------------------------------------------------
+
+}
+
+///-----------------------------------------------------------------------------------------------
+
+#endif /* OverworldDayTimeDisplaySystem_h */
@@ -137,7 +137,7 @@ void OverworldHighlightingSystem::VUpdate(const float, const std::vector<genesis
         {
             renderableComponent.mShaderNameId = HIGHLIGHTED_STATIC_MODEL_SHADER;
             const auto& cityStateName = world.GetComponent<genesis::NameComponent>(entityId);
-            CreateCityStatePreviewPopup(transformComponent.mPosition, cityStateName.mName);
+            CreateCityStatePreviewPopup(transformComponent.mPosition, cityStateName.GetName());
         }
 
         break;
@@ -54,11 +54,11 @@ OverworldMovementControllerSystem::OverworldMovementControllerSystem()
 
 ///-----------------------------------------------------------------------------------------------
 
-void OverworldMovementControllerSystem::VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entities) const
+void OverworldMovementControllerSystem::VUpdate(const float dt, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const
 {
     auto& world = genesis::ecs::World::GetInstance();
+    auto& commandBuffer = world.GetCommandBuffer();
     auto mapEntity = GetMapEntity();
-    const auto entitiesToProcess = entities;
     for (const auto entityId: entitiesToProcess)
     {
         const auto& unitStatsComponent = world.GetComponent<UnitStatsComponent>(entityId);
@@ -90,13 +90,13 @@ void OverworldMovementControllerSystem::VUpdate(const float dt, const std::vecto
                 interactionComponent->mInteraction.mInstigatorEntityId = entityId;
                 interactionComponent->mInteraction.mInstigatorUnitName = world.GetComponent<UnitStatsComponent>(entityId).mStats.mUnitName;
                 interactionComponent->mInteraction.mOtherEntityId = targetComponent.mEntityTargetToFollow;
-                interactionComponent->mInteraction.mOtherUnitName = world.HasComponent<UnitStatsComponent>(targetComponent.mEntityTargetToFollow) ? world.GetComponent<UnitStatsComponent>(targetComponent.mEntityTargetToFollow).mStats.mUnitName : world.GetComponent<genesis::NameComponent>(targetComponent.mEntityTargetToFollow).mName;
-                world.AddComponent<OverworldInteractionComponent>(world.CreateEntity(), std::move(interactionComponent));
+                interactionComponent->mInteraction.mOtherUnitName = world.HasComponent<UnitStatsComponent>(targetComponent.mEntityTargetToFollow) ? world.GetComponent<UnitStatsComponent>(targetComponent.mEntityTargetToFollow).mStats.mUnitName : world.GetComponent<genesis::NameComponent>(targetComponent.mEntityTargetToFollow).GetName();
+                commandBuffer.AddComponent<OverworldInteractionComponent>(commandBuffer.CreateEntity(), std::move(interactionComponent));
             }
             
             // Start Idle animation
             genesis::animation::ChangeAnimation(entityId, StringId("idle"));
-            world.RemoveComponent<OverworldTargetComponent>(entityId);
+            commandBuffer.RemoveComponent<OverworldTargetComponent>(entityId);
         }
         // Else move and rotate towards target
         else
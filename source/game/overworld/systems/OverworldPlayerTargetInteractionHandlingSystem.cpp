@@ -91,10 +91,10 @@ OverworldPlayerTargetInteractionHandlingSystem::OverworldPlayerTargetInteraction
 
 ///-----------------------------------------------------------------------------------------------
 
-void OverworldPlayerTargetInteractionHandlingSystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>& entities) const
+void OverworldPlayerTargetInteractionHandlingSystem::VUpdate(const float, const std::vector<genesis::ecs::EntityId>& entitiesToProcess) const
 {
     auto& world = genesis::ecs::World::GetInstance();
-    const auto entitiesToProcess = entities;
+    auto& commandBuffer = world.GetCommandBuffer();
     
     for (const auto entityId: entitiesToProcess)
     {
@@ -128,7 +128,7 @@ void OverworldPlayerTargetInteractionHandlingSystem::VUpdate(const float, const
             }
         }
         
-        world.DestroyEntity(entityId);
+        commandBuffer.DestroyEntity(entityId);
     }
 }
 
@@ -252,7 +252,7 @@ void OverworldPlayerTargetInteractionHandlingSystem::ShowOngoingBattleUnitIntrac
 void OverworldPlayerTargetInteractionHandlingSystem::ShowCityStateInteractionView(const OverworldInteractionComponent& overworldInteractionComponent) const
 {
     const auto& world = genesis::ecs::World::GetInstance();
-    const auto cityName = world.GetComponent<genesis::NameComponent>(overworldInteractionComponent.mInteraction.mOtherEntityId).mName;
+    const auto cityName = world.GetComponent<genesis::NameComponent>(overworldInteractionComponent.mInteraction.mOtherEntityId).GetName();
     const auto& cityStateInfo = GetCityStateInfo(cityName);
     const auto garissonColor = GetCityStateGarissonColor(cityName);
     const auto renownColor = GetCityStateRenownColor(cityName);
@@ -318,7 +318,7 @@ void SaveOverworldStateToFile()
                 }
                 else
                 {
-                    unitJsonObject["target_city_state_name"] = world.GetComponent<genesis::NameComponent>(targetComponent.mEntityTargetToFollow).mName.GetString();
+                    unitJsonObject["target_city_state_name"] = world.GetComponent<genesis::NameComponent>(targetComponent.mEntityTargetToFollow).GetName().GetString();
                 }
             }
             else
@@ -729,6 +729,9 @@ void PopulateOverworldCityStates()
         renderableComponent.mIsAffectedByLight = true;
         renderableComponent.mIsCastingShadows = true;
         
+        // City state buildings are solid, so they can hide the units and ships behind them
+        renderableComponent.mIsOccluder = true;
+        
         world.AddComponent<overworld::OverworldHighlightableComponent>(cityStateEntity, std::make_unique<overworld::OverworldHighlightableComponent>());
         
         AddCollidableDataToCityState(cityStateEntity);
@@ -14,6 +14,7 @@
 ModelAnimationTogglingSystem::ModelAnimationTogglingSystem()
     : BaseSystem()
 {
+    DeclareWriteAccess<genesis::rendering::RenderableComponent>();
 }
 
 ///-----------------------------------------------------------------------------------------------
@@ -27,7 +27,7 @@ namespace view
 
 namespace
 {
-    static const StringId GUI_SHADER_CUSTOM_COLOR_UNIFORM_NAME = StringId("custom_color");
+    static const genesis::rendering::UniformSlot GUI_SHADER_CUSTOM_COLOR_UNIFORM_SLOT = genesis::rendering::GetUniformSlot(StringId("custom_color"));
     static const StringId CLOSE_EVENT_NAME           = StringId("close");
     static const StringId ATTACK_EVENT_NAME          = StringId("attack");
     static const StringId ASSIST_ATTACKER_EVENT_NAME = StringId("assist_attacker");
@@ -96,7 +96,7 @@ void ViewManagementSystem::ProcessClickableEntity(const genesis::ecs::EntityId e
     
     if (genesis::math::IsPointInsideRectangle(boundingRect.bottomLeft, boundingRect.topRight, mousePosNdc))
     {
-        renderableComponent.mShaderUniforms.mShaderFloatVec4Uniforms[GUI_SHADER_CUSTOM_COLOR_UNIFORM_NAME] = clickableComponent.mInteractionColor;
+        renderableComponent.mShaderUniforms.SetFloatVec4(GUI_SHADER_CUSTOM_COLOR_UNIFORM_SLOT, clickableComponent.mInteractionColor);
         
         if (genesis::input::GetButtonState(genesis::input::Button::LEFT_BUTTON) == genesis::input::InputState::TAPPED)
         {
@@ -105,7 +105,7 @@ void ViewManagementSystem::ProcessClickableEntity(const genesis::ecs::EntityId e
     }
     else
     {
-        renderableComponent.mShaderUniforms.mShaderFloatVec4Uniforms[GUI_SHADER_CUSTOM_COLOR_UNIFORM_NAME] = clickableComponent.mTextColor;
+        renderableComponent.mShaderUniforms.SetFloatVec4(GUI_SHADER_CUSTOM_COLOR_UNIFORM_SLOT, clickableComponent.mTextColor);
     }
 }
 